@@ -93,3 +93,9 @@ struct ArrowArray kuzu_query_result_get_next_arrow_chunk(
     kuzu_query_result* query_result, int64_t chunk_size) {
     return *static_cast<QueryResult*>(query_result->_query_result)->getNextArrowChunk(chunk_size);
 }
+
+struct ArrowArrayStream kuzu_query_result_get_arrow_array_stream(
+    kuzu_query_result* query_result, int64_t chunk_size) {
+    return *static_cast<QueryResult*>(query_result->_query_result)
+                ->getArrowArrayStream(chunk_size);
+}
@@ -2,6 +2,7 @@
 
 #include <cstdlib>
 
+#include "c_api/helpers.h"
 #include "c_api/kuzu.h"
 
 using namespace kuzu::main;
@@ -22,3 +23,8 @@ double kuzu_query_summary_get_compiling_time(kuzu_query_summary* query_summary)
 double kuzu_query_summary_get_execution_time(kuzu_query_summary* query_summary) {
     return static_cast<QuerySummary*>(query_summary->_query_summary)->getExecutionTime();
 }
+
+char* kuzu_query_summary_get_profile_json(kuzu_query_summary* query_summary) {
+    return convertToOwnedCString(
+        static_cast<QuerySummary*>(query_summary->_query_summary)->getProfileJson());
+}
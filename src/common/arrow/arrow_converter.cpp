@@ -1,5 +1,6 @@
 #include "common/arrow/arrow_converter.h"
 
+#include <cerrno>
 #include <cstring>
 
 #include "common/arrow/arrow_row_batch.h"
@@ -202,5 +203,64 @@ void ArrowConverter::toArrowArray(
     *outArray = rowBatch->append(queryResult, chunkSize);
 }
 
+struct ArrowArrayStreamHolder {
+    main::QueryResult* queryResult;
+    std::int64_t chunkSize;
+    std::string lastError;
+};
+
+static int getArrowArrayStreamSchema(ArrowArrayStream* stream, ArrowSchema* out) {
+    auto holder = static_cast<ArrowArrayStreamHolder*>(stream->private_data);
+    try {
+        *out = *ArrowConverter::toArrowSchema(holder->queryResult->getColumnTypesInfo());
+    } catch (std::exception& e) {
+        holder->lastError = e.what();
+        return EIO;
+    }
+    return 0;
+}
+
+static int getArrowArrayStreamNext(ArrowArrayStream* stream, ArrowArray* out) {
+    auto holder = static_cast<ArrowArrayStreamHolder*>(stream->private_data);
+    try {
+        if (!holder->queryResult->hasNext()) {
+            // A released array marks the end of the stream.
+            out->release = nullptr;
+            return 0;
+        }
+        ArrowConverter::toArrowArray(*holder->queryResult, out, holder->chunkSize);
+    } catch (std::exception& e) {
+        holder->lastError = e.what();
+        return EIO;
+    }
+    return 0;
+}
+
+static const char* getArrowArrayStreamLastError(ArrowArrayStream* stream) {
+    auto holder = static_cast<ArrowArrayStreamHolder*>(stream->private_data);
+    return holder->lastError.empty() ? nullptr : holder->lastError.c_str();
+}
+
+static void releaseArrowArrayStream(ArrowArrayStream* stream) {
+    if (!stream || !stream->release) {
+        return;
+    }
+    stream->release = nullptr;
+    delete static_cast<ArrowArrayStreamHolder*>(stream->private_data);
+}
+
+void ArrowConverter::toArrowArrayStream(
+    main::QueryResult& queryResult, ArrowArrayStream* outStream, std::int64_t chunkSize) {
+    KU_ASSERT(chunkSize > 0);
+    auto holder = std::make_unique<ArrowArrayStreamHolder>();
+    holder->queryResult = &queryResult;
+    holder->chunkSize = chunkSize;
+    outStream->get_schema = getArrowArrayStreamSchema;
+    outStream->get_next = getArrowArrayStreamNext;
+    outStream->get_last_error = getArrowArrayStreamLastError;
+    outStream->release = releaseArrowArrayStream;
+    outStream->private_data = holder.release();
+}
+
 } // namespace common
 } // namespace kuzu
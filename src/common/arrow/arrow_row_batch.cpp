@@ -7,6 +7,7 @@
 #include "common/types/value/node.h"
 #include "common/types/value/rel.h"
 #include "common/types/value/value.h"
+#include "processor/result/factorized_table.h"
 #include "storage/storage_utils.h"
 
 namespace kuzu {
@@ -241,25 +242,25 @@ void ArrowRowBatch::templateCopyNonNullValue<LogicalTypeID::BOOL>(
     }
 }
 
+void ArrowRowBatch::copyString(
+    ArrowVector* vector, const uint8_t* data, std::uint32_t length, std::int64_t pos) {
+    auto offsets = (std::uint32_t*)vector->data.data();
+    offsets[pos + 1] = offsets[pos] + length;
+    vector->overflow.resize(offsets[pos + 1]);
+    std::memcpy(vector->overflow.data() + offsets[pos], data, length);
+}
+
 template<>
 void ArrowRowBatch::templateCopyNonNullValue<LogicalTypeID::STRING>(
     ArrowVector* vector, const main::DataTypeInfo& /*typeInfo*/, Value* value, std::int64_t pos) {
-    auto offsets = (std::uint32_t*)vector->data.data();
-    auto strLength = value->strVal.length();
-    offsets[pos + 1] = offsets[pos] + strLength;
-    vector->overflow.resize(offsets[pos + 1]);
-    std::memcpy(vector->overflow.data() + offsets[pos], value->strVal.data(), strLength);
+    copyString(vector, (const uint8_t*)value->strVal.data(), value->strVal.length(), pos);
 }
 
 template<>
 void ArrowRowBatch::templateCopyNonNullValue<LogicalTypeID::UUID>(
     ArrowVector* vector, const main::DataTypeInfo& /*typeInfo*/, Value* value, std::int64_t pos) {
-    auto offsets = (std::uint32_t*)vector->data.data();
     auto str = UUID::toString(value->val.int128Val);
-    auto strLength = str.length();
-    offsets[pos + 1] = offsets[pos] + strLength;
-    vector->overflow.resize(offsets[pos + 1]);
-    std::memcpy(vector->overflow.data() + offsets[pos], str.data(), strLength);
+    copyString(vector, (const uint8_t*)str.data(), str.length(), pos);
 }
 
 template<>
@@ -814,7 +815,88 @@ ArrowArray ArrowRowBatch::toArray() {
     return result;
 }
 
+void ArrowRowBatch::copyNonNullValueBuffer(ArrowVector* vector, const main::DataTypeInfo& typeInfo,
+    const uint8_t* valueBuffer, uint32_t numBytesPerValue, Value* value, std::int64_t pos) {
+    switch (typeInfo.typeID) {
+    case LogicalTypeID::BOOL: {
+        if (*(bool*)valueBuffer) {
+            setBitToOne(vector->data.data(), pos);
+        } else {
+            setBitToZero(vector->data.data(), pos);
+        }
+    } break;
+    case LogicalTypeID::STRING: {
+        auto& str = *(ku_string_t*)valueBuffer;
+        copyString(vector, str.getData(), str.len, pos);
+    } break;
+    case LogicalTypeID::UUID: {
+        auto str = UUID::toString(*(int128_t*)valueBuffer);
+        copyString(vector, (const uint8_t*)str.data(), str.length(), pos);
+    } break;
+    case LogicalTypeID::LIST:
+    case LogicalTypeID::ARRAY:
+    case LogicalTypeID::STRUCT:
+    case LogicalTypeID::INTERNAL_ID:
+    case LogicalTypeID::NODE:
+    case LogicalTypeID::REL: {
+        value->copyValueFrom(valueBuffer);
+        copyNonNullValue(vector, typeInfo, value, pos);
+    } break;
+    default: {
+        std::memcpy(vector->data.data() + pos * numBytesPerValue, valueBuffer, numBytesPerValue);
+    }
+    }
+}
+
+std::int64_t ArrowRowBatch::appendFromTable(
+    main::QueryResult& queryResult, std::int64_t chunkSize) {
+    auto table = queryResult.getTable();
+    auto tableSchema = table->getTableSchema();
+    auto columnTypes = queryResult.getColumnDataTypes();
+    std::vector<std::unique_ptr<Value>> values;
+    std::vector<uint32_t> numBytesPerValue;
+    for (auto& columnType : columnTypes) {
+        values.push_back(std::make_unique<Value>(Value::createDefaultValue(columnType)));
+        numBytesPerValue.push_back(storage::StorageUtils::getDataTypeSize(columnType));
+    }
+    auto tuples = std::make_unique<uint8_t*[]>(DEFAULT_VECTOR_CAPACITY);
+    std::int64_t numTuplesInBatch = 0;
+    while (numTuplesInBatch < chunkSize) {
+        uint64_t startTupleIdx;
+        auto numTuplesToAppend = queryResult.skipNextTuples(
+            std::min<uint64_t>(chunkSize - numTuplesInBatch, DEFAULT_VECTOR_CAPACITY),
+            startTupleIdx);
+        if (numTuplesToAppend == 0) {
+            break;
+        }
+        for (auto i = 0u; i < numTuplesToAppend; i++) {
+            tuples[i] = table->getTuple(startTupleIdx + i);
+        }
+        // Append column by column, so that each arrow vector is written sequentially.
+        for (auto colIdx = 0u; colIdx < columnTypes.size(); colIdx++) {
+            auto vector = vectors[colIdx].get();
+            auto colOffset = tableSchema->getColOffset(colIdx);
+            for (auto i = 0u; i < numTuplesToAppend; i++) {
+                if (table->isNonOverflowColNull(
+                        tuples[i] + tableSchema->getNullMapOffset(), colIdx)) {
+                    copyNullValue(vector, values[colIdx].get(), vector->numValues);
+                } else {
+                    copyNonNullValueBuffer(vector, *typesInfo[colIdx], tuples[i] + colOffset,
+                        numBytesPerValue[colIdx], values[colIdx].get(), vector->numValues);
+                }
+                vector->numValues++;
+            }
+        }
+        numTuplesInBatch += numTuplesToAppend;
+    }
+    return numTuplesInBatch;
+}
+
 ArrowArray ArrowRowBatch::append(main::QueryResult& queryResult, std::int64_t chunkSize) {
+    if (!queryResult.getTable()->hasUnflatCol()) {
+        numTuples += appendFromTable(queryResult, chunkSize);
+        return toArray();
+    }
     std::int64_t numTuplesInBatch = 0;
     auto numColumns = queryResult.getColumnNames().size();
     while (numTuplesInBatch < chunkSize) {
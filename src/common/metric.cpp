@@ -1,5 +1,7 @@
 #include "common/metric.h"
 
+#include <algorithm>
+
 namespace kuzu {
 namespace common {
 
@@ -51,5 +53,63 @@ void NumericMetric::incrementByOne() {
     accumulatedValue++;
 }
 
+ThreadResourceCounters& ThreadResourceCounters::get() {
+    thread_local ThreadResourceCounters counters;
+    return counters;
+}
+
+// The metric that resources used by the thread are currently added to.
+static thread_local ResourceMetric* activeResourceMetric = nullptr;
+
+ResourceMetric::Checkpoint ResourceMetric::Checkpoint::now() {
+    return Checkpoint{std::chrono::steady_clock::now(), ThreadResourceCounters::get()};
+}
+
+ResourceMetric::ResourceMetric(bool enable)
+    : Metric(enable), accumulatedTime{0}, numPageHits{0}, numPageMisses{0}, numBytesRead{0},
+      memoryUsage{0}, peakMemoryUsage{0}, parent{nullptr} {}
+
+void ResourceMetric::start() {
+    if (!enabled) {
+        return;
+    }
+    auto now = Checkpoint::now();
+    if (activeResourceMetric != nullptr) {
+        activeResourceMetric->accumulate(now);
+    }
+    parent = activeResourceMetric;
+    activeResourceMetric = this;
+    checkpoint = now;
+}
+
+void ResourceMetric::stop() {
+    if (!enabled) {
+        return;
+    }
+    KU_ASSERT(activeResourceMetric == this);
+    auto now = Checkpoint::now();
+    accumulate(now);
+    activeResourceMetric = parent;
+    if (parent != nullptr) {
+        parent->checkpoint = now;
+    }
+    parent = nullptr;
+}
+
+double ResourceMetric::getElapsedTimeMS() const {
+    return accumulatedTime / 1000;
+}
+
+void ResourceMetric::accumulate(const Checkpoint& now) {
+    accumulatedTime +=
+        std::chrono::duration<double, std::micro>(now.time - checkpoint.time).count();
+    numPageHits += now.counters.numPageHits - checkpoint.counters.numPageHits;
+    numPageMisses += now.counters.numPageMisses - checkpoint.counters.numPageMisses;
+    numBytesRead += now.counters.numBytesRead - checkpoint.counters.numBytesRead;
+    memoryUsage += now.counters.memoryUsage - checkpoint.counters.memoryUsage;
+    peakMemoryUsage = std::max(peakMemoryUsage, memoryUsage);
+    checkpoint = now;
+}
+
 } // namespace common
 } // namespace kuzu
@@ -17,6 +17,13 @@ NumericMetric* Profiler::registerNumericMetric(const std::string& key) {
     return metricPtr;
 }
 
+ResourceMetric* Profiler::registerResourceMetric(const std::string& key) {
+    auto resourceMetric = std::make_unique<ResourceMetric>(enabled);
+    auto metricPtr = resourceMetric.get();
+    addMetric(key, std::move(resourceMetric));
+    return metricPtr;
+}
+
 double Profiler::sumAllTimeMetricsWithKey(const std::string& key) {
     auto sum = 0.0;
     if (!metrics.contains(key)) {
@@ -39,6 +46,17 @@ uint64_t Profiler::sumAllNumericMetricsWithKey(const std::string& key) {
     return sum;
 }
 
+std::vector<ResourceMetric*> Profiler::getResourceMetricsWithKey(const std::string& key) {
+    std::vector<ResourceMetric*> result;
+    if (!metrics.contains(key)) {
+        return result;
+    }
+    for (auto& metric : metrics.at(key)) {
+        result.push_back((ResourceMetric*)metric.get());
+    }
+    return result;
+}
+
 void Profiler::addMetric(const std::string& key, std::unique_ptr<Metric> metric) {
     std::lock_guard<std::mutex> lck(mtx);
     if (!metrics.contains(key)) {
@@ -16,18 +16,18 @@ BufferedFileWriter::BufferedFileWriter(std::unique_ptr<FileInfo> fileInfo)
       fileInfo(std::move(fileInfo)) {}
 
 void BufferedFileWriter::write(const uint8_t* data, uint64_t size) {
-    if (bufferOffset + size <= BUFFER_SIZE) {
-        memcpy(&buffer[bufferOffset], data, size);
-        bufferOffset += size;
-    } else {
+    // Data can be larger than the buffer, e.g. long strings, in which case the buffer is flushed
+    // multiple times.
+    while (bufferOffset + size > BUFFER_SIZE) {
         auto toCopy = BUFFER_SIZE - bufferOffset;
         memcpy(&buffer[bufferOffset], data, toCopy);
         bufferOffset += toCopy;
         flush();
-        auto remaining = size - toCopy;
-        memcpy(buffer.get(), data + toCopy, remaining);
-        bufferOffset += remaining;
+        data += toCopy;
+        size -= toCopy;
     }
+    memcpy(&buffer[bufferOffset], data, size);
+    bufferOffset += size;
 }
 
 void BufferedFileWriter::flush() {
@@ -44,18 +44,16 @@ BufferedFileReader::BufferedFileReader(std::unique_ptr<FileInfo> fileInfo)
 }
 
 void BufferedFileReader::read(uint8_t* data, uint64_t size) {
-    if (bufferOffset + size <= BUFFER_SIZE) {
-        memcpy(data, &buffer[bufferOffset], size);
-        bufferOffset += size;
-    } else {
+    while (bufferOffset + size > BUFFER_SIZE) {
         auto toCopy = BUFFER_SIZE - bufferOffset;
         memcpy(data, &buffer[bufferOffset], toCopy);
         bufferOffset += toCopy;
         readNextPage();
-        auto remaining = size - toCopy;
-        memcpy(data + toCopy, buffer.get(), remaining);
-        bufferOffset += remaining;
+        data += toCopy;
+        size -= toCopy;
     }
+    memcpy(data, &buffer[bufferOffset], size);
+    bufferOffset += size;
 }
 
 void BufferedFileReader::readNextPage() {
@@ -1,19 +1,41 @@
 #include "common/task_system/task.h"
 
+#include "common/task_system/task_scheduler.h"
+
 namespace kuzu {
 namespace common {
 
 Task::Task(uint64_t maxNumThreads) : maxNumThreads{maxNumThreads} {}
 
-bool Task::registerThread() {
+bool Task::registerThread(bool onlyIfStarving) {
     lock_t lck{mtx};
+    if (onlyIfStarving && numThreadsRegistered > 0) {
+        return false;
+    }
     if (!hasExceptionNoLock() && canRegisterNoLock()) {
+        if (numThreadsRegistered == 0 && scheduler != nullptr) {
+            scheduler->onTaskStarted();
+        }
         numThreadsRegistered++;
         return true;
     }
     return false;
 }
 
+bool Task::tryYield() {
+    if (scheduler == nullptr || !scheduler->hasStarvingTasks()) {
+        return false;
+    }
+    lock_t lck{mtx};
+    // Threads that haven't yielded either still work on the task or have finished because there
+    // is no more work left. Keeping one of them is enough to complete the task.
+    if (numThreadsYielded + 1 >= numThreadsRegistered) {
+        return false;
+    }
+    numThreadsYielded++;
+    return true;
+}
+
 void Task::deRegisterThreadAndFinalizeTask() {
     lock_t lck{mtx};
     ++numThreadsFinished;
@@ -5,9 +5,14 @@ using namespace kuzu::common;
 namespace kuzu {
 namespace common {
 
-TaskScheduler::TaskScheduler(uint64_t numThreads) : stopThreads{false}, nextScheduledTaskID{0} {
+TaskScheduler::TaskScheduler(uint64_t numThreads)
+    : numStarvingTasks{0}, stopThreads{false}, queueVersion{0}, nextScheduledTaskID{0} {
+    auto numQueues = std::max(numThreads, (uint64_t)1);
+    for (auto i = 0u; i < numQueues; ++i) {
+        taskQueues.push_back(std::make_unique<TaskQueue>());
+    }
     for (auto n = 0u; n < numThreads; ++n) {
-        threads.emplace_back([&] { runWorkerThread(); });
+        threads.emplace_back([this, n] { runWorkerThread(n); });
     }
 }
 
@@ -67,27 +72,51 @@ void TaskScheduler::scheduleTaskAndWaitOrError(
 std::shared_ptr<ScheduledTask> TaskScheduler::pushTaskIntoQueue(const std::shared_ptr<Task>& task) {
     lock_t lck{mtx};
     auto scheduledTask = std::make_shared<ScheduledTask>(task, nextScheduledTaskID++);
-    taskQueue.push_back(scheduledTask);
+    task->scheduler = this;
+    numStarvingTasks.fetch_add(1);
+    auto& taskQueue = *taskQueues[scheduledTask->ID % taskQueues.size()];
+    {
+        lock_t queueLck{taskQueue.mtx};
+        taskQueue.tasks.push_back(scheduledTask);
+    }
+    queueVersion++;
     return scheduledTask;
 }
 
-std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegister() {
-    if (taskQueue.empty()) {
-        return nullptr;
+std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegister(uint64_t workerIdx) {
+    // Starving tasks are looked for in all queues before joining a task that is already running.
+    for (auto onlyStarvingTasks : {true, false}) {
+        if (onlyStarvingTasks && !hasStarvingTasks()) {
+            continue;
+        }
+        for (auto i = 0u; i < taskQueues.size(); ++i) {
+            auto& taskQueue = *taskQueues[(workerIdx + i) % taskQueues.size()];
+            auto scheduledTask = getTaskAndRegister(taskQueue, onlyStarvingTasks);
+            if (scheduledTask != nullptr) {
+                return scheduledTask;
+            }
+        }
     }
-    auto it = taskQueue.begin();
-    while (it != taskQueue.end()) {
+    return nullptr;
+}
+
+std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegister(
+    TaskQueue& taskQueue, bool onlyStarvingTasks) {
+    lock_t lck{taskQueue.mtx};
+    auto it = taskQueue.tasks.begin();
+    while (it != taskQueue.tasks.end()) {
         auto task = (*it)->task;
-        if (!task->registerThread()) {
-            // If we cannot register for a thread it is because of three possibilities:
+        if (!task->registerThread(onlyStarvingTasks)) {
+            // If we cannot register for a thread it is because of four possibilities:
             // (i) maximum number of threads have registered for task and the task is completed
             // without an exception; or (ii) same as (i) but the task has not yet successfully
-            // completed; or (iii) task has an exception; Only in (i) we remove the task from the
-            // queue. For (ii) and (iii) we keep the task in queue. Recall erroring tasks need to be
-            // manually removed.
+            // completed; or (iii) task has an exception; or (iv) we are only looking for starving
+            // tasks and the task already has registered threads. Only in (i) we remove the task
+            // from the queue. For the others we keep the task in queue. Recall erroring tasks need
+            // to be manually removed.
             if (task->isCompletedSuccessfully()) { // option (i)
-                it = taskQueue.erase(it);
-            } else { // option (ii) or (iii): keep the task in the queue.
+                it = taskQueue.tasks.erase(it);
+            } else { // option (ii), (iii) or (iv): keep the task in the queue.
                 ++it;
             }
         } else {
@@ -98,35 +127,41 @@ std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegister() {
 }
 
 void TaskScheduler::removeErroringTask(uint64_t scheduledTaskID) {
-    lock_t lck{mtx};
-    for (auto it = taskQueue.begin(); it != taskQueue.end(); ++it) {
+    auto& taskQueue = *taskQueues[scheduledTaskID % taskQueues.size()];
+    lock_t lck{taskQueue.mtx};
+    for (auto it = taskQueue.tasks.begin(); it != taskQueue.tasks.end(); ++it) {
         if (scheduledTaskID == (*it)->ID) {
-            taskQueue.erase(it);
+            taskQueue.tasks.erase(it);
             return;
         }
     }
 }
 
-void TaskScheduler::runWorkerThread() {
+void TaskScheduler::runWorkerThread(uint64_t workerIdx) {
     std::unique_lock<std::mutex> lck{mtx, std::defer_lock};
+    uint64_t observedQueueVersion = 0;
     while (true) {
         lck.lock();
-        cv.wait(lck, [&] { return !taskQueue.empty() || stopThreads; });
+        cv.wait(lck, [&] { return observedQueueVersion != queueVersion || stopThreads; });
         if (stopThreads) {
             return;
         }
-        auto scheduledTask = getTaskAndRegister();
+        observedQueueVersion = queueVersion;
         lck.unlock();
-        if (!scheduledTask) {
-            continue;
-        }
-        try {
-            scheduledTask->task->run();
-            scheduledTask->task->deRegisterThreadAndFinalizeTask();
-        } catch (std::exception& e) {
-            scheduledTask->task->setException(std::current_exception());
-            scheduledTask->task->deRegisterThreadAndFinalizeTask();
-            continue;
+        // Keep working as long as there are tasks to register to, and only go back to sleep once a
+        // full pass over the queues finds nothing.
+        while (true) {
+            auto scheduledTask = getTaskAndRegister(workerIdx);
+            if (!scheduledTask) {
+                break;
+            }
+            try {
+                scheduledTask->task->run();
+                scheduledTask->task->deRegisterThreadAndFinalizeTask();
+            } catch (std::exception& e) {
+                scheduledTask->task->setException(std::current_exception());
+                scheduledTask->task->deRegisterThreadAndFinalizeTask();
+            }
         }
     }
 }
@@ -79,6 +79,7 @@ void ValueVector::copyFromRowData(uint32_t pos, const uint8_t* rowData) {
     } break;
     case PhysicalTypeID::STRING: {
         StringVector::addString(this, pos, *(ku_string_t*)rowData);
+        StringVector::clearDictionaryCodes(this);
     } break;
     default: {
         auto dataTypeSize = LogicalTypeUtils::getRowLayoutSize(dataType);
@@ -118,6 +119,7 @@ void ValueVector::copyFromVectorData(
     } break;
     case PhysicalTypeID::STRING: {
         StringVector::addString(this, *(ku_string_t*)dstData, *(ku_string_t*)srcVectorData);
+        StringVector::clearDictionaryCodes(this);
     } break;
     default: {
         memcpy(dstData, srcVectorData, srcVector->getNumBytesPerValue());
@@ -184,6 +186,7 @@ void ValueVector::copyFromValue(uint64_t pos, const Value& value) {
     case PhysicalTypeID::STRING: {
         StringVector::addString(
             this, *(ku_string_t*)dstValue, value.strVal.data(), value.strVal.length());
+        StringVector::clearDictionaryCodes(this);
     } break;
     case PhysicalTypeID::LIST: {
         auto listEntry = reinterpret_cast<list_entry_t*>(dstValue);
@@ -290,8 +293,10 @@ std::unique_ptr<Value> ValueVector::getAsValue(uint64_t pos) const {
 void ValueVector::resetAuxiliaryBuffer() {
     switch (dataType.getPhysicalType()) {
     case PhysicalTypeID::STRING: {
-        ku_dynamic_cast<AuxiliaryBuffer*, StringAuxiliaryBuffer*>(auxiliaryBuffer.get())
-            ->resetOverflowBuffer();
+        auto stringAuxiliaryBuffer =
+            ku_dynamic_cast<AuxiliaryBuffer*, StringAuxiliaryBuffer*>(auxiliaryBuffer.get());
+        stringAuxiliaryBuffer->resetOverflowBuffer();
+        stringAuxiliaryBuffer->setNumDictionaryCodes(0);
         return;
     }
     case PhysicalTypeID::LIST: {
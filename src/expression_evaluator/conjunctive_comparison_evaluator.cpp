@@ -0,0 +1,274 @@
+#include "expression_evaluator/conjunctive_comparison_evaluator.h"
+
+#include "common/exception/not_implemented.h"
+#include "function/comparison/comparison_functions.h"
+#include "function/primitive_kernels.h"
+
+using namespace kuzu::common;
+using namespace kuzu::function;
+using namespace kuzu::processor;
+using namespace kuzu::storage;
+using namespace kuzu::main;
+
+namespace kuzu {
+namespace evaluator {
+
+template<typename T>
+static inline T getConstantValue(const ValueVector& constant) {
+    return ((T*)constant.getData())[constant.state->selVector->selectedPositions[0]];
+}
+
+// inPositions is nullptr if the input positions are [0, numPositions).
+template<typename T, typename OP>
+static sel_t selectComparison(const ValueVector& vector, const ValueVector& constant,
+    const sel_t* inPositions, sel_t numPositions, sel_t* outPositions) {
+    auto values = (T*)vector.getData();
+    auto constantValue = getConstantValue<T>(constant);
+    if (inPositions == nullptr && vector.hasNoNullsGuarantee()) {
+        return PrimitiveKernels::select(numPositions, outPositions,
+            [&](uint64_t startPos, uint64_t numValuesInBlock, uint8_t* results) {
+                for (auto i = 0u; i < numValuesInBlock; ++i) {
+                    OP::operation(
+                        values[startPos + i], constantValue, results[i], nullptr, nullptr);
+                }
+            });
+    }
+    if (inPositions == nullptr) {
+        inPositions = SelectionVector::INCREMENTAL_SELECTED_POS;
+    }
+    sel_t numSelectedValues = 0;
+    uint8_t result = 0;
+    if (vector.hasNoNullsGuarantee()) {
+        for (auto i = 0u; i < numPositions; ++i) {
+            auto pos = inPositions[i];
+            OP::operation(values[pos], constantValue, result, nullptr, nullptr);
+            outPositions[numSelectedValues] = pos;
+            numSelectedValues += result;
+        }
+    } else {
+        for (auto i = 0u; i < numPositions; ++i) {
+            auto pos = inPositions[i];
+            OP::operation(values[pos], constantValue, result, nullptr, nullptr);
+            outPositions[numSelectedValues] = pos;
+            numSelectedValues += result && !vector.isNull(pos);
+        }
+    }
+    return numSelectedValues;
+}
+
+// A false comparison makes the conjunction false. A null comparison makes it null unless it is
+// already false.
+template<typename T, typename OP>
+static inline void evaluateOnValue(const ValueVector& vector, T constantValue, ValueVector& result,
+    uint32_t pos, uint32_t resultPos) {
+    auto results = (bool*)result.getData();
+    if (vector.isNull(pos)) {
+        if (results[resultPos]) {
+            result.setNull(resultPos, true);
+        }
+        return;
+    }
+    uint8_t value = 0;
+    OP::operation(((T*)vector.getData())[pos], constantValue, value, nullptr, nullptr);
+    if (!value) {
+        results[resultPos] = false;
+        result.setNull(resultPos, false);
+    }
+}
+
+template<typename T, typename OP>
+static void evaluateComparison(
+    const ValueVector& vector, const ValueVector& constant, ValueVector& result) {
+    auto constantValue = getConstantValue<T>(constant);
+    if (vector.state->isFlat()) {
+        evaluateOnValue<T, OP>(vector, constantValue, result,
+            vector.state->selVector->selectedPositions[0],
+            result.state->selVector->selectedPositions[0]);
+        return;
+    }
+    auto& selVector = *vector.state->selVector;
+    for (auto i = 0u; i < selVector.selectedSize; ++i) {
+        auto pos = selVector.selectedPositions[i];
+        evaluateOnValue<T, OP>(vector, constantValue, result, pos, pos);
+    }
+}
+
+template<typename T, typename OP>
+static void getComparisonFuncs(ConjunctiveComparisonEvaluator::select_func_t& selectFunc,
+    ConjunctiveComparisonEvaluator::evaluate_func_t& evaluateFunc) {
+    selectFunc = selectComparison<T, OP>;
+    evaluateFunc = evaluateComparison<T, OP>;
+}
+
+template<typename T>
+static void getComparisonFuncs(ExpressionType comparisonType,
+    ConjunctiveComparisonEvaluator::select_func_t& selectFunc,
+    ConjunctiveComparisonEvaluator::evaluate_func_t& evaluateFunc) {
+    switch (comparisonType) {
+    case ExpressionType::EQUALS: {
+        getComparisonFuncs<T, Equals>(selectFunc, evaluateFunc);
+    } break;
+    case ExpressionType::NOT_EQUALS: {
+        getComparisonFuncs<T, NotEquals>(selectFunc, evaluateFunc);
+    } break;
+    case ExpressionType::GREATER_THAN: {
+        getComparisonFuncs<T, GreaterThan>(selectFunc, evaluateFunc);
+    } break;
+    case ExpressionType::GREATER_THAN_EQUALS: {
+        getComparisonFuncs<T, GreaterThanEquals>(selectFunc, evaluateFunc);
+    } break;
+    case ExpressionType::LESS_THAN: {
+        getComparisonFuncs<T, LessThan>(selectFunc, evaluateFunc);
+    } break;
+    case ExpressionType::LESS_THAN_EQUALS: {
+        getComparisonFuncs<T, LessThanEquals>(selectFunc, evaluateFunc);
+    } break;
+    default:
+        // LCOV_EXCL_START
+        throw NotImplementedException("ConjunctiveComparisonEvaluator::getComparisonFuncs");
+        // LCOV_EXCL_STOP
+    }
+}
+
+static void getComparisonFuncs(PhysicalTypeID physicalType, ExpressionType comparisonType,
+    ConjunctiveComparisonEvaluator::select_func_t& selectFunc,
+    ConjunctiveComparisonEvaluator::evaluate_func_t& evaluateFunc) {
+    switch (physicalType) {
+    case PhysicalTypeID::INT64: {
+        getComparisonFuncs<int64_t>(comparisonType, selectFunc, evaluateFunc);
+    } break;
+    case PhysicalTypeID::INT32: {
+        getComparisonFuncs<int32_t>(comparisonType, selectFunc, evaluateFunc);
+    } break;
+    case PhysicalTypeID::INT16: {
+        getComparisonFuncs<int16_t>(comparisonType, selectFunc, evaluateFunc);
+    } break;
+    case PhysicalTypeID::INT8: {
+        getComparisonFuncs<int8_t>(comparisonType, selectFunc, evaluateFunc);
+    } break;
+    case PhysicalTypeID::UINT64: {
+        getComparisonFuncs<uint64_t>(comparisonType, selectFunc, evaluateFunc);
+    } break;
+    case PhysicalTypeID::UINT32: {
+        getComparisonFuncs<uint32_t>(comparisonType, selectFunc, evaluateFunc);
+    } break;
+    case PhysicalTypeID::UINT16: {
+        getComparisonFuncs<uint16_t>(comparisonType, selectFunc, evaluateFunc);
+    } break;
+    case PhysicalTypeID::UINT8: {
+        getComparisonFuncs<uint8_t>(comparisonType, selectFunc, evaluateFunc);
+    } break;
+    case PhysicalTypeID::DOUBLE: {
+        getComparisonFuncs<double>(comparisonType, selectFunc, evaluateFunc);
+    } break;
+    case PhysicalTypeID::FLOAT: {
+        getComparisonFuncs<float>(comparisonType, selectFunc, evaluateFunc);
+    } break;
+    default:
+        // LCOV_EXCL_START
+        throw NotImplementedException("ConjunctiveComparisonEvaluator::getComparisonFuncs");
+        // LCOV_EXCL_STOP
+    }
+}
+
+bool ConjunctiveComparisonEvaluator::isTypeSupported(const LogicalType& dataType) {
+    switch (dataType.getPhysicalType()) {
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT8:
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT8:
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::FLOAT:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void ConjunctiveComparisonEvaluator::init(
+    const ResultSet& resultSet, MemoryManager* memoryManager) {
+    ExpressionEvaluator::init(resultSet, memoryManager);
+    selectFuncs.resize(comparisonTypes.size());
+    evaluateFuncs.resize(comparisonTypes.size());
+    for (auto i = 0u; i < comparisonTypes.size(); ++i) {
+        getComparisonFuncs(getVector(i).dataType.getPhysicalType(), comparisonTypes[i],
+            selectFuncs[i], evaluateFuncs[i]);
+    }
+}
+
+void ConjunctiveComparisonEvaluator::evaluate(ClientContext* clientContext) {
+    for (auto& child : children) {
+        child->evaluate(clientContext);
+    }
+    auto& selVector = *resultVector->state->selVector;
+    auto results = (bool*)resultVector->getData();
+    for (auto i = 0u; i < selVector.selectedSize; ++i) {
+        auto pos = selVector.selectedPositions[i];
+        results[pos] = true;
+        resultVector->setNull(pos, false);
+    }
+    for (auto i = 0u; i < comparisonTypes.size(); ++i) {
+        evaluateFuncs[i](getVector(i), getConstant(i), *resultVector);
+    }
+}
+
+bool ConjunctiveComparisonEvaluator::select(
+    SelectionVector& selVector, ClientContext* clientContext) {
+    for (auto& child : children) {
+        child->evaluate(clientContext);
+    }
+    auto& inputSelVector = *getVector(0).state->selVector;
+    if (getVector(0).state->isFlat()) {
+        // Same as selecting on flat vectors with function evaluators, the selection vector is not
+        // changed and only the result is returned.
+        auto pos = inputSelVector.selectedPositions[0];
+        sel_t numSelectedValues = 1;
+        for (auto i = 0u; i < comparisonTypes.size() && numSelectedValues > 0; ++i) {
+            numSelectedValues =
+                selectFuncs[i](getVector(i), getConstant(i), &pos, numSelectedValues, &pos);
+        }
+        return numSelectedValues > 0;
+    }
+    // The first comparison reads the input positions and the following ones narrow down the
+    // positions selected so far in place.
+    auto selectedPositions =
+        inputSelVector.isUnfiltered() ? nullptr : inputSelVector.selectedPositions;
+    sel_t numSelectedValues = inputSelVector.selectedSize;
+    auto selectedPosBuffer = selVector.getMultableBuffer();
+    for (auto i = 0u; i < comparisonTypes.size() && numSelectedValues > 0; ++i) {
+        numSelectedValues = selectFuncs[i](getVector(i), getConstant(i), selectedPositions,
+            numSelectedValues, selectedPosBuffer);
+        selectedPositions = selectedPosBuffer;
+    }
+    selVector.selectedSize = numSelectedValues;
+    return numSelectedValues > 0;
+}
+
+std::unique_ptr<ExpressionEvaluator> ConjunctiveComparisonEvaluator::clone() {
+    std::vector<std::unique_ptr<ExpressionEvaluator>> clonedChildren;
+    clonedChildren.reserve(children.size());
+    for (auto& child : children) {
+        clonedChildren.push_back(child->clone());
+    }
+    return std::make_unique<ConjunctiveComparisonEvaluator>(
+        comparisonTypes, std::move(clonedChildren));
+}
+
+void ConjunctiveComparisonEvaluator::resolveResultVector(
+    const ResultSet& /*resultSet*/, MemoryManager* memoryManager) {
+    resultVector =
+        std::make_shared<ValueVector>(LogicalType{LogicalTypeID::BOOL}, memoryManager);
+    std::vector<ExpressionEvaluator*> inputEvaluators;
+    inputEvaluators.reserve(comparisonTypes.size());
+    for (auto i = 0u; i < comparisonTypes.size(); ++i) {
+        inputEvaluators.push_back(children[2 * i].get());
+    }
+    resolveResultStateFromChildren(inputEvaluators);
+}
+
+} // namespace evaluator
+} // namespace kuzu
@@ -0,0 +1,80 @@
+#include "function/table/call_functions.h"
+#include "processor/admission_controller.h"
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+using namespace kuzu::processor;
+
+namespace kuzu {
+namespace function {
+
+struct AdmissionInfoBindData final : public CallTableFuncBindData {
+    AdmissionController* admissionController;
+
+    AdmissionInfoBindData(AdmissionController* admissionController,
+        std::vector<LogicalType> returnTypes, std::vector<std::string> returnColumnNames,
+        offset_t maxOffset)
+        : CallTableFuncBindData{std::move(returnTypes), std::move(returnColumnNames), maxOffset},
+          admissionController{admissionController} {}
+
+    inline std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<AdmissionInfoBindData>(admissionController, columnTypes,
+            columnNames, maxOffset);
+    }
+};
+
+static common::offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto& dataChunk = output.dataChunk;
+    auto sharedState =
+        ku_dynamic_cast<TableFuncSharedState*, CallFuncSharedState*>(input.sharedState);
+    if (!sharedState->getMorsel().hasMoreToOutput()) {
+        return 0;
+    }
+    // The statistics are collected at execution time, after the query calling this function has
+    // been admitted, so it is counted as a running query.
+    auto stats = ku_dynamic_cast<TableFuncBindData*, AdmissionInfoBindData*>(input.bindData)
+                     ->admissionController->getStats();
+    auto pos = dataChunk.state->selVector->selectedPositions[0];
+    auto avgWaitTimeInMS =
+        stats.numWaitedQueries == 0 ? 0 : stats.totalWaitTimeInMS / stats.numWaitedQueries;
+    dataChunk.getValueVector(0)->setValue<int64_t>(pos, stats.numThreads);
+    dataChunk.getValueVector(1)->setValue<int64_t>(pos, stats.numThreadsInUse);
+    dataChunk.getValueVector(2)->setValue<int64_t>(pos, stats.numRunningQueries);
+    dataChunk.getValueVector(3)->setValue<int64_t>(pos, stats.numQueuedQueries);
+    dataChunk.getValueVector(4)->setValue<int64_t>(pos, stats.numAdmittedQueries);
+    dataChunk.getValueVector(5)->setValue<int64_t>(pos, stats.numWaitedQueries);
+    dataChunk.getValueVector(6)->setValue<int64_t>(pos, stats.numDegradedQueries);
+    dataChunk.getValueVector(7)->setValue<double>(pos, avgWaitTimeInMS);
+    dataChunk.getValueVector(8)->setValue<double>(pos, stats.maxWaitTimeInMS);
+    for (auto i = 0u; i < dataChunk.getNumValueVectors(); i++) {
+        dataChunk.getValueVector(i)->setNull(pos, false);
+    }
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context, TableFuncBindInput*) {
+    std::vector<std::string> returnColumnNames;
+    std::vector<LogicalType> returnTypes;
+    for (auto columnName : {"num_threads", "num_threads_in_use", "num_running_queries",
+             "queue_depth", "num_admitted_queries", "num_waited_queries",
+             "num_degraded_queries"}) {
+        returnColumnNames.emplace_back(columnName);
+        returnTypes.emplace_back(*LogicalType::INT64());
+    }
+    for (auto columnName : {"avg_wait_time_ms", "max_wait_time_ms"}) {
+        returnColumnNames.emplace_back(columnName);
+        returnTypes.emplace_back(*LogicalType::DOUBLE());
+    }
+    return std::make_unique<AdmissionInfoBindData>(context->getAdmissionController(),
+        std::move(returnTypes), std::move(returnColumnNames), 1 /* one row result */);
+}
+
+function_set AdmissionInfoFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState, std::vector<LogicalTypeID>{}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
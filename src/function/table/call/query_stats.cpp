@@ -0,0 +1,77 @@
+#include "function/table/call_functions.h"
+#include "main/query_stats_log.h"
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+
+namespace kuzu {
+namespace function {
+
+struct QueryStatsBindData final : public CallTableFuncBindData {
+    std::vector<QueryStats> stats;
+
+    QueryStatsBindData(std::vector<QueryStats> stats, std::vector<LogicalType> returnTypes,
+        std::vector<std::string> returnColumnNames, offset_t maxOffset)
+        : CallTableFuncBindData{std::move(returnTypes), std::move(returnColumnNames), maxOffset},
+          stats{std::move(stats)} {}
+
+    inline std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<QueryStatsBindData>(stats, columnTypes, columnNames, maxOffset);
+    }
+};
+
+static common::offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto& dataChunk = output.dataChunk;
+    auto sharedState =
+        ku_dynamic_cast<TableFuncSharedState*, CallFuncSharedState*>(input.sharedState);
+    auto morsel = sharedState->getMorsel();
+    if (!morsel.hasMoreToOutput()) {
+        return 0;
+    }
+    auto& stats =
+        ku_dynamic_cast<TableFuncBindData*, QueryStatsBindData*>(input.bindData)->stats;
+    auto numQueriesToOutput = morsel.endOffset - morsel.startOffset;
+    for (auto i = 0u; i < numQueriesToOutput; i++) {
+        auto& queryStats = stats[morsel.startOffset + i];
+        dataChunk.getValueVector(0)->setValue(i, queryStats.query);
+        dataChunk.getValueVector(1)->setValue<int64_t>(i, queryStats.numThreads);
+        dataChunk.getValueVector(2)->setValue<double>(i, queryStats.compilingTimeInMS);
+        dataChunk.getValueVector(3)->setValue<double>(i, queryStats.executionTimeInMS);
+        dataChunk.getValueVector(4)->setValue<int64_t>(i, queryStats.numTuples);
+        dataChunk.getValueVector(5)->setValue<int64_t>(i, queryStats.numPageHits);
+        dataChunk.getValueVector(6)->setValue<int64_t>(i, queryStats.numPageMisses);
+    }
+    return numQueriesToOutput;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context, TableFuncBindInput*) {
+    std::vector<std::string> returnColumnNames;
+    std::vector<LogicalType> returnTypes;
+    returnColumnNames.emplace_back("query");
+    returnTypes.emplace_back(*LogicalType::STRING());
+    returnColumnNames.emplace_back("num_threads");
+    returnTypes.emplace_back(*LogicalType::INT64());
+    for (auto columnName : {"compiling_time_ms", "execution_time_ms"}) {
+        returnColumnNames.emplace_back(columnName);
+        returnTypes.emplace_back(*LogicalType::DOUBLE());
+    }
+    for (auto columnName : {"num_tuples", "num_page_hits", "num_page_misses"}) {
+        returnColumnNames.emplace_back(columnName);
+        returnTypes.emplace_back(*LogicalType::INT64());
+    }
+    // The statistics are taken when binding, so the query calling this function is not included.
+    auto stats = context->getQueryStatsLog()->getStats();
+    auto numQueries = stats.size();
+    return std::make_unique<QueryStatsBindData>(
+        std::move(stats), std::move(returnTypes), std::move(returnColumnNames), numQueries);
+}
+
+function_set QueryStatsFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState, std::vector<LogicalTypeID>{}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
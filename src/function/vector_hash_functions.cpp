@@ -1,5 +1,7 @@
 #include "function/hash/vector_hash_functions.h"
 
+#include <array>
+
 #include "function/binary_function_executor.h"
 
 using namespace kuzu::common;
@@ -75,6 +77,28 @@ static void computeStructVecHash(ValueVector* operand, ValueVector* result) {
     }
 }
 
+// Hashes each distinct string of a dictionary-encoded vector once.
+static void computeDictionaryStringVecHash(ValueVector* operand, ValueVector* result) {
+    auto codes = StringVector::getDictionaryCodes(operand);
+    auto resultValues = (hash_t*)result->getData();
+    std::array<hash_t, DEFAULT_VECTOR_CAPACITY> hashPerCode;
+    std::array<bool, DEFAULT_VECTOR_CAPACITY> isHashed{};
+    auto& selVector = operand->state->selVector;
+    for (auto i = 0u; i < selVector->selectedSize; i++) {
+        auto pos = selVector->selectedPositions[i];
+        if (operand->isNull(pos)) {
+            resultValues[pos] = NULL_HASH;
+            continue;
+        }
+        auto code = codes[pos];
+        if (!isHashed[code]) {
+            Hash::operation(operand->getValue<ku_string_t>(pos), hashPerCode[code], operand);
+            isHashed[code] = true;
+        }
+        resultValues[pos] = hashPerCode[code];
+    }
+}
+
 void VectorHashFunction::computeHash(ValueVector* operand, ValueVector* result) {
     result->state = operand->state;
     KU_ASSERT(result->dataType.getLogicalTypeID() == LogicalTypeID::INT64);
@@ -119,7 +143,11 @@ void VectorHashFunction::computeHash(ValueVector* operand, ValueVector* result)
         UnaryHashFunctionExecutor::execute<float, hash_t>(*operand, *result);
     } break;
     case PhysicalTypeID::STRING: {
-        UnaryHashFunctionExecutor::execute<ku_string_t, hash_t>(*operand, *result);
+        if (!operand->state->isFlat() && StringVector::hasDictionaryCodes(operand)) {
+            computeDictionaryStringVecHash(operand, result);
+        } else {
+            UnaryHashFunctionExecutor::execute<ku_string_t, hash_t>(*operand, *result);
+        }
     } break;
     case PhysicalTypeID::INTERVAL: {
         UnaryHashFunctionExecutor::execute<interval_t, hash_t>(*operand, *result);
@@ -39,6 +39,11 @@ public:
         return propertyIDPerTable.at(tableID);
     }
 
+    inline const std::unordered_map<common::table_id_t, common::property_id_t>&
+    getPropertyIDPerTable() const {
+        return propertyIDPerTable;
+    }
+
     inline bool isInternalID() const { return getPropertyName() == common::InternalKeyword::ID; }
     inline bool isIRI() const { return getPropertyName() == common::rdf::IRI; }
 
@@ -92,6 +92,26 @@ struct ArrowArray {
 
 #endif // ARROW_C_DATA_INTERFACE
 
+// The Arrow C stream interface.
+// https://arrow.apache.org/docs/format/CStreamInterface.html
+
+#ifndef ARROW_C_STREAM_INTERFACE
+#define ARROW_C_STREAM_INTERFACE
+
+struct ArrowArrayStream {
+    // Callbacks providing stream functionality
+    int (*get_schema)(struct ArrowArrayStream*, struct ArrowSchema* out);
+    int (*get_next)(struct ArrowArrayStream*, struct ArrowArray* out);
+    const char* (*get_last_error)(struct ArrowArrayStream*);
+
+    // Release callback
+    void (*release)(struct ArrowArrayStream*);
+    // Opaque producer-specific data
+    void* private_data;
+};
+
+#endif // ARROW_C_STREAM_INTERFACE
+
 #ifdef __cplusplus
 }
 #endif
@@ -662,6 +682,19 @@ KUZU_C_API struct ArrowSchema kuzu_query_result_get_arrow_schema(kuzu_query_resu
 KUZU_C_API struct ArrowArray kuzu_query_result_get_next_arrow_chunk(
     kuzu_query_result* query_result, int64_t chunk_size);
 
+/**
+ * @brief Returns the remaining tuples of the query result as ArrowArrayStream.
+ * @param query_result The query result instance to return.
+ * @param chunk_size The number of tuples in each arrow array returned by the stream.
+ * @return An arrow array stream, whose get_next returns the next chunk of the query result as
+ * kuzu_query_result_get_next_arrow_chunk does, until all tuples are read.
+ *
+ * The stream reads from the query result, which must not be destroyed before the stream is
+ * released. It is the caller's responsibility to call the release function to release the stream.
+ */
+KUZU_C_API struct ArrowArrayStream kuzu_query_result_get_arrow_array_stream(
+    kuzu_query_result* query_result, int64_t chunk_size);
+
 // FlatTuple
 /**
  * @brief Destroys the given flat tuple instance.
@@ -1266,6 +1299,14 @@ KUZU_C_API double kuzu_query_summary_get_compiling_time(kuzu_query_summary* quer
  * @param query_summary The query summary to get execution time.
  */
 KUZU_C_API double kuzu_query_summary_get_execution_time(kuzu_query_summary* query_summary);
+/**
+ * @brief Returns the profiled plan of the given query summary as json, with the time, page
+ * accesses and memory used by each operator. The string is empty if the query is not executed
+ * with PROFILE. The caller is responsible for freeing the returned string with
+ * kuzu_destroy_string.
+ * @param query_summary The query summary to get the profiled plan.
+ */
+KUZU_C_API char* kuzu_query_summary_get_profile_json(kuzu_query_summary* query_summary);
 
 // TODO: Bind utility functions for kuzu_date_t, kuzu_timestamp_t, and kuzu_interval_t
 
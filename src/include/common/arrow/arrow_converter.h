@@ -26,6 +26,9 @@ public:
         const std::vector<std::unique_ptr<main::DataTypeInfo>>& typesInfo);
     static void toArrowArray(
         main::QueryResult& queryResult, ArrowArray* out_array, std::int64_t chunkSize);
+    // The stream reads the remaining tuples of the query result in chunks of chunkSize tuples.
+    static void toArrowArrayStream(
+        main::QueryResult& queryResult, ArrowArrayStream* outStream, std::int64_t chunkSize);
 
     static common::LogicalType fromArrowSchema(const ArrowSchema* schema);
     static void fromArrowArray(const ArrowSchema* schema, const ArrowArray* array,
@@ -69,6 +69,16 @@ private:
         ArrowVector* vector, const main::DataTypeInfo& typeInfo, Value* value, std::int64_t pos);
     static void copyNullValue(ArrowVector* vector, Value* value, std::int64_t pos);
 
+    // Appends the next tuples of a query result whose table has no unflat columns. Each column is
+    // copied directly from the row layout of the table instead of going through FlatTuples.
+    std::int64_t appendFromTable(main::QueryResult& queryResult, std::int64_t chunkSize);
+    // Copies a value in the row layout of a factorized table. Values of nested types are read
+    // into the given value first.
+    static void copyNonNullValueBuffer(ArrowVector* vector, const main::DataTypeInfo& typeInfo,
+        const uint8_t* valueBuffer, uint32_t numBytesPerValue, Value* value, std::int64_t pos);
+    static void copyString(
+        ArrowVector* vector, const uint8_t* data, std::uint32_t length, std::int64_t pos);
+
     template<LogicalTypeID DT>
     static void templateInitializeVector(
         ArrowVector* vector, const main::DataTypeInfo& typeInfo, std::int64_t capacity);
@@ -71,6 +71,16 @@ struct BufferPoolConstants {
     // `removeNonEvictableCandidates` to remove candidates that are not evictable. See
     // `EvictionQueue::removeNonEvictableCandidates()` for more details.
     static constexpr uint64_t EVICTION_QUEUE_PURGING_INTERVAL = 1024;
+    // Under the 2Q eviction policy, pages in the probationary queue are evicted first as long as
+    // they take more than TWO_QUEUE_PROBATIONARY_RATIO of the buffer pool. Evicted probationary
+    // pages are remembered in a ghost queue holding up to TWO_QUEUE_GHOST_RATIO of the number of
+    // 4KB frames in the buffer pool. See `TwoQueueReplacementPolicy` for more details.
+    static constexpr double TWO_QUEUE_PROBATIONARY_RATIO = 0.25;
+    static constexpr double TWO_QUEUE_GHOST_RATIO = 0.5;
+    // Number of background I/O threads serving read-ahead requests of sequential scans, and the max
+    // number of read-ahead requests that can be queued up before new ones are dropped.
+    static constexpr uint64_t NUM_PREFETCH_THREADS = 2;
+    static constexpr uint64_t MAX_NUM_PENDING_PREFETCH_REQUESTS = 256;
 // The default max size for a VMRegion.
 #ifdef __32BIT__
     static constexpr uint64_t DEFAULT_VM_REGION_MAX_SIZE = (uint64_t)1 << 30; // (1GB)
@@ -101,6 +111,8 @@ struct StorageConstants {
     static constexpr uint64_t PAGE_GROUP_SIZE_LOG2 = 10;
     static constexpr uint64_t PAGE_GROUP_SIZE = (uint64_t)1 << PAGE_GROUP_SIZE_LOG2;
     static constexpr uint64_t PAGE_IDX_IN_GROUP_MASK = ((uint64_t)1 << PAGE_GROUP_SIZE_LOG2) - 1;
+    // Sequential column scans read ahead the pages of a column chunk in windows of this many pages.
+    static constexpr uint64_t READ_AHEAD_NUM_PAGES = 32;
 
     static constexpr uint64_t NODE_GROUP_SIZE_LOG2 = 17; // 64 * 2048 nodes per group
     static constexpr uint64_t NODE_GROUP_SIZE = (uint64_t)1 << NODE_GROUP_SIZE_LOG2;
@@ -171,6 +183,28 @@ struct PlannerKnobs {
     // Avoid doing probe to build SIP if we have to accumulate a probe side that is much bigger than
     // build side. Also avoid doing build to probe SIP if probe side is not much bigger than build.
     static constexpr uint64_t SIP_RATIO = 5;
+    // Multi-source BFS computes shortest paths from batches of consecutive node offsets at once.
+    // It is used if there are enough sources, and enough of the nodes of the bound node table are
+    // sources, so that most batches contain several sources.
+    static constexpr uint64_t MULTI_SOURCE_BFS_MIN_NUM_SOURCES = 64;
+    static constexpr double MULTI_SOURCE_BFS_MIN_SOURCE_RATIO = 0.1;
+};
+
+struct HashJoinConstants {
+    // A build side that doesn't fit in memory is spilled to disk in partitions, split by the top
+    // bits of the key hashes, and joined one partition at a time.
+    static constexpr uint64_t NUM_PARTITIONS_LOG2 = 4;
+    static constexpr uint64_t NUM_PARTITIONS = (uint64_t)1 << NUM_PARTITIONS_LOG2;
+};
+
+struct AggregateConstants {
+    // Groups of hash aggregates are partitioned by the top bits of the key hashes, so that the
+    // partitions can be merged in parallel, and spilled to disk if they don't fit in memory.
+    static constexpr uint64_t NUM_PARTITIONS_LOG2 = 4;
+    static constexpr uint64_t NUM_PARTITIONS = (uint64_t)1 << NUM_PARTITIONS_LOG2;
+    // Below this number of groups, merging the hash tables of all threads into one is cheaper than
+    // allocating a hash table for each partition.
+    static constexpr uint64_t MIN_NUM_ENTRIES_TO_PARTITION = 1 << 16;
 };
 
 struct OrderByConstants {
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+namespace kuzu {
+namespace common {
+
+// Replacement policy used by the buffer manager to pick pages to evict.
+enum class EvictionPolicy : uint8_t {
+    // A single FIFO queue where recently read pages are given a second chance.
+    FIFO = 0,
+    // A 2Q policy, which keeps pages that are re-referenced after being evicted in a protected
+    // queue, so that large sequential scans cannot flush frequently accessed pages.
+    TWO_QUEUE = 1,
+};
+
+} // namespace common
+} // namespace kuzu
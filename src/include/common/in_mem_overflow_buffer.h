@@ -56,6 +56,14 @@ public:
         }
     }
 
+    inline uint64_t getMemoryUsage() const {
+        uint64_t memoryUsage = 0;
+        for (auto& block : blocks) {
+            memoryUsage += block->size;
+        }
+        return memoryUsage;
+    }
+
 private:
     inline bool requireNewBlock(uint64_t sizeToAllocate) {
         if (sizeToAllocate > BufferPoolConstants::PAGE_256KB_SIZE) {
@@ -48,5 +48,66 @@ public:
     uint64_t accumulatedValue;
 };
 
+// Resources used by the calling thread. The buffer manager and the memory manager add to them, so
+// that the profiler can attribute page accesses and memory to the operators run by the thread.
+struct ThreadResourceCounters {
+    uint64_t numPageHits = 0;
+    uint64_t numPageMisses = 0;
+    uint64_t numBytesRead = 0;
+    // Bytes allocated minus bytes freed through the memory manager.
+    int64_t memoryUsage = 0;
+
+    static ThreadResourceCounters& get();
+};
+
+/**
+ * Time, page accesses and memory used by an operator on one thread, excluding those used by the
+ * operators it calls. Metrics nest like the operators: starting a metric pauses the metric that
+ * was started last on the thread, and stopping it resumes that metric.
+ */
+class ResourceMetric : public Metric {
+    struct Checkpoint {
+        std::chrono::steady_clock::time_point time;
+        ThreadResourceCounters counters;
+
+        static Checkpoint now();
+    };
+
+public:
+    explicit ResourceMetric(bool enable);
+
+    void start();
+    void stop();
+
+    double getElapsedTimeMS() const;
+
+private:
+    // Adds the resources used since the last checkpoint of this metric.
+    void accumulate(const Checkpoint& now);
+
+public:
+    double accumulatedTime;
+    uint64_t numPageHits;
+    uint64_t numPageMisses;
+    uint64_t numBytesRead;
+    int64_t memoryUsage;
+    int64_t peakMemoryUsage;
+
+private:
+    ResourceMetric* parent;
+    Checkpoint checkpoint;
+};
+
+// Stops the metric when going out of scope, so that the metric of the calling operator is resumed
+// even if an exception is thrown.
+class ResourceMetricScope {
+public:
+    explicit ResourceMetricScope(ResourceMetric& metric) : metric{metric} { metric.start(); }
+    ~ResourceMetricScope() { metric.stop(); }
+
+private:
+    ResourceMetric& metric;
+};
+
 } // namespace common
 } // namespace kuzu
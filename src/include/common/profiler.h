@@ -17,10 +17,15 @@ public:
 
     NumericMetric* registerNumericMetric(const std::string& key);
 
+    ResourceMetric* registerResourceMetric(const std::string& key);
+
     double sumAllTimeMetricsWithKey(const std::string& key);
 
     uint64_t sumAllNumericMetricsWithKey(const std::string& key);
 
+    // Returns the resource metrics registered by all threads with the key.
+    std::vector<ResourceMetric*> getResourceMetricsWithKey(const std::string& key);
+
 private:
     void addMetric(const std::string& key, std::unique_ptr<Metric> metric);
 
@@ -11,6 +11,8 @@ namespace common {
 
 using lock_t = std::unique_lock<std::mutex>;
 
+class TaskScheduler;
+
 /**
  * Task represents a task that can be executed by multiple threads in the TaskScheduler. Task is a
  * virtual class. Users of TaskScheduler need to extend the Task class and implement at
@@ -22,6 +24,9 @@ using lock_t = std::unique_lock<std::mutex>;
  * calls and if there is some state from the run() function execution that will be needed by
  * finalizeIfNecessary, users should save it somewhere that can be accessed in
  * finalizeIfNecessary(). See ProcessorTask for an example of this.
+ * Tasks whose work is split into morsels that are handed out dynamically to the registered
+ * threads can call tryYield() between two morsels, and return from run() early if it returns true.
+ * See TaskScheduler for more details.
  */
 class Task {
     friend class TaskScheduler;
@@ -53,7 +58,15 @@ public:
 
     inline void setSingleThreadedTask() { maxNumThreads = 1; }
 
-    bool registerThread();
+    // If onlyIfStarving is true, the thread is only registered if it is the first thread of the
+    // task.
+    bool registerThread(bool onlyIfStarving = false);
+
+    // Returns true if the calling thread should stop working on the task, because there are other
+    // tasks in the scheduler that no thread works on. A thread that yields must not pull any more
+    // morsels, and must not call this function again. At least one registered thread never yields,
+    // so the remaining morsels are guaranteed to be processed.
+    bool tryYield();
 
     void deRegisterThreadAndFinalizeTask();
 
@@ -93,9 +106,11 @@ public:
 protected:
     std::mutex mtx;
     std::condition_variable cv;
-    uint64_t maxNumThreads, numThreadsFinished{0}, numThreadsRegistered{0};
+    uint64_t maxNumThreads, numThreadsFinished{0}, numThreadsRegistered{0}, numThreadsYielded{0};
     std::exception_ptr exceptionsPtr = nullptr;
     uint64_t ID;
+    // The scheduler the task is pushed into.
+    TaskScheduler* scheduler = nullptr;
 };
 
 } // namespace common
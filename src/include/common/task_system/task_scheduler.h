@@ -1,4 +1,5 @@
 #pragma once
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <thread>
@@ -17,26 +18,39 @@ struct ScheduledTask {
 
 /**
  * TaskScheduler is a library that manages a set of worker threads that can execute tasks that are
- * put into a task queue. Each task accepts a maximum number of threads. Users of TaskScheduler
+ * put into task queues. Each task accepts a maximum number of threads. Users of TaskScheduler
  * schedule tasks to be executed by calling schedule functions, e.g., pushTaskIntoQueue or
- * scheduleTaskAndWaitOrError. New tasks are put at the end of the queue. Workers grab the first
- * task from the beginning of the queue that they can register themselves to work on. Any task that
- * is completed is removed automatically from the queue. If there is a task that raises an
- * exception, the worker threads catch it and store it with the tasks. The user thread that is
- * waiting on the completion of the task (or tasks) will throw the exception (the user thread could
- * be waiting on a tasks through a function that waits, e.g., scheduleTaskAndWaitOrError.
+ * scheduleTaskAndWaitOrError. If there is a task that raises an exception, the worker threads catch
+ * it and store it with the tasks. The user thread that is waiting on the completion of the task (or
+ * tasks) will throw the exception (the user thread could be waiting on a tasks through a function
+ * that waits, e.g., scheduleTaskAndWaitOrError.
  *
  * Currently there is one way the TaskScheduler can be used:
  * Schedule one task T and wait for T to finish or error if there was an exception raised by
  * one of the threads working on T that errored. This is simply done by the call:
  *      scheduleTaskAndWaitOrError(T);
  *
- * TaskScheduler guarantees that workers will register themselves to tasks in FIFO order. However
- * this does not guarantee that the tasks will be completed in FIFO order: a long running task
- * that is not accepting more registration can stay in the queue for an unlimited time until
- * completion.
+ * Each worker thread owns a task queue, and new tasks are distributed over the queues in a
+ * round-robin fashion. A worker looks for a task to register itself to in its own queue first, and
+ * steals from the queues of other workers if its own queue has nothing to offer. Within a queue,
+ * workers register themselves to tasks in FIFO order, however tasks that no worker has registered
+ * to yet (starving tasks) are always preferred over tasks that are already running. Any task that
+ * is completed is removed automatically from its queue.
+ *
+ * A task keeps the threads registered to it until the task is completed. So that a long running
+ * task cannot hold all workers while other tasks are waiting, workers of a task check
+ * Task::tryYield() between two morsels of work (see ScanNodeID) and leave the task early if there
+ * are starving tasks in the scheduler. The last worker of a task never leaves, so the task is still
+ * guaranteed to make progress.
  */
 class TaskScheduler {
+    friend class Task;
+
+    struct TaskQueue {
+        std::mutex mtx;
+        std::deque<std::shared_ptr<ScheduledTask>> tasks;
+    };
+
 public:
     explicit TaskScheduler(uint64_t numThreads);
     ~TaskScheduler();
@@ -49,21 +63,36 @@ public:
     void scheduleTaskAndWaitOrError(
         const std::shared_ptr<Task>& task, processor::ExecutionContext* context);
 
+    inline bool hasStarvingTasks() const { return numStarvingTasks.load() > 0; }
+
 private:
     std::shared_ptr<ScheduledTask> pushTaskIntoQueue(const std::shared_ptr<Task>& task);
 
     void removeErroringTask(uint64_t scheduledTaskID);
 
     // Functions to launch worker threads and for the worker threads to use to grab task from queue.
-    void runWorkerThread();
-    std::shared_ptr<ScheduledTask> getTaskAndRegister();
+    void runWorkerThread(uint64_t workerIdx);
+    std::shared_ptr<ScheduledTask> getTaskAndRegister(uint64_t workerIdx);
+    // Returns the first task in the queue that the calling worker can register to. If
+    // onlyStarvingTasks is true, tasks that already have registered workers are skipped.
+    static std::shared_ptr<ScheduledTask> getTaskAndRegister(
+        TaskQueue& taskQueue, bool onlyStarvingTasks);
+
+    // Called by a task when its first worker is registered.
+    inline void onTaskStarted() { numStarvingTasks.fetch_sub(1); }
 
 private:
-    std::deque<std::shared_ptr<ScheduledTask>> taskQueue;
+    std::vector<std::unique_ptr<TaskQueue>> taskQueues;
+    // Number of tasks in the queues that no worker has registered to yet.
+    std::atomic<uint64_t> numStarvingTasks;
     bool stopThreads;
     std::vector<std::thread> threads;
+    // Guards stopThreads and queueVersion. Idle workers wait on cv until a new task is pushed.
     std::mutex mtx;
     std::condition_variable cv;
+    // Incremented every time a task is pushed into a queue, so that workers that found no task to
+    // work on don't go to sleep if a task is pushed in the meantime.
+    uint64_t queueVersion;
     uint64_t nextScheduledTaskID;
 };
 
@@ -21,6 +21,8 @@ class Deserializer;
 struct FileInfo;
 
 using sel_t = uint16_t;
+// Code of a string in the dictionary of a vector. Codes are at most DEFAULT_VECTOR_CAPACITY.
+using dictionary_code_t = uint16_t;
 using hash_t = uint64_t;
 using page_idx_t = uint32_t;
 using frame_idx_t = page_idx_t;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "common/in_mem_overflow_buffer.h"
+#include "common/types/types.h"
 
 namespace arrow {
 class ChunkedArray;
@@ -19,7 +20,8 @@ public:
 
 class StringAuxiliaryBuffer : public AuxiliaryBuffer {
 public:
-    explicit StringAuxiliaryBuffer(storage::MemoryManager* memoryManager) {
+    explicit StringAuxiliaryBuffer(storage::MemoryManager* memoryManager)
+        : numDictionaryCodes{0} {
         inMemOverflowBuffer = std::make_unique<InMemOverflowBuffer>(memoryManager);
     }
 
@@ -29,8 +31,24 @@ public:
     }
     inline void resetOverflowBuffer() const { inMemOverflowBuffer->resetBuffer(); }
 
+    inline bool hasDictionaryCodes() const { return numDictionaryCodes > 0; }
+    inline uint32_t getNumDictionaryCodes() const { return numDictionaryCodes; }
+    inline const dictionary_code_t* getDictionaryCodes() const { return dictionaryCodes.get(); }
+    inline dictionary_code_t* getDictionaryCodesToWrite() {
+        if (dictionaryCodes == nullptr) {
+            dictionaryCodes = std::make_unique<dictionary_code_t[]>(DEFAULT_VECTOR_CAPACITY);
+        }
+        return dictionaryCodes.get();
+    }
+    inline void setNumDictionaryCodes(uint32_t numCodes) { numDictionaryCodes = numCodes; }
+
 private:
     std::unique_ptr<InMemOverflowBuffer> inMemOverflowBuffer;
+    // Codes of the strings in the dictionary they were scanned from. Strings at two positions with
+    // the same code are equal, and codes are dense in [0, numDictionaryCodes). Codes of null
+    // positions are undefined. Zero codes means that the vector isn't dictionary encoded.
+    std::unique_ptr<dictionary_code_t[]> dictionaryCodes;
+    uint32_t numDictionaryCodes;
 };
 
 class StructAuxiliaryBuffer : public AuxiliaryBuffer {
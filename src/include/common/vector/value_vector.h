@@ -135,6 +135,36 @@ public:
         kuzu::common::ValueVector* vector, ku_string_t& dstStr, const std::string& srcStr);
     static void copyToRowData(const ValueVector* vector, uint32_t pos, uint8_t* rowData,
         InMemOverflowBuffer* rowOverflowBuffer);
+
+    // Scans of dictionary-encoded columns also output the dictionary codes of the strings, so that
+    // hashing and comparisons can be done once per distinct string. Codes are cleared when the
+    // auxiliary buffer is reset or a value is copied into the vector. Other writers that change
+    // strings in place must clear them.
+    static inline bool hasDictionaryCodes(const ValueVector* vector) {
+        return getStringAuxiliaryBuffer(vector)->hasDictionaryCodes();
+    }
+    static inline uint32_t getNumDictionaryCodes(const ValueVector* vector) {
+        return getStringAuxiliaryBuffer(vector)->getNumDictionaryCodes();
+    }
+    static inline const dictionary_code_t* getDictionaryCodes(const ValueVector* vector) {
+        return getStringAuxiliaryBuffer(vector)->getDictionaryCodes();
+    }
+    static inline dictionary_code_t* getDictionaryCodesToWrite(ValueVector* vector) {
+        return getStringAuxiliaryBuffer(vector)->getDictionaryCodesToWrite();
+    }
+    static inline void setNumDictionaryCodes(ValueVector* vector, uint32_t numCodes) {
+        getStringAuxiliaryBuffer(vector)->setNumDictionaryCodes(numCodes);
+    }
+    static inline void clearDictionaryCodes(ValueVector* vector) {
+        setNumDictionaryCodes(vector, 0);
+    }
+
+private:
+    static inline StringAuxiliaryBuffer* getStringAuxiliaryBuffer(const ValueVector* vector) {
+        KU_ASSERT(vector->dataType.getPhysicalType() == PhysicalTypeID::STRING);
+        return ku_dynamic_cast<AuxiliaryBuffer*, StringAuxiliaryBuffer*>(
+            vector->auxiliaryBuffer.get());
+    }
 };
 
 struct KUZU_API BlobVector {
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "common/enums/expression_type.h"
+#include "expression_evaluator.h"
+
+namespace kuzu {
+namespace main {
+class ClientContext;
+}
+
+namespace evaluator {
+
+// Evaluates a conjunction of comparisons between a vector and a constant of the same primitive
+// type, e.g. a.age > 20 AND a.age < 40 AND a.gender = 1. Each comparison is run by a kernel
+// specialized for its type and operator when the evaluator is initialized, so no function
+// evaluator tree is walked per vector. Selecting narrows the selection vector comparison by
+// comparison, so later comparisons only look at the positions that passed the earlier ones.
+//
+// Children are stored in pairs of (vector, constant). All vectors must be in the same data chunk.
+class ConjunctiveComparisonEvaluator : public ExpressionEvaluator {
+public:
+    using select_func_t = common::sel_t (*)(const common::ValueVector& vector,
+        const common::ValueVector& constant, const common::sel_t* inPositions,
+        common::sel_t numPositions, common::sel_t* outPositions);
+    using evaluate_func_t = void (*)(const common::ValueVector& vector,
+        const common::ValueVector& constant, common::ValueVector& result);
+
+    ConjunctiveComparisonEvaluator(std::vector<common::ExpressionType> comparisonTypes,
+        std::vector<std::unique_ptr<ExpressionEvaluator>> children)
+        : ExpressionEvaluator{std::move(children)}, comparisonTypes{std::move(comparisonTypes)} {}
+
+    // Returns true if a comparison on the given logical type can be evaluated by this evaluator.
+    static bool isTypeSupported(const common::LogicalType& dataType);
+
+    void init(
+        const processor::ResultSet& resultSet, storage::MemoryManager* memoryManager) override;
+
+    void evaluate(main::ClientContext* clientContext) override;
+
+    bool select(common::SelectionVector& selVector, main::ClientContext* clientContext) override;
+
+    std::unique_ptr<ExpressionEvaluator> clone() override;
+
+protected:
+    void resolveResultVector(
+        const processor::ResultSet& resultSet, storage::MemoryManager* memoryManager) override;
+
+private:
+    inline common::ValueVector& getVector(uint32_t idx) const {
+        return *children[2 * idx]->resultVector;
+    }
+    inline common::ValueVector& getConstant(uint32_t idx) const {
+        return *children[2 * idx + 1]->resultVector;
+    }
+
+private:
+    std::vector<common::ExpressionType> comparisonTypes;
+    std::vector<select_func_t> selectFuncs;
+    std::vector<evaluate_func_t> evaluateFuncs;
+};
+
+} // namespace evaluator
+} // namespace kuzu
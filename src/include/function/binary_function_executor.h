@@ -1,6 +1,7 @@
 #pragma once
 
 #include "common/vector/value_vector.h"
+#include "function/primitive_kernels.h"
 
 namespace kuzu {
 namespace function {
@@ -77,6 +78,25 @@ struct BinaryFunctionExecutor {
             resPos, dataPtr);
     }
 
+    // Executes on the first numValues positions of unfiltered vectors without nulls. A flat operand
+    // is read once at its selected position. See PrimitiveKernels.
+    template<typename LEFT_TYPE, typename RIGHT_TYPE, typename RESULT_TYPE, typename FUNC,
+        typename OP_WRAPPER, bool IS_LEFT_FLAT, bool IS_RIGHT_FLAT>
+    static void executeOnArrays(common::ValueVector& left, common::ValueVector& right,
+        common::ValueVector& result, uint64_t numValues, void* dataPtr) {
+        auto leftValues = (LEFT_TYPE*)left.getData();
+        auto rightValues = (RIGHT_TYPE*)right.getData();
+        auto resultValues = (RESULT_TYPE*)result.getData();
+        auto leftValue = leftValues[left.state->selVector->selectedPositions[0]];
+        auto rightValue = rightValues[right.state->selVector->selectedPositions[0]];
+        for (auto i = 0u; i < numValues; ++i) {
+            OP_WRAPPER::template operation<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC>(
+                IS_LEFT_FLAT ? leftValue : leftValues[i],
+                IS_RIGHT_FLAT ? rightValue : rightValues[i], resultValues[i], &left, &right,
+                &result, i, dataPtr);
+        }
+    }
+
     template<typename LEFT_TYPE, typename RIGHT_TYPE, typename RESULT_TYPE, typename FUNC,
         typename OP_WRAPPER>
     static void executeBothFlat(common::ValueVector& left, common::ValueVector& right,
@@ -100,9 +120,14 @@ struct BinaryFunctionExecutor {
             result.setAllNull();
         } else if (right.hasNoNullsGuarantee()) {
             if (right.state->selVector->isUnfiltered()) {
-                for (auto i = 0u; i < right.state->selVector->selectedSize; ++i) {
-                    executeOnValue<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC, OP_WRAPPER>(
-                        left, right, result, lPos, i, i, dataPtr);
+                if constexpr (PrimitiveKernels::isPrimitive<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE>()) {
+                    executeOnArrays<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC, OP_WRAPPER, true,
+                        false>(left, right, result, right.state->selVector->selectedSize, dataPtr);
+                } else {
+                    for (auto i = 0u; i < right.state->selVector->selectedSize; ++i) {
+                        executeOnValue<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC, OP_WRAPPER>(
+                            left, right, result, lPos, i, i, dataPtr);
+                    }
                 }
             } else {
                 for (auto i = 0u; i < right.state->selVector->selectedSize; ++i) {
@@ -142,9 +167,14 @@ struct BinaryFunctionExecutor {
             result.setAllNull();
         } else if (left.hasNoNullsGuarantee()) {
             if (left.state->selVector->isUnfiltered()) {
-                for (auto i = 0u; i < left.state->selVector->selectedSize; ++i) {
-                    executeOnValue<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC, OP_WRAPPER>(
-                        left, right, result, i, rPos, i, dataPtr);
+                if constexpr (PrimitiveKernels::isPrimitive<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE>()) {
+                    executeOnArrays<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC, OP_WRAPPER, false,
+                        true>(left, right, result, left.state->selVector->selectedSize, dataPtr);
+                } else {
+                    for (auto i = 0u; i < left.state->selVector->selectedSize; ++i) {
+                        executeOnValue<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC, OP_WRAPPER>(
+                            left, right, result, i, rPos, i, dataPtr);
+                    }
                 }
             } else {
                 for (auto i = 0u; i < left.state->selVector->selectedSize; ++i) {
@@ -182,9 +212,14 @@ struct BinaryFunctionExecutor {
         KU_ASSERT(left.state == right.state);
         if (left.hasNoNullsGuarantee() && right.hasNoNullsGuarantee()) {
             if (result.state->selVector->isUnfiltered()) {
-                for (uint64_t i = 0; i < result.state->selVector->selectedSize; i++) {
-                    executeOnValue<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC, OP_WRAPPER>(
-                        left, right, result, i, i, i, dataPtr);
+                if constexpr (PrimitiveKernels::isPrimitive<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE>()) {
+                    executeOnArrays<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC, OP_WRAPPER, false,
+                        false>(left, right, result, result.state->selVector->selectedSize, dataPtr);
+                } else {
+                    for (uint64_t i = 0; i < result.state->selVector->selectedSize; i++) {
+                        executeOnValue<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC, OP_WRAPPER>(
+                            left, right, result, i, i, i, dataPtr);
+                    }
                 }
             } else {
                 for (uint64_t i = 0; i < result.state->selVector->selectedSize; i++) {
@@ -307,6 +342,27 @@ struct BinaryFunctionExecutor {
         numSelectedValues += (resultValue == true);
     }
 
+    // Selects from the first numValues positions of unfiltered vectors without nulls. A flat
+    // operand is read once at its selected position. See PrimitiveKernels.
+    template<class LEFT_TYPE, class RIGHT_TYPE, class FUNC, typename SELECT_WRAPPER,
+        bool IS_LEFT_FLAT, bool IS_RIGHT_FLAT>
+    static uint64_t selectOnArrays(common::ValueVector& left, common::ValueVector& right,
+        uint64_t numValues, common::sel_t* selectedPositionsBuffer) {
+        auto leftValues = (LEFT_TYPE*)left.getData();
+        auto rightValues = (RIGHT_TYPE*)right.getData();
+        auto leftValue = leftValues[left.state->selVector->selectedPositions[0]];
+        auto rightValue = rightValues[right.state->selVector->selectedPositions[0]];
+        return PrimitiveKernels::select(numValues, selectedPositionsBuffer,
+            [&](uint64_t startPos, uint64_t numValuesInBlock, uint8_t* results) {
+                for (auto i = 0u; i < numValuesInBlock; ++i) {
+                    SELECT_WRAPPER::template operation<LEFT_TYPE, RIGHT_TYPE, FUNC>(
+                        IS_LEFT_FLAT ? leftValue : leftValues[startPos + i],
+                        IS_RIGHT_FLAT ? rightValue : rightValues[startPos + i], results[i],
+                        &left, &right);
+                }
+            });
+    }
+
     template<class LEFT_TYPE, class RIGHT_TYPE, class FUNC, typename SELECT_WRAPPER>
     static uint64_t selectBothFlat(common::ValueVector& left, common::ValueVector& right) {
         auto lPos = left.state->selVector->selectedPositions[0];
@@ -330,9 +386,16 @@ struct BinaryFunctionExecutor {
             return numSelectedValues;
         } else if (right.hasNoNullsGuarantee()) {
             if (right.state->selVector->isUnfiltered()) {
-                for (auto i = 0u; i < right.state->selVector->selectedSize; ++i) {
-                    selectOnValue<LEFT_TYPE, RIGHT_TYPE, FUNC, SELECT_WRAPPER>(
-                        left, right, lPos, i, i, numSelectedValues, selectedPositionsBuffer);
+                if constexpr (PrimitiveKernels::isPrimitive<LEFT_TYPE, RIGHT_TYPE>()) {
+                    numSelectedValues =
+                        selectOnArrays<LEFT_TYPE, RIGHT_TYPE, FUNC, SELECT_WRAPPER, true, false>(
+                            left, right, right.state->selVector->selectedSize,
+                            selectedPositionsBuffer);
+                } else {
+                    for (auto i = 0u; i < right.state->selVector->selectedSize; ++i) {
+                        selectOnValue<LEFT_TYPE, RIGHT_TYPE, FUNC, SELECT_WRAPPER>(
+                            left, right, lPos, i, i, numSelectedValues, selectedPositionsBuffer);
+                    }
                 }
             } else {
                 for (auto i = 0u; i < right.state->selVector->selectedSize; ++i) {
@@ -373,9 +436,16 @@ struct BinaryFunctionExecutor {
             return numSelectedValues;
         } else if (left.hasNoNullsGuarantee()) {
             if (left.state->selVector->isUnfiltered()) {
-                for (auto i = 0u; i < left.state->selVector->selectedSize; ++i) {
-                    selectOnValue<LEFT_TYPE, RIGHT_TYPE, FUNC, SELECT_WRAPPER>(
-                        left, right, i, rPos, i, numSelectedValues, selectedPositionsBuffer);
+                if constexpr (PrimitiveKernels::isPrimitive<LEFT_TYPE, RIGHT_TYPE>()) {
+                    numSelectedValues =
+                        selectOnArrays<LEFT_TYPE, RIGHT_TYPE, FUNC, SELECT_WRAPPER, false, true>(
+                            left, right, left.state->selVector->selectedSize,
+                            selectedPositionsBuffer);
+                } else {
+                    for (auto i = 0u; i < left.state->selVector->selectedSize; ++i) {
+                        selectOnValue<LEFT_TYPE, RIGHT_TYPE, FUNC, SELECT_WRAPPER>(
+                            left, right, i, rPos, i, numSelectedValues, selectedPositionsBuffer);
+                    }
                 }
             } else {
                 for (auto i = 0u; i < left.state->selVector->selectedSize; ++i) {
@@ -414,9 +484,16 @@ struct BinaryFunctionExecutor {
         auto selectedPositionsBuffer = selVector.getMultableBuffer();
         if (left.hasNoNullsGuarantee() && right.hasNoNullsGuarantee()) {
             if (left.state->selVector->isUnfiltered()) {
-                for (auto i = 0u; i < left.state->selVector->selectedSize; i++) {
-                    selectOnValue<LEFT_TYPE, RIGHT_TYPE, FUNC, SELECT_WRAPPER>(
-                        left, right, i, i, i, numSelectedValues, selectedPositionsBuffer);
+                if constexpr (PrimitiveKernels::isPrimitive<LEFT_TYPE, RIGHT_TYPE>()) {
+                    numSelectedValues =
+                        selectOnArrays<LEFT_TYPE, RIGHT_TYPE, FUNC, SELECT_WRAPPER, false, false>(
+                            left, right, left.state->selVector->selectedSize,
+                            selectedPositionsBuffer);
+                } else {
+                    for (auto i = 0u; i < left.state->selVector->selectedSize; i++) {
+                        selectOnValue<LEFT_TYPE, RIGHT_TYPE, FUNC, SELECT_WRAPPER>(
+                            left, right, i, i, i, numSelectedValues, selectedPositionsBuffer);
+                    }
                 }
             } else {
                 for (auto i = 0u; i < left.state->selVector->selectedSize; i++) {
@@ -2,6 +2,7 @@
 
 #include "boolean_functions.h"
 #include "common/vector/value_vector.h"
+#include "function/primitive_kernels.h"
 
 namespace kuzu {
 namespace function {
@@ -31,6 +32,24 @@ struct BinaryBooleanFunctionExecutor {
         result.setNull(resPos, result.getValue<uint8_t>(resPos) == NULL_BOOL);
     }
 
+    // Executes on the first numValues positions of unfiltered vectors without nulls. A flat operand
+    // is read once at its selected position. See PrimitiveKernels.
+    template<typename FUNC, bool IS_LEFT_FLAT, bool IS_RIGHT_FLAT>
+    static void executeOnArraysNoNull(common::ValueVector& left, common::ValueVector& right,
+        common::ValueVector& result, uint64_t numValues) {
+        auto leftValues = (uint8_t*)left.getData();
+        auto rightValues = (uint8_t*)right.getData();
+        auto resultValues = (uint8_t*)result.getData();
+        auto leftValue = leftValues[left.state->selVector->selectedPositions[0]];
+        auto rightValue = rightValues[right.state->selVector->selectedPositions[0]];
+        for (auto i = 0u; i < numValues; ++i) {
+            FUNC::operation(IS_LEFT_FLAT ? leftValue : leftValues[i],
+                IS_RIGHT_FLAT ? rightValue : rightValues[i], resultValues[i],
+                false /* isLeftNull */, false /* isRightNull */);
+        }
+        result.setNullRange(0 /* startPos */, numValues, false /* value */);
+    }
+
     template<typename FUNC>
     static inline void executeBothFlat(
         common::ValueVector& left, common::ValueVector& right, common::ValueVector& result) {
@@ -46,9 +65,8 @@ struct BinaryBooleanFunctionExecutor {
         auto lPos = left.state->selVector->selectedPositions[0];
         if (right.state->selVector->isUnfiltered()) {
             if (right.hasNoNullsGuarantee() && !left.isNull(lPos)) {
-                for (auto i = 0u; i < right.state->selVector->selectedSize; ++i) {
-                    executeOnValueNoNull<FUNC>(left, right, result, lPos, i, i);
-                }
+                executeOnArraysNoNull<FUNC, true, false>(
+                    left, right, result, right.state->selVector->selectedSize);
             } else {
                 for (auto i = 0u; i < right.state->selVector->selectedSize; ++i) {
                     executeOnValue<FUNC>(left, right, result, lPos, i, i);
@@ -75,9 +93,8 @@ struct BinaryBooleanFunctionExecutor {
         auto rPos = right.state->selVector->selectedPositions[0];
         if (left.state->selVector->isUnfiltered()) {
             if (left.hasNoNullsGuarantee() && !right.isNull(rPos)) {
-                for (auto i = 0u; i < left.state->selVector->selectedSize; ++i) {
-                    executeOnValueNoNull<FUNC>(left, right, result, i, rPos, i);
-                }
+                executeOnArraysNoNull<FUNC, false, true>(
+                    left, right, result, left.state->selVector->selectedSize);
             } else {
                 for (auto i = 0u; i < left.state->selVector->selectedSize; ++i) {
                     executeOnValue<FUNC>(left, right, result, i, rPos, i);
@@ -104,9 +121,8 @@ struct BinaryBooleanFunctionExecutor {
         KU_ASSERT(left.state == right.state);
         if (left.state->selVector->isUnfiltered()) {
             if (left.hasNoNullsGuarantee() && right.hasNoNullsGuarantee()) {
-                for (auto i = 0u; i < left.state->selVector->selectedSize; ++i) {
-                    executeOnValueNoNull<FUNC>(left, right, result, i, i, i);
-                }
+                executeOnArraysNoNull<FUNC, false, false>(
+                    left, right, result, left.state->selVector->selectedSize);
             } else {
                 for (auto i = 0u; i < left.state->selVector->selectedSize; ++i) {
                     executeOnValue<FUNC>(left, right, result, i, i, i);
@@ -155,6 +171,25 @@ struct BinaryBooleanFunctionExecutor {
         numSelectedValues += (resultValue == true);
     }
 
+    // Selects from the first numValues positions of unfiltered vectors without nulls. A flat
+    // operand is read once at its selected position. See PrimitiveKernels.
+    template<typename FUNC, bool IS_LEFT_FLAT, bool IS_RIGHT_FLAT>
+    static uint64_t selectOnArraysNoNull(common::ValueVector& left, common::ValueVector& right,
+        uint64_t numValues, common::sel_t* selectedPositionsBuffer) {
+        auto leftValues = (uint8_t*)left.getData();
+        auto rightValues = (uint8_t*)right.getData();
+        auto leftValue = leftValues[left.state->selVector->selectedPositions[0]];
+        auto rightValue = rightValues[right.state->selVector->selectedPositions[0]];
+        return PrimitiveKernels::select(numValues, selectedPositionsBuffer,
+            [&](uint64_t startPos, uint64_t numValuesInBlock, uint8_t* results) {
+                for (auto i = 0u; i < numValuesInBlock; ++i) {
+                    FUNC::operation(IS_LEFT_FLAT ? leftValue : leftValues[startPos + i],
+                        IS_RIGHT_FLAT ? rightValue : rightValues[startPos + i], results[i],
+                        false /* isLeftNull */, false /* isRightNull */);
+                }
+            });
+    }
+
     template<typename FUNC>
     static bool selectBothFlat(common::ValueVector& left, common::ValueVector& right) {
         auto lPos = left.state->selVector->selectedPositions[0];
@@ -172,9 +207,14 @@ struct BinaryBooleanFunctionExecutor {
         uint64_t numSelectedValues = 0;
         auto selectedPositionsBuffer = selVector.getMultableBuffer();
         if (right.state->selVector->isUnfiltered()) {
-            for (auto i = 0u; i < right.state->selVector->selectedSize; ++i) {
-                selectOnValue<FUNC>(
-                    left, right, lPos, i, i, numSelectedValues, selectedPositionsBuffer);
+            if (right.hasNoNullsGuarantee() && !left.isNull(lPos)) {
+                numSelectedValues = selectOnArraysNoNull<FUNC, true, false>(
+                    left, right, right.state->selVector->selectedSize, selectedPositionsBuffer);
+            } else {
+                for (auto i = 0u; i < right.state->selVector->selectedSize; ++i) {
+                    selectOnValue<FUNC>(
+                        left, right, lPos, i, i, numSelectedValues, selectedPositionsBuffer);
+                }
             }
         } else {
             for (auto i = 0u; i < right.state->selVector->selectedSize; ++i) {
@@ -194,9 +234,14 @@ struct BinaryBooleanFunctionExecutor {
         uint64_t numSelectedValues = 0;
         auto selectedPositionsBuffer = selVector.getMultableBuffer();
         if (left.state->selVector->isUnfiltered()) {
-            for (auto i = 0u; i < left.state->selVector->selectedSize; ++i) {
-                selectOnValue<FUNC>(
-                    left, right, i, rPos, i, numSelectedValues, selectedPositionsBuffer);
+            if (left.hasNoNullsGuarantee() && !right.isNull(rPos)) {
+                numSelectedValues = selectOnArraysNoNull<FUNC, false, true>(
+                    left, right, left.state->selVector->selectedSize, selectedPositionsBuffer);
+            } else {
+                for (auto i = 0u; i < left.state->selVector->selectedSize; ++i) {
+                    selectOnValue<FUNC>(
+                        left, right, i, rPos, i, numSelectedValues, selectedPositionsBuffer);
+                }
             }
         } else {
             for (auto i = 0u; i < left.state->selVector->selectedSize; ++i) {
@@ -215,9 +260,14 @@ struct BinaryBooleanFunctionExecutor {
         uint64_t numSelectedValues = 0;
         auto selectedPositionsBuffer = selVector.getMultableBuffer();
         if (left.state->selVector->isUnfiltered()) {
-            for (auto i = 0u; i < left.state->selVector->selectedSize; ++i) {
-                selectOnValue<FUNC>(
-                    left, right, i, i, i, numSelectedValues, selectedPositionsBuffer);
+            if (left.hasNoNullsGuarantee() && right.hasNoNullsGuarantee()) {
+                numSelectedValues = selectOnArraysNoNull<FUNC, false, false>(
+                    left, right, left.state->selVector->selectedSize, selectedPositionsBuffer);
+            } else {
+                for (auto i = 0u; i < left.state->selVector->selectedSize; ++i) {
+                    selectOnValue<FUNC>(
+                        left, right, i, i, i, numSelectedValues, selectedPositionsBuffer);
+                }
             }
         } else {
             for (auto i = 0u; i < left.state->selVector->selectedSize; ++i) {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+
 #include "common/types/int128_t.h"
 #include "common/types/interval_t.h"
 #include "comparison_functions.h"
@@ -45,6 +47,120 @@ private:
             *params[0], *params[1], selVector);
     }
 
+    // Comparisons between a dictionary-encoded string vector and a constant are evaluated once per
+    // distinct string, and the result is looked up by dictionary code for the other positions.
+    template<typename FUNC>
+    static void StringComparisonExecFunction(
+        const std::vector<std::shared_ptr<common::ValueVector>>& params,
+        common::ValueVector& result, void* /*dataPtr*/ = nullptr) {
+        KU_ASSERT(params.size() == 2);
+        auto& left = *params[0];
+        auto& right = *params[1];
+        if (isDictionaryEncodedUnFlat(left) && right.state->isFlat()) {
+            executeDictionaryComparison<FUNC, true /* IS_DICTIONARY_LEFT */>(left, right, result);
+        } else if (left.state->isFlat() && isDictionaryEncodedUnFlat(right)) {
+            executeDictionaryComparison<FUNC, false /* IS_DICTIONARY_LEFT */>(right, left, result);
+        } else {
+            BinaryFunctionExecutor::executeComparison<common::ku_string_t, common::ku_string_t,
+                uint8_t, FUNC>(left, right, result);
+        }
+    }
+
+    template<typename FUNC>
+    static bool StringComparisonSelectFunction(
+        const std::vector<std::shared_ptr<common::ValueVector>>& params,
+        common::SelectionVector& selVector) {
+        KU_ASSERT(params.size() == 2);
+        auto& left = *params[0];
+        auto& right = *params[1];
+        if (isDictionaryEncodedUnFlat(left) && right.state->isFlat()) {
+            return selectDictionaryComparison<FUNC, true /* IS_DICTIONARY_LEFT */>(
+                left, right, selVector);
+        } else if (left.state->isFlat() && isDictionaryEncodedUnFlat(right)) {
+            return selectDictionaryComparison<FUNC, false /* IS_DICTIONARY_LEFT */>(
+                right, left, selVector);
+        }
+        return BinaryFunctionExecutor::selectComparison<common::ku_string_t, common::ku_string_t,
+            FUNC>(left, right, selVector);
+    }
+
+    static inline bool isDictionaryEncodedUnFlat(const common::ValueVector& vector) {
+        return !vector.state->isFlat() && common::StringVector::hasDictionaryCodes(&vector);
+    }
+
+    // Result of the comparison for each dictionary code. Codes that haven't been compared yet are
+    // UNKNOWN.
+    struct DictionaryComparisonCache {
+        static constexpr uint8_t UNKNOWN = UINT8_MAX;
+        std::array<uint8_t, common::DEFAULT_VECTOR_CAPACITY> resultPerCode;
+
+        DictionaryComparisonCache() { resultPerCode.fill(UNKNOWN); }
+
+        template<typename FUNC, bool IS_DICTIONARY_LEFT>
+        inline uint8_t compare(common::ValueVector& dictVector, uint32_t pos,
+            common::ValueVector& constVector, uint32_t constPos, common::dictionary_code_t code) {
+            if (resultPerCode[code] == UNKNOWN) {
+                auto& str = dictVector.getValue<common::ku_string_t>(pos);
+                auto& constStr = constVector.getValue<common::ku_string_t>(constPos);
+                uint8_t compareResult = 0;
+                if constexpr (IS_DICTIONARY_LEFT) {
+                    FUNC::operation(str, constStr, compareResult, &dictVector, &constVector);
+                } else {
+                    FUNC::operation(constStr, str, compareResult, &constVector, &dictVector);
+                }
+                resultPerCode[code] = compareResult;
+            }
+            return resultPerCode[code];
+        }
+    };
+
+    template<typename FUNC, bool IS_DICTIONARY_LEFT>
+    static void executeDictionaryComparison(common::ValueVector& dictVector,
+        common::ValueVector& constVector, common::ValueVector& result) {
+        auto constPos = constVector.state->selVector->selectedPositions[0];
+        if (constVector.isNull(constPos)) {
+            result.setAllNull();
+            return;
+        }
+        auto codes = common::StringVector::getDictionaryCodes(&dictVector);
+        auto resultValues = (uint8_t*)result.getData();
+        DictionaryComparisonCache cache;
+        auto& selVector = dictVector.state->selVector;
+        for (auto i = 0u; i < selVector->selectedSize; ++i) {
+            auto pos = selVector->selectedPositions[i];
+            result.setNull(pos, dictVector.isNull(pos));
+            if (!result.isNull(pos)) {
+                resultValues[pos] = cache.compare<FUNC, IS_DICTIONARY_LEFT>(
+                    dictVector, pos, constVector, constPos, codes[pos]);
+            }
+        }
+    }
+
+    template<typename FUNC, bool IS_DICTIONARY_LEFT>
+    static bool selectDictionaryComparison(common::ValueVector& dictVector,
+        common::ValueVector& constVector, common::SelectionVector& selVector) {
+        auto constPos = constVector.state->selVector->selectedPositions[0];
+        if (constVector.isNull(constPos)) {
+            return false;
+        }
+        auto codes = common::StringVector::getDictionaryCodes(&dictVector);
+        auto selectedPositionsBuffer = selVector.getMultableBuffer();
+        uint64_t numSelectedValues = 0;
+        DictionaryComparisonCache cache;
+        auto& dictSelVector = dictVector.state->selVector;
+        for (auto i = 0u; i < dictSelVector->selectedSize; ++i) {
+            auto pos = dictSelVector->selectedPositions[i];
+            if (dictVector.isNull(pos)) {
+                continue;
+            }
+            selectedPositionsBuffer[numSelectedValues] = pos;
+            numSelectedValues += cache.compare<FUNC, IS_DICTIONARY_LEFT>(
+                dictVector, pos, constVector, constPos, codes[pos]) == true;
+        }
+        selVector.selectedSize = numSelectedValues;
+        return numSelectedValues > 0;
+    }
+
     template<typename FUNC>
     static std::unique_ptr<ScalarFunction> getFunction(
         const std::string& name, common::LogicalTypeID leftType, common::LogicalTypeID rightType) {
@@ -102,8 +218,7 @@ private:
             func = BinaryComparisonExecFunction<uint8_t, uint8_t, uint8_t, FUNC>;
         } break;
         case common::PhysicalTypeID::STRING: {
-            func = BinaryComparisonExecFunction<common::ku_string_t, common::ku_string_t, uint8_t,
-                FUNC>;
+            func = StringComparisonExecFunction<FUNC>;
         } break;
         case common::PhysicalTypeID::INTERNAL_ID: {
             func = BinaryComparisonExecFunction<common::nodeID_t, common::nodeID_t, uint8_t, FUNC>;
@@ -170,7 +285,7 @@ private:
             func = BinaryComparisonSelectFunction<uint8_t, uint8_t, FUNC>;
         } break;
         case common::PhysicalTypeID::STRING: {
-            func = BinaryComparisonSelectFunction<common::ku_string_t, common::ku_string_t, FUNC>;
+            func = StringComparisonSelectFunction<FUNC>;
         } break;
         case common::PhysicalTypeID::INTERNAL_ID: {
             func = BinaryComparisonSelectFunction<common::nodeID_t, common::nodeID_t, FUNC>;
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace function {
+
+/**
+ * Helpers for the fast paths of function executors on unfiltered vectors without nulls. Loops over
+ * such vectors read and write plain arrays of primitive values without null checks, branches or
+ * reloading the data pointers of the vectors, so compilers can vectorize them for the instruction
+ * set the library is built for.
+ */
+struct PrimitiveKernels {
+    // Number of results computed before their positions are written to a selection vector.
+    static constexpr uint64_t SELECT_BLOCK_SIZE = 256;
+
+    template<typename... T>
+    static constexpr bool isPrimitive() {
+        return (std::is_arithmetic_v<T> && ...);
+    }
+
+    // Selects the positions in [0, numValues) whose result is true. The results of each block of
+    // positions are computed by computeResults(startPos, numValuesInBlock, results) in a separate
+    // loop from appending the selected positions, which depends on the number of positions
+    // selected so far and cannot be vectorized.
+    template<typename COMPUTE_FUNC>
+    static uint64_t select(
+        uint64_t numValues, common::sel_t* selectedPositions, COMPUTE_FUNC computeResults) {
+        uint8_t results[SELECT_BLOCK_SIZE];
+        uint64_t numSelectedValues = 0;
+        for (auto startPos = 0u; startPos < numValues; startPos += SELECT_BLOCK_SIZE) {
+            auto numValuesInBlock = std::min(SELECT_BLOCK_SIZE, numValues - startPos);
+            computeResults(startPos, numValuesInBlock, results);
+            for (auto i = 0u; i < numValuesInBlock; ++i) {
+                selectedPositions[numSelectedValues] = startPos + i;
+                numSelectedValues += (results[i] == true);
+            }
+        }
+        return numSelectedValues;
+    }
+};
+
+} // namespace function
+} // namespace kuzu
@@ -86,5 +86,17 @@ struct StorageInfoFunction final : public CallFunction {
     static function_set getFunctionSet();
 };
 
+struct AdmissionInfoFunction final : public CallFunction {
+    static constexpr const char* name = "ADMISSION_INFO";
+
+    static function_set getFunctionSet();
+};
+
+struct QueryStatsFunction final : public CallFunction {
+    static constexpr const char* name = "QUERY_STATS";
+
+    static function_set getFunctionSet();
+};
+
 } // namespace function
 } // namespace kuzu
@@ -2,6 +2,7 @@
 
 #include "common/vector/value_vector.h"
 #include "function/cast/cast_function_bind_data.h"
+#include "function/primitive_kernels.h"
 
 namespace kuzu {
 namespace function {
@@ -128,9 +129,19 @@ struct UnaryFunctionExecutor {
         } else {
             if (operand.hasNoNullsGuarantee()) {
                 if (operand.state->selVector->isUnfiltered()) {
-                    for (auto i = 0u; i < operand.state->selVector->selectedSize; i++) {
-                        executeOnValue<OPERAND_TYPE, RESULT_TYPE, FUNC, OP_WRAPPER>(
-                            operand, i, result, i, dataPtr);
+                    if constexpr (std::is_same_v<OP_WRAPPER, UnaryFunctionWrapper> &&
+                                  PrimitiveKernels::isPrimitive<OPERAND_TYPE, RESULT_TYPE>()) {
+                        // See PrimitiveKernels.
+                        auto operandValues = (OPERAND_TYPE*)operand.getData();
+                        auto resultValues = (RESULT_TYPE*)result.getData();
+                        for (auto i = 0u; i < operand.state->selVector->selectedSize; i++) {
+                            FUNC::operation(operandValues[i], resultValues[i]);
+                        }
+                    } else {
+                        for (auto i = 0u; i < operand.state->selVector->selectedSize; i++) {
+                            executeOnValue<OPERAND_TYPE, RESULT_TYPE, FUNC, OP_WRAPPER>(
+                                operand, i, result, i, dataPtr);
+                        }
                     }
                 } else {
                     for (auto i = 0u; i < operand.state->selVector->selectedSize; i++) {
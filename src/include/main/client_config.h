@@ -25,6 +25,17 @@ struct ClientConfig {
     uint64_t showProgressAfter;
     // If multi copy is enabled
     bool enableMultiCopy;
+    // Memory (bytes) a hash join can use for its build side before spilling it to disk. 0 means
+    // half of the buffer pool.
+    uint64_t hashJoinMemoryLimit;
+    // Memory (bytes) the local hash tables of a hash aggregate can use before being spilled to disk.
+    // 0 means half of the buffer pool.
+    uint64_t aggregateMemoryLimit;
+    // Memory (bytes) the tuples of an ORDER BY can use before being spilled to disk as sorted runs.
+    // 0 means half of the buffer pool.
+    uint64_t orderByMemoryLimit;
+    // If PROFILE outputs the profiled plan as json instead of as boxes.
+    bool profileJson;
 };
 
 struct ClientConfigDefault {
@@ -35,6 +46,10 @@ struct ClientConfigDefault {
     static constexpr bool ENABLE_PROGRESS_BAR = true;
     static constexpr uint64_t SHOW_PROGRESS_AFTER = 1000;
     static constexpr bool ENABLE_MULTI_COPY = false;
+    static constexpr uint64_t HASH_JOIN_MEMORY_LIMIT = 0;
+    static constexpr uint64_t AGGREGATE_MEMORY_LIMIT = 0;
+    static constexpr uint64_t ORDER_BY_MEMORY_LIMIT = 0;
+    static constexpr bool PROFILE_JSON = false;
 };
 
 } // namespace main
@@ -32,8 +32,13 @@ namespace extension {
 struct ExtensionOptions;
 }
 
+namespace processor {
+class AdmissionController;
+}
+
 namespace main {
 class Database;
+class QueryStatsLog;
 
 struct ActiveQuery {
     explicit ActiveQuery();
@@ -96,6 +101,8 @@ public:
     storage::StorageManager* getStorageManager() const;
     KUZU_API storage::MemoryManager* getMemoryManager();
     catalog::Catalog* getCatalog() const;
+    processor::AdmissionController* getAdmissionController() const;
+    QueryStatsLog* getQueryStatsLog() const;
     common::VirtualFileSystem* getVFSUnsafe() const;
     common::RandomEngine* getRandomEngine();
 
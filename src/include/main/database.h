@@ -6,6 +6,7 @@
 
 #include "common/api.h"
 #include "common/case_insensitive_map.h"
+#include "common/enums/eviction_policy.h"
 #include "kuzu_fwd.h"
 
 namespace kuzu {
@@ -34,6 +35,7 @@ class StorageExtension;
 namespace main {
 struct ExtensionOption;
 class DatabaseManager;
+class QueryStatsLog;
 
 /**
  * @brief Stores runtime configuration for creating or opening a Database
@@ -55,15 +57,20 @@ struct KUZU_API SystemConfig {
      * environment. This will be removed once we implemente a better solution later. The value is
      * default to 1 << 43 (8TB) under 64-bit environment and 1GB under 32-bit one (see
      * `DEFAULT_VM_REGION_MAX_SIZE`).
+     * @param evictionPolicy The replacement policy used by the buffer pool. The default FIFO policy
+     * suits scan-heavy workloads, while TWO_QUEUE keeps frequently accessed pages cached when point
+     * lookups are mixed with large scans.
      */
     explicit SystemConfig(uint64_t bufferPoolSize = -1u, uint64_t maxNumThreads = 0,
-        bool enableCompression = true, bool readOnly = false, uint64_t maxDBSize = -1u);
+        bool enableCompression = true, bool readOnly = false, uint64_t maxDBSize = -1u,
+        common::EvictionPolicy evictionPolicy = common::EvictionPolicy::FIFO);
 
     uint64_t bufferPoolSize;
     uint64_t maxNumThreads;
     bool enableCompression;
     bool readOnly;
     uint64_t maxDBSize;
+    common::EvictionPolicy evictionPolicy;
 };
 
 /**
@@ -150,6 +157,7 @@ private:
     std::unique_ptr<common::FileInfo> lockFile;
     std::unique_ptr<extension::ExtensionOptions> extensionOptions;
     std::unique_ptr<DatabaseManager> databaseManager;
+    std::unique_ptr<QueryStatsLog> queryStatsLog;
     common::case_insensitive_map_t<std::unique_ptr<storage::StorageExtension>> storageExtensions;
 };
 
@@ -59,6 +59,8 @@ private:
     bool success = true;
     bool readOnly = false;
     std::string errMsg;
+    // Text of the query the statement is prepared from, which is recorded in the query stats.
+    std::string query;
     PreparedSummary preparedSummary;
     std::unordered_map<std::string, std::shared_ptr<common::Value>> parameterMap;
     std::unique_ptr<binder::BoundStatementResult> statementResult;
@@ -115,6 +115,11 @@ public:
     KUZU_API void resetIterator();
 
     processor::FactorizedTable* getTable() { return factorizedTable.get(); }
+    // Moves over up to numTuples tuples without reading them and returns the number of tuples
+    // moved over, the first of which is the tuple at startTupleIdx in the table. This lets the
+    // caller read the tuples directly from the table, which is only possible if the table has no
+    // unflat columns.
+    uint64_t skipNextTuples(uint64_t numTuples, uint64_t& startTupleIdx);
 
     /**
      * @brief Returns the arrow schema of the query result.
@@ -138,6 +143,17 @@ public:
      */
     KUZU_API std::unique_ptr<ArrowArray> getNextArrowChunk(int64_t chunkSize);
 
+    /**
+     * @brief Returns the remaining tuples of the query result as an arrow array stream.
+     * @param chunkSize number of tuples in each arrow array returned by the stream.
+     * @return An arrow array stream, whose get_next returns the same arrays as getNextArrowChunk
+     * until all tuples are read.
+     *
+     * The stream reads from the query result, which must outlive the stream.
+     * It is the caller's responsibility to call the release function to release the stream.
+     */
+    KUZU_API std::unique_ptr<ArrowArrayStream> getArrowArrayStream(int64_t chunkSize);
+
 private:
     void initResultTableAndIterator(std::shared_ptr<processor::FactorizedTable> factorizedTable_,
         const std::vector<std::shared_ptr<binder::Expression>>& columns);
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace kuzu {
+namespace main {
+
+// Statistics of an executed query. Page accesses are counted for the whole database while the
+// query runs, so they include the page accesses of queries running concurrently.
+struct QueryStats {
+    std::string query;
+    uint64_t numThreads;
+    double compilingTimeInMS;
+    double executionTimeInMS;
+    uint64_t numTuples;
+    uint64_t numPageHits;
+    uint64_t numPageMisses;
+};
+
+// Keeps the statistics of the most recently executed queries, which are returned by the
+// QUERY_STATS table function. Collecting them only reads a few counters, so it is always on.
+class QueryStatsLog {
+public:
+    static constexpr uint64_t MAX_NUM_QUERIES = 1000;
+
+    void add(QueryStats queryStats);
+
+    // Returns the statistics from the least to the most recently executed query.
+    std::vector<QueryStats> getStats() const;
+
+private:
+    mutable std::mutex mtx;
+    std::deque<QueryStats> stats;
+};
+
+} // namespace main
+} // namespace kuzu
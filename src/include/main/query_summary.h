@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string>
+
 #include "common/api.h"
 #include "kuzu_fwd.h"
 
@@ -30,6 +32,11 @@ public:
      * @return query execution time in milliseconds.
      */
     KUZU_API double getExecutionTime() const;
+    /**
+     * @return the profiled plan with the time, page accesses and memory used by each operator as
+     * json, or an empty string if the query is not executed with PROFILE.
+     */
+    KUZU_API std::string getProfileJson() const;
 
     void setPreparedSummary(PreparedSummary preparedSummary_);
 
@@ -40,6 +47,7 @@ public:
 
 private:
     double executionTime = 0;
+    std::string profileJson;
     PreparedSummary preparedSummary;
 };
 
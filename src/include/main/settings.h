@@ -116,5 +116,53 @@ struct EnableMultiCopySetting {
     }
 };
 
+struct HashJoinMemoryLimitSetting {
+    static constexpr const char* name = "hash_join_memory_limit";
+    static constexpr const common::LogicalTypeID inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        KU_ASSERT(parameter.getDataType()->getLogicalTypeID() == common::LogicalTypeID::INT64);
+        context->getClientConfigUnsafe()->hashJoinMemoryLimit = parameter.getValue<int64_t>();
+    }
+    static common::Value getSetting(ClientContext* context) {
+        return common::Value(context->getClientConfig()->hashJoinMemoryLimit);
+    }
+};
+
+struct AggregateMemoryLimitSetting {
+    static constexpr const char* name = "aggregate_memory_limit";
+    static constexpr const common::LogicalTypeID inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        KU_ASSERT(parameter.getDataType()->getLogicalTypeID() == common::LogicalTypeID::INT64);
+        context->getClientConfigUnsafe()->aggregateMemoryLimit = parameter.getValue<int64_t>();
+    }
+    static common::Value getSetting(ClientContext* context) {
+        return common::Value(context->getClientConfig()->aggregateMemoryLimit);
+    }
+};
+
+struct OrderByMemoryLimitSetting {
+    static constexpr const char* name = "order_by_memory_limit";
+    static constexpr const common::LogicalTypeID inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        KU_ASSERT(parameter.getDataType()->getLogicalTypeID() == common::LogicalTypeID::INT64);
+        context->getClientConfigUnsafe()->orderByMemoryLimit = parameter.getValue<int64_t>();
+    }
+    static common::Value getSetting(ClientContext* context) {
+        return common::Value(context->getClientConfig()->orderByMemoryLimit);
+    }
+};
+
+struct ProfileJsonSetting {
+    static constexpr const char* name = "profile_json";
+    static constexpr const common::LogicalTypeID inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        KU_ASSERT(parameter.getDataType()->getLogicalTypeID() == common::LogicalTypeID::BOOL);
+        context->getClientConfigUnsafe()->profileJson = parameter.getValue<bool>();
+    }
+    static common::Value getSetting(ClientContext* context) {
+        return common::Value(context->getClientConfig()->profileJson);
+    }
+};
+
 } // namespace main
 } // namespace kuzu
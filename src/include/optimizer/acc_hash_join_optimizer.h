@@ -1,6 +1,7 @@
 #pragma once
 
 #include "logical_operator_visitor.h"
+#include "planner/operator/logical_hash_join.h"
 #include "planner/operator/logical_plan.h"
 
 namespace kuzu {
@@ -19,6 +20,9 @@ private:
 
     bool tryProbeToBuildHJSIP(planner::LogicalOperator* op);
     bool tryBuildToProbeHJSIP(planner::LogicalOperator* op);
+    // Filters the probe side tuples with a Bloom filter on the build side keys, as early in the
+    // probe side pipeline as the keys are available.
+    void tryAppendBloomFilter(planner::LogicalHashJoin* hashJoin);
 
     void visitIntersect(planner::LogicalOperator* op) override;
 
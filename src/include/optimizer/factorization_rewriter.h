@@ -26,6 +26,7 @@ private:
     void visitUnwind(planner::LogicalOperator* op) override;
     void visitUnion(planner::LogicalOperator* op) override;
     void visitFilter(planner::LogicalOperator* op) override;
+    void visitBloomFilter(planner::LogicalOperator* op) override;
     void visitSetNodeProperty(planner::LogicalOperator* op) override;
     void visitSetRelProperty(planner::LogicalOperator* op) override;
     void visitDeleteNode(planner::LogicalOperator* op) override;
@@ -28,6 +28,7 @@ private:
 
     // Push FILTER before SCAN_NODE_PROPERTY.
     // Push index lookup into SCAN_NODE_ID.
+    // Attach property-constant comparisons to SCAN_NODE_ID for zone map pruning.
     std::shared_ptr<planner::LogicalOperator> visitScanNodePropertyReplace(
         const std::shared_ptr<planner::LogicalOperator>& op);
 
@@ -129,6 +129,12 @@ protected:
         return op;
     }
 
+    virtual void visitBloomFilter(planner::LogicalOperator* /*op*/) {}
+    virtual std::shared_ptr<planner::LogicalOperator> visitBloomFilterReplace(
+        std::shared_ptr<planner::LogicalOperator> op) {
+        return op;
+    }
+
     virtual void visitSetNodeProperty(planner::LogicalOperator* /*op*/) {}
     virtual std::shared_ptr<planner::LogicalOperator> visitSetNodePropertyReplace(
         std::shared_ptr<planner::LogicalOperator> op) {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "binder/expression/property_expression.h"
 #include "binder/query/query_graph.h"
 #include "planner/operator/logical_plan.h"
 #include "storage/stats/nodes_store_statistics.h"
@@ -23,16 +24,22 @@ public:
 
     uint64_t estimateScanNode(LogicalOperator* op);
     uint64_t estimateHashJoin(const binder::expression_vector& joinKeys,
-        const LogicalPlan& probePlan, const LogicalPlan& buildPlan);
+        const LogicalPlan& probePlan, const LogicalPlan& buildPlan,
+        transaction::Transaction* transaction);
     uint64_t estimateCrossProduct(const LogicalPlan& probePlan, const LogicalPlan& buildPlan);
     uint64_t estimateIntersect(const binder::expression_vector& joinNodeIDs,
         const LogicalPlan& probePlan, const std::vector<std::unique_ptr<LogicalPlan>>& buildPlans);
     uint64_t estimateFlatten(const LogicalPlan& childPlan, f_group_pos groupPosToFlatten);
-    uint64_t estimateFilter(const LogicalPlan& childPlan, const binder::Expression& predicate);
+    uint64_t estimateFilter(const LogicalPlan& childPlan, const binder::Expression& predicate,
+        transaction::Transaction* transaction);
 
     double getExtensionRate(const binder::RelExpression& rel,
         const binder::NodeExpression& boundNode, transaction::Transaction* transaction);
 
+    inline uint64_t getNumNodes(const binder::NodeExpression& node) {
+        return getNodeIDDom(node.getInternalID()->getUniqueName());
+    }
+
 private:
     inline uint64_t atLeastOne(uint64_t x) { return x == 0 ? 1 : x; }
 
@@ -46,6 +53,19 @@ private:
     uint64_t getNumRels(
         const std::vector<common::table_id_t>& tableIDs, transaction::Transaction* transaction);
 
+    // Selectivity of the predicate estimated from column statistics. Returns a negative value if
+    // the statistics can't be used for the predicate.
+    double getSelectivity(
+        const binder::Expression& predicate, transaction::Transaction* transaction);
+    const storage::PropertyStatistics* getPropertyStatistics(common::table_id_t tableID,
+        common::property_id_t propertyID, transaction::Transaction* transaction) const;
+    // Number of distinct values of the property over all its tables, or 0 if unknown.
+    uint64_t getNumDistinctValues(
+        const binder::PropertyExpression& property, transaction::Transaction* transaction) const;
+    // Fraction of the values of the property that are <= value, or a negative value if unknown.
+    double getFractionLessOrEqual(const binder::PropertyExpression& property, double value,
+        transaction::Transaction* transaction) const;
+
 private:
     const storage::NodesStoreStatsAndDeletedIDs* nodesStatistics;
     const storage::RelsStoreStats* relsStatistics;
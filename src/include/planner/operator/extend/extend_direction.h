@@ -28,6 +28,17 @@ struct ExtendDirectionUtils {
         return extendDirection == ExtendDirection::FWD ? common::RelDataDirection::FWD :
                                                          common::RelDataDirection::BWD;
     }
+
+    static inline ExtendDirection getReverseDirection(ExtendDirection extendDirection) {
+        switch (extendDirection) {
+        case ExtendDirection::FWD:
+            return ExtendDirection::BWD;
+        case ExtendDirection::BWD:
+            return ExtendDirection::FWD;
+        default:
+            return ExtendDirection::BOTH;
+        }
+    }
 };
 
 } // namespace planner
@@ -15,7 +15,8 @@ public:
         std::shared_ptr<LogicalOperator> child, std::shared_ptr<LogicalOperator> recursiveChild)
         : BaseLogicalExtend{LogicalOperatorType::RECURSIVE_EXTEND, std::move(boundNode),
               std::move(nbrNode), std::move(rel), direction, std::move(child)},
-          joinType{joinType}, recursiveChild{std::move(recursiveChild)} {}
+          joinType{joinType}, recursiveChild{std::move(recursiveChild)},
+          multiSourceBFS{false} {}
 
     f_group_pos_set getGroupsPosToFlatten() override;
 
@@ -25,15 +26,33 @@ public:
     inline void setJoinType(RecursiveJoinType joinType_) { joinType = joinType_; }
     inline RecursiveJoinType getJoinType() const { return joinType; }
     inline std::shared_ptr<LogicalOperator> getRecursiveChild() const { return recursiveChild; }
+    // Multi-source BFS is only applicable to shortest paths that don't track paths, which is only
+    // known after projection push down. So the planner only marks whether it is worth using.
+    inline void setMultiSourceBFS(bool multiSourceBFS_) { multiSourceBFS = multiSourceBFS_; }
+    inline bool useMultiSourceBFS() const { return multiSourceBFS; }
+    // Recursive plan that extends in the reverse direction, used to extend BFS levels bottom-up.
+    inline void setBwdRecursiveChild(std::shared_ptr<LogicalOperator> child) {
+        bwdRecursiveChild = std::move(child);
+    }
+    inline std::shared_ptr<LogicalOperator> getBwdRecursiveChild() const {
+        return bwdRecursiveChild;
+    }
 
     inline std::unique_ptr<LogicalOperator> copy() override {
-        return std::make_unique<LogicalRecursiveExtend>(boundNode, nbrNode, rel, direction,
+        auto extend = std::make_unique<LogicalRecursiveExtend>(boundNode, nbrNode, rel, direction,
             joinType, children[0]->copy(), recursiveChild->copy());
+        extend->setMultiSourceBFS(multiSourceBFS);
+        if (bwdRecursiveChild != nullptr) {
+            extend->setBwdRecursiveChild(bwdRecursiveChild->copy());
+        }
+        return extend;
     }
 
 private:
     RecursiveJoinType joinType;
     std::shared_ptr<LogicalOperator> recursiveChild;
+    std::shared_ptr<LogicalOperator> bwdRecursiveChild;
+    bool multiSourceBFS;
 };
 
 class LogicalPathPropertyProbe : public LogicalOperator {
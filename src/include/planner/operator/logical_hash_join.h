@@ -40,7 +40,8 @@ public:
         : LogicalOperator{LogicalOperatorType::HASH_JOIN, std::move(probeSideChild),
               std::move(buildSideChild)},
           joinConditions(std::move(joinConditions)), joinType{joinType}, mark{std::move(mark)},
-          sip{SidewaysInfoPassing::NONE}, order{JoinSubPlanSolveOrder::ANY} {}
+          sip{SidewaysInfoPassing::NONE}, order{JoinSubPlanSolveOrder::ANY},
+          bloomFilter{nullptr} {}
 
     f_group_pos_set getGroupsPosToFlattenOnProbeSide();
     f_group_pos_set getGroupsPosToFlattenOnBuildSide();
@@ -69,6 +70,9 @@ public:
     inline void setJoinSubPlanSolveOrder(JoinSubPlanSolveOrder order_) { order = order_; }
     inline JoinSubPlanSolveOrder getJoinSubPlanSolveOrder() const { return order; }
 
+    inline void setBloomFilter(LogicalOperator* bloomFilter_) { bloomFilter = bloomFilter_; }
+    inline LogicalOperator* getBloomFilter() const { return bloomFilter; }
+
     inline std::unique_ptr<LogicalOperator> copy() override {
         return make_unique<LogicalHashJoin>(
             joinConditions, joinType, mark, children[0]->copy(), children[1]->copy());
@@ -93,6 +97,8 @@ private:
     std::shared_ptr<binder::Expression> mark; // when joinType is Mark
     SidewaysInfoPassing sip;
     JoinSubPlanSolveOrder order; // sip introduce join dependency
+    // Bloom filter on the probe side that is built from the build side keys.
+    LogicalOperator* bloomFilter;
 };
 
 } // namespace planner
@@ -10,6 +10,7 @@ enum class LogicalOperatorType : uint8_t {
     AGGREGATE,
     ALTER,
     ATTACH_DATABASE,
+    BLOOM_FILTER,
     DETACH_DATABASE,
     COMMENT_ON,
     COPY_FROM,
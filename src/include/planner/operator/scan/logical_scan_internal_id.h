@@ -20,13 +20,23 @@ public:
     inline std::shared_ptr<binder::Expression> getInternalID() const { return internalID; }
     inline std::vector<common::table_id_t> getTableIDs() const { return tableIDs; }
 
+    // Comparisons between a property of the scanned node and a constant. They are used to skip
+    // node groups based on zone maps, and are still evaluated by the filter above the scan.
+    inline void addPropertyPredicate(std::shared_ptr<binder::Expression> predicate) {
+        propertyPredicates.push_back(std::move(predicate));
+    }
+    inline binder::expression_vector getPropertyPredicates() const { return propertyPredicates; }
+
     inline std::unique_ptr<LogicalOperator> copy() final {
-        return make_unique<LogicalScanInternalID>(internalID, tableIDs);
+        auto result = make_unique<LogicalScanInternalID>(internalID, tableIDs);
+        result->propertyPredicates = propertyPredicates;
+        return result;
     }
 
 private:
     std::shared_ptr<binder::Expression> internalID;
     std::vector<common::table_id_t> tableIDs;
+    binder::expression_vector propertyPredicates;
 };
 
 } // namespace planner
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "binder/expression/expression_util.h"
+#include "common/exception/runtime.h"
+#include "planner/operator/logical_operator.h"
+
+namespace kuzu {
+namespace planner {
+
+// Filters the probe side tuples of a hash join with a Bloom filter on the keys of the build side.
+class LogicalBloomFilter : public LogicalOperator {
+public:
+    LogicalBloomFilter(binder::expression_vector keys, std::shared_ptr<LogicalOperator> child)
+        : LogicalOperator{LogicalOperatorType::BLOOM_FILTER, std::move(child)},
+          keys{std::move(keys)} {}
+
+    inline void computeFactorizedSchema() override { copyChildSchema(0); }
+    inline void computeFlatSchema() override { copyChildSchema(0); }
+
+    f_group_pos_set getGroupsPosToFlatten();
+    f_group_pos getGroupPosToSelect() const;
+
+    inline std::string getExpressionsForPrinting() const override {
+        return binder::ExpressionUtil::toString(keys);
+    }
+
+    inline binder::expression_vector getKeys() const { return keys; }
+
+    inline std::unique_ptr<LogicalOperator> copy() override {
+        throw common::RuntimeException("LogicalBloomFilter::copy() should not be called.");
+    }
+
+private:
+    binder::expression_vector keys;
+};
+
+} // namespace planner
+} // namespace kuzu
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+namespace kuzu {
+namespace main {
+class ClientContext;
+}
+
+namespace processor {
+
+struct AdmissionStats {
+    uint64_t numThreads;
+    uint64_t numThreadsInUse;
+    uint64_t numRunningQueries;
+    uint64_t numQueuedQueries;
+    uint64_t numAdmittedQueries;
+    uint64_t numWaitedQueries;
+    uint64_t numDegradedQueries;
+    double totalWaitTimeInMS;
+    double maxWaitTimeInMS;
+};
+
+class AdmissionController;
+
+// Returns the threads granted to a query back to the admission controller when the query is done.
+class AdmittedQuery {
+public:
+    AdmittedQuery(AdmissionController* controller, uint64_t numThreads)
+        : controller{controller}, numThreads{numThreads} {}
+    AdmittedQuery(const AdmittedQuery&) = delete;
+    AdmittedQuery& operator=(const AdmittedQuery&) = delete;
+    ~AdmittedQuery();
+
+    inline uint64_t getNumThreads() const { return numThreads; }
+
+private:
+    AdmissionController* controller;
+    uint64_t numThreads;
+};
+
+// AdmissionController coordinates the number of worker threads used by queries across all
+// connections of a database, so that the total never exceeds the number of threads of the
+// TaskScheduler. Each query asks for the number of threads set for its connection, and is granted
+// at most its fair share of the threads that are not in use, i.e., the query is degraded if the
+// machine is partially saturated. If all threads are in use, the query waits in a FIFO queue until
+// another query is done. A waiting query can be interrupted, and waiting counts towards its
+// timeout.
+class AdmissionController {
+    friend class AdmittedQuery;
+
+public:
+    explicit AdmissionController(uint64_t numThreads);
+
+    // If canWait is false, e.g., the query is part of an active transaction which could block other
+    // queries, the query is admitted right away with at least one thread.
+    std::unique_ptr<AdmittedQuery> admit(
+        main::ClientContext* context, uint64_t numThreadsRequested, bool canWait);
+
+    AdmissionStats getStats();
+
+private:
+    uint64_t grantNoLock(uint64_t numThreadsRequested);
+    void release(uint64_t numThreads);
+
+private:
+    std::mutex mtx;
+    std::condition_variable cv;
+    uint64_t numThreads;
+    uint64_t numThreadsInUse;
+    uint64_t numRunningQueries;
+    // Tickets of the waiting queries in arrival order. A query is admitted when its ticket is at
+    // the front of the queue and there is at least one free thread.
+    std::deque<uint64_t> waitingTickets;
+    uint64_t nextTicket;
+    uint64_t numAdmittedQueries;
+    uint64_t numWaitedQueries;
+    uint64_t numDegradedQueries;
+    double totalWaitTimeInMS;
+    double maxWaitTimeInMS;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "common/profiler.h"
+#include "common/task_system/task.h"
 #include "main/client_context.h"
 
 namespace kuzu {
@@ -9,9 +10,17 @@ namespace processor {
 struct ExecutionContext {
     common::Profiler* profiler;
     main::ClientContext* clientContext;
+    // The task of the pipeline being executed. Pipelines of a query are executed one after another,
+    // so there is at most one such task at a time.
+    common::Task* task = nullptr;
+    // Maximum number of threads the query can use, as granted by the AdmissionController.
+    uint64_t numThreads;
 
+    ExecutionContext(
+        common::Profiler* profiler, main::ClientContext* clientContext, uint64_t numThreads)
+        : profiler{profiler}, clientContext{clientContext}, numThreads{numThreads} {}
     ExecutionContext(common::Profiler* profiler, main::ClientContext* clientContext)
-        : profiler{profiler}, clientContext{clientContext} {}
+        : ExecutionContext{profiler, clientContext, clientContext->getClientConfig()->numThreads} {}
 };
 
 } // namespace processor
@@ -13,6 +13,11 @@ public:
         const std::shared_ptr<binder::Expression>& expression, const planner::Schema* schema);
     static std::unique_ptr<evaluator::ExpressionEvaluator> getConstantEvaluator(
         const std::shared_ptr<binder::Expression>& expression);
+    // Returns nullptr unless there are at least two predicates and each of them compares an
+    // expression in the given schema with a constant of the same primitive type, e.g. a.age > 20.
+    // The compared expressions must all be in the same factorization group.
+    static std::unique_ptr<evaluator::ExpressionEvaluator> getConjunctiveComparisonEvaluator(
+        const binder::expression_vector& predicates, const planner::Schema* schema);
 
 private:
     static std::unique_ptr<evaluator::ExpressionEvaluator> getLiteralEvaluator(
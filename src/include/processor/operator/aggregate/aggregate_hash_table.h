@@ -3,6 +3,7 @@
 #include "aggregate_input.h"
 #include "function/aggregate_function.h"
 #include "processor/result/base_hash_table.h"
+#include "processor/result/spill_file.h"
 #include "storage/buffer_manager/memory_manager.h"
 
 namespace kuzu {
@@ -86,6 +87,25 @@ public:
 
     void resize(uint64_t newSize);
 
+    static inline uint64_t getPartitionIdx(common::hash_t hash) {
+        return hash >> (64 - common::AggregateConstants::NUM_PARTITIONS_LOG2);
+    }
+    //! returns the entries grouped by the partitions of their key hashes
+    std::vector<std::vector<uint8_t*>> getPartitionedEntries() const;
+    //! creates an empty hash table with the same keys and aggregate functions
+    std::unique_ptr<AggregateHashTable> createEmptyCopy(uint64_t numEntriesToAllocate) const;
+    //! merge the given entries of another aggregate hash table
+    void merge(AggregateHashTable& other, const std::vector<uint8_t*>& entries);
+
+    // Writes all entries to the files of their partitions and clears the table. Keys are written as
+    // values, while aggregate states are written as raw bytes, so states must not point to memory
+    // outside of the table.
+    void spill(const spill_files_t& partitionFiles);
+    //! merge the entries spilled to the given file by a table with the same keys and functions
+    void mergeSpilledEntries(const SpillFile& file);
+
+    uint64_t getMemoryUsage() const;
+
 private:
     void initializeFT(
         const std::vector<std::unique_ptr<function::AggregateFunction>>& aggregateFunctions);
@@ -94,6 +114,16 @@ private:
 
     void initializeTmpVectors();
 
+    // Creates vectors to read keys of entries into before merging them. All vectors, including the
+    // hash vector, share the given unflat state.
+    std::vector<std::unique_ptr<common::ValueVector>> createVectorsToMerge(
+        const std::shared_ptr<common::DataChunkState>& state);
+    // Finds or creates entries for the keys in the vectors, and combines the aggregate states of the
+    // given entries of another table into them.
+    void combineEntries(const std::vector<common::ValueVector*>& keyVectors,
+        const std::vector<common::ValueVector*>& dependentKeyVectors,
+        common::DataChunkState* state, uint8_t** otherEntries);
+
     // ! This function will only be used by distinct aggregate, which assumes that all groupByKeys
     // are flat.
     uint8_t* findEntryInDistinctHT(
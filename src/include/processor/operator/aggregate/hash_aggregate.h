@@ -6,29 +6,62 @@
 namespace kuzu {
 namespace processor {
 
+// If the local hash tables of all threads hold many groups, or some of them have been spilled to
+// disk, they aren't merged into a single global hash table. Instead, groups are partitioned by the
+// hashes of their keys, and each partition is merged and scanned independently by the scan threads.
 // NOLINTNEXTLINE(cppcoreguidelines-virtual-class-destructor): This is a final class.
 class HashAggregateSharedState final : public BaseAggregateSharedState {
 
 public:
     explicit HashAggregateSharedState(
         const std::vector<std::unique_ptr<function::AggregateFunction>>& aggregateFunctions)
-        : BaseAggregateSharedState{aggregateFunctions} {}
+        : BaseAggregateSharedState{aggregateFunctions}, memoryLimit{0}, vfs{nullptr},
+          partitioned{false}, nextPartitionIdx{0} {}
 
-    void appendAggregateHashTable(std::unique_ptr<AggregateHashTable> aggregateHashTable);
+    // Allows local hash tables to be spilled once their memory usage exceeds their share of the
+    // memory limit.
+    void enableSpilling(
+        uint64_t memoryLimit, common::VirtualFileSystem* vfs, std::string spillDirectory);
+    inline bool isSpillingEnabled() const { return vfs != nullptr; }
+    inline uint64_t getMemoryLimit() const { return memoryLimit; }
+    // Creates a file for each partition in the spill directory.
+    spill_files_t createPartitionFiles() const;
+
+    void appendAggregateHashTable(std::unique_ptr<AggregateHashTable> aggregateHashTable,
+        std::vector<std::vector<uint8_t*>> partitionedEntries, spill_files_t localPartitionFiles);
 
     void combineAggregateHashTable(storage::MemoryManager& memoryManager);
 
     void finalizeAggregateHashTable();
 
+    inline bool isPartitioned() const { return partitioned; }
+    // Merges the groups of the next partition from all local hash tables and spill files into a new
+    // hash table, and finalizes their aggregate states. Returns nullptr once all partitions have
+    // been claimed.
+    std::unique_ptr<AggregateHashTable> mergeNextPartition();
+
     std::pair<uint64_t, uint64_t> getNextRangeToRead() override;
 
-    inline uint8_t* getRow(uint64_t idx) { return globalAggregateHashTable->getEntry(idx); }
+    inline AggregateHashTable& getGlobalHashTable() { return *globalAggregateHashTable; }
 
-    FactorizedTable* getFactorizedTable() { return globalAggregateHashTable->getFactorizedTable(); }
+    // Returns the number of groups. If groups are merged by partitions, this is an upper bound,
+    // since groups of different local hash tables and spill files may have the same keys.
+    uint64_t getNumTuples();
 
 private:
     std::vector<std::unique_ptr<AggregateHashTable>> localAggregateHashTables;
     std::unique_ptr<AggregateHashTable> globalAggregateHashTable;
+
+    uint64_t memoryLimit;
+    common::VirtualFileSystem* vfs;
+    std::string spillDirectory;
+
+    bool partitioned;
+    uint64_t nextPartitionIdx;
+    // Entries of each local hash table, grouped by partitions.
+    std::vector<std::vector<std::vector<uint8_t*>>> localPartitionedEntries;
+    // Files of each partition, one from each thread that spilled its local hash table.
+    std::vector<spill_files_t> partitionFiles;
 };
 
 class HashAggregate : public BaseAggregate {
@@ -68,6 +101,8 @@ private:
 
     std::shared_ptr<HashAggregateSharedState> sharedState;
     std::unique_ptr<AggregateHashTable> localAggregateHashTable;
+    // Files are only created once the local hash table is spilled.
+    spill_files_t localPartitionFiles;
 };
 
 } // namespace processor
@@ -33,11 +33,18 @@ public:
             sharedState, groupByKeyVectorsPos, aggregatesPos, id, paramsString);
     }
 
+private:
+    // Scans groups and aggregate results of the given range of entries into the output vectors.
+    void scanEntries(AggregateHashTable& hashTable, uint64_t startOffset, uint64_t numEntries);
+
 private:
     std::vector<DataPos> groupByKeyVectorsPos;
     std::vector<common::ValueVector*> groupByKeyVectors;
     std::shared_ptr<HashAggregateSharedState> sharedState;
     std::vector<uint32_t> groupByKeyVectorsColIdxes;
+    // Partition currently being scanned, if the shared state merges groups by partitions.
+    std::unique_ptr<AggregateHashTable> partitionHashTable;
+    uint64_t nextEntryIdx = 0;
 };
 
 } // namespace processor
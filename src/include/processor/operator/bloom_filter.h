@@ -0,0 +1,56 @@
+#pragma once
+
+#include "processor/operator/filtering_operator.h"
+#include "processor/operator/hash_join/join_bloom_filter.h"
+#include "processor/operator/physical_operator.h"
+
+namespace kuzu {
+namespace processor {
+
+// BloomFilter drops the probe side tuples of an inner hash join whose keys are not in the Bloom
+// filter built from the build side. It is placed below the operators of the probe side pipeline
+// that extend or scan properties, so that these operators only see tuples that may be joined.
+// At most one of the key data chunks may be unflat.
+class BloomFilter : public PhysicalOperator, public SelVectorOverWriter {
+public:
+    BloomFilter(std::shared_ptr<JoinBloomFilterSharedState> sharedState,
+        std::vector<DataPos> keysPos, uint32_t dataChunkToSelectPos,
+        std::unique_ptr<PhysicalOperator> child, uint32_t id, const std::string& paramsString)
+        : PhysicalOperator{PhysicalOperatorType::BLOOM_FILTER, std::move(child), id,
+              paramsString},
+          sharedState{std::move(sharedState)}, keysPos{std::move(keysPos)},
+          dataChunkToSelectPos{dataChunkToSelectPos} {}
+
+    inline std::shared_ptr<JoinBloomFilterSharedState> getSharedState() const {
+        return sharedState;
+    }
+
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
+
+    bool getNextTuplesInternal(ExecutionContext* context) override;
+
+    inline std::unique_ptr<PhysicalOperator> clone() override {
+        return std::make_unique<BloomFilter>(
+            sharedState, keysPos, dataChunkToSelectPos, children[0]->clone(), id, paramsString);
+    }
+
+private:
+    // Returns false if a key in a flat data chunk other than the one to select is null.
+    bool hasNonNullFlatKeys() const;
+    // Discards null keys and keys not in the filter from the data chunk to select.
+    common::sel_t selectKeysInFilter();
+
+private:
+    std::shared_ptr<JoinBloomFilterSharedState> sharedState;
+    std::vector<DataPos> keysPos;
+    // The data chunk of the unflat key, or of a key if all keys are flat.
+    uint32_t dataChunkToSelectPos;
+
+    std::vector<common::ValueVector*> keyVectors;
+    common::DataChunkState* keyState = nullptr;
+    std::unique_ptr<common::ValueVector> hashVector;
+    std::unique_ptr<common::ValueVector> tmpHashVector;
+};
+
+} // namespace processor
+} // namespace kuzu
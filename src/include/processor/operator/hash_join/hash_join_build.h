@@ -1,5 +1,7 @@
 #pragma once
 
+#include "hash_join_spiller.h"
+#include "join_bloom_filter.h"
 #include "join_hash_table.h"
 #include "processor/operator/physical_operator.h"
 #include "processor/operator/sink.h"
@@ -17,20 +19,63 @@ class HashJoinBuild;
 // HashJoinBuild thread when they finished materializing thread-local tuples. Also, the state holds
 // a global htDirectory, which will be updated by the last thread in the hash join build side
 // task/pipeline, and probed by the HashJoinProbe operators.
+// If spilling is enabled and the tuples of all build threads exceed the memory limit, the build
+// side is spilled to disk instead, partitioned by the hashes of the keys. Each HashJoinProbe
+// thread then joins its probe tuples with one partition at a time.
+// If the probe side filters its tuples with a Bloom filter, the filter is built from the hashes of
+// the build tuples once they are all merged.
 class HashJoinSharedState {
 public:
     explicit HashJoinSharedState(std::unique_ptr<JoinHashTable> hashTable)
-        : hashTable{std::move(hashTable)} {};
+        : hashTable{std::move(hashTable)}, memoryLimit{0}, memoryUsage{0}, spilling{false},
+          vfs{nullptr} {};
 
     virtual ~HashJoinSharedState() = default;
 
-    void mergeLocalHashTable(JoinHashTable& localHashTable);
+    // Returns false if the build side is being spilled. The local tuples must be spilled instead.
+    bool mergeLocalHashTable(JoinHashTable& localHashTable);
 
     inline JoinHashTable* getHashTable() { return hashTable.get(); }
 
+    void enableSpilling(
+        uint64_t memoryLimit, common::VirtualFileSystem* vfs, std::string spillDirectory);
+    inline bool isSpillingEnabled() const { return vfs != nullptr; }
+    inline bool isSpilling() const { return spilling.load(); }
+    inline uint64_t getMemoryLimit() const { return memoryLimit; }
+    // Applies the change of the memory used by a build thread. Returns true if the tuples of all
+    // build threads exceed the memory limit.
+    bool updateMemoryUsage(uint64_t prevMemoryUsage, uint64_t newMemoryUsage);
+    // Creates a file for each partition in the spill directory.
+    spill_files_t createPartitionFiles() const;
+    // Switches the build side to spilling, if no other thread has done so. The tuples merged into
+    // the global hash table so far are spilled to the given files.
+    void startSpilling(HashJoinSpiller& spiller, const spill_files_t& partitionFiles);
+    // Takes over the files that a build thread has spilled its tuples to.
+    void mergePartitionFiles(spill_files_t& localPartitionFiles);
+    inline const spill_files_t& getPartitionFiles(uint64_t partitionIdx) const {
+        return partitionFiles[partitionIdx];
+    }
+
+    inline void setBloomFilterState(std::shared_ptr<JoinBloomFilterSharedState> state) {
+        bloomFilterState = std::move(state);
+    }
+    inline JoinBloomFilterSharedState* getBloomFilterState() const {
+        return bloomFilterState.get();
+    }
+
 protected:
     std::mutex mtx;
     std::unique_ptr<JoinHashTable> hashTable;
+
+    uint64_t memoryLimit;
+    std::atomic<uint64_t> memoryUsage;
+    std::atomic<bool> spilling;
+    common::VirtualFileSystem* vfs;
+    std::string spillDirectory;
+    // Files of each partition, one from each build thread that spilled tuples.
+    std::vector<spill_files_t> partitionFiles;
+
+    std::shared_ptr<JoinBloomFilterSharedState> bloomFilterState;
 };
 
 class HashJoinBuildInfo {
@@ -94,6 +139,9 @@ protected:
 private:
     void setKeyState(common::DataChunkState* state);
 
+    void updateMemoryUsage(ExecutionContext* context);
+    void spillLocalHashTable();
+
 protected:
     std::shared_ptr<HashJoinSharedState> sharedState;
     std::unique_ptr<HashJoinBuildInfo> info;
@@ -104,6 +152,11 @@ protected:
     std::vector<common::ValueVector*> payloadVectors;
 
     std::unique_ptr<JoinHashTable> hashTable; // local state
+
+    // Local spilling state. Files are only created once the build side is spilled.
+    std::unique_ptr<HashJoinSpiller> spiller;
+    spill_files_t localPartitionFiles;
+    uint64_t reportedMemoryUsage = 0;
 };
 
 } // namespace processor
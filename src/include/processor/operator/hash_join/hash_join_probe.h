@@ -27,6 +27,31 @@ struct ProbeState {
     common::sel_t nextMatchedTupleIdx;
 };
 
+// State of a probe thread if the build side has been spilled. The thread first spills all its
+// probe tuples, partitioned in the same way as the build side. It then loads one partition of
+// the build side at a time into its own hash table, and joins it with the partition's probe
+// tuples.
+struct ProbeSpillState {
+    storage::MemoryManager* memoryManager = nullptr;
+    std::unique_ptr<HashJoinSpiller> buildSpiller;
+    std::unique_ptr<JoinHashTable> partitionHashTable;
+    spill_files_t partitionFiles;
+    // Probe side vectors grouped by data chunk. Spilled tuples are read back into them, with the
+    // chunks' selection vectors replaced by our own.
+    std::vector<std::vector<common::ValueVector*>> chunkVectors;
+    std::vector<common::DataChunkState*> chunkStates;
+    std::vector<std::shared_ptr<common::SelectionVector>> chunkSelVectors;
+    // Whether each chunk is flat when probe tuples are spilled. Flattens above an exhausted chunk
+    // set it back to unflat, so the state can't be checked when tuples are read back.
+    std::vector<bool> isChunkFlat;
+    // Index of the chunk of the unflat key, or UINT32_MAX if keys are flat.
+    uint32_t keyChunkIdx = UINT32_MAX;
+    bool isProbeSideSpilled = false;
+    uint64_t nextPartitionIdx = 0;
+    std::unique_ptr<SpillFileReader> reader;
+    uint64_t numRowsToRead = 0;
+};
+
 struct ProbeDataInfo {
 public:
     ProbeDataInfo(std::vector<DataPos> keysDataPos, std::vector<DataPos> payloadsOutPos)
@@ -36,6 +61,7 @@ public:
     ProbeDataInfo(const ProbeDataInfo& other)
         : ProbeDataInfo{other.keysDataPos, other.payloadsOutPos} {
         markDataPos = other.markDataPos;
+        probeSideDataPos = other.probeSideDataPos;
     }
 
     inline uint32_t getNumPayloads() const { return payloadsOutPos.size(); }
@@ -44,6 +70,8 @@ public:
     std::vector<DataPos> keysDataPos;
     std::vector<DataPos> payloadsOutPos;
     DataPos markDataPos;
+    // Vectors in scope on the probe side, including keys. They are spilled if the build side is.
+    std::vector<DataPos> probeSideDataPos;
 };
 
 // Probe side on left, i.e. children[0] and build side on right, i.e. children[1]
@@ -77,6 +105,17 @@ public:
     }
 
 private:
+    // Pulls the next probe tuples from the child, or from the spilled probe tuples if the build
+    // side has been spilled.
+    bool getNextProbeTuples(ExecutionContext* context);
+
+    void initSpillState(ResultSet* resultSet, ExecutionContext* context);
+    void spillProbeTuples(ExecutionContext* context);
+    void writeProbeRow(SpillFile& file, common::sel_t keyPos);
+    bool readSpilledProbeTuples();
+    void readProbeRow();
+    void loadPartition(uint64_t partitionIdx);
+
     inline bool getMatchedTuples(ExecutionContext* context) {
         return flatProbe ? getMatchedTuplesForFlatKey(context) :
                            getMatchedTuplesForUnFlatKey(context);
@@ -106,6 +145,10 @@ private:
     std::vector<common::ValueVector*> keyVectors;
     std::shared_ptr<common::ValueVector> markVector;
     std::unique_ptr<ProbeState> probeState;
+    // The global hash table, or the hash table of the current partition if the build side has been
+    // spilled.
+    JoinHashTable* hashTable = nullptr;
+    std::unique_ptr<ProbeSpillState> spillState;
 
     std::unique_ptr<common::ValueVector> hashVector;
     std::unique_ptr<common::ValueVector> tmpHashVector;
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "join_hash_table.h"
+#include "processor/result/spill_file.h"
+
+namespace kuzu {
+namespace processor {
+
+// Moves the tuples of a JoinHashTable to spill files, one for each partition of the key hashes,
+// and loads the tuples of a partition back into a JoinHashTable. Tuples are scanned into vectors
+// and written as rows of keys and payloads. Hash and prev pointer columns aren't spilled, since
+// they are recomputed when tuples are appended again.
+class HashJoinSpiller {
+public:
+    HashJoinSpiller(const FactorizedTableSchema& tableSchema, uint32_t numKeys,
+        const std::vector<common::LogicalType>& columnTypes, storage::MemoryManager* memoryManager);
+
+    static inline uint64_t getPartitionIdx(common::hash_t hash) {
+        return hash >> (64 - common::HashJoinConstants::NUM_PARTITIONS_LOG2);
+    }
+
+    // Writes all tuples of the hash table to the files of their partitions, i.e., one file for each
+    // partition, and clears the table.
+    void spill(JoinHashTable& hashTable, const spill_files_t& partitionFiles);
+    // Appends all rows of the given files of a partition to the hash table.
+    void load(const spill_files_t& files, JoinHashTable& hashTable);
+
+private:
+    void writeRow(SpillFile& file, uint32_t pos);
+    void readRow(SpillFileReader& reader, uint32_t pos);
+
+private:
+    std::vector<ft_col_idx_t> colIdxes;
+    std::vector<bool> isUnflatCol;
+    bool hasUnflatCol;
+    // If there are no unflat columns, all vectors share an unflat state, and tuples are scanned
+    // and loaded in batches. Otherwise, tuples are processed one by one, with flat columns sharing
+    // a flat state and each unflat column having its own state.
+    std::shared_ptr<common::DataChunkState> keyState;
+    std::vector<std::shared_ptr<common::DataChunkState>> unflatColStates;
+    std::vector<std::unique_ptr<common::ValueVector>> vectors;
+    std::vector<common::ValueVector*> vectorPtrs;
+    std::vector<common::ValueVector*> keyVectors;
+    std::vector<common::ValueVector*> payloadVectors;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace processor {
+
+class JoinHashTable;
+
+// A blocked Bloom filter over the key hashes of the build side of a hash join. Each hash sets four
+// bits within a single 64-bit word, so a lookup touches one word and needs no branches, which lets
+// the probe side check a whole vector of hashes in a tight loop.
+class JoinBloomFilter {
+public:
+    static constexpr uint64_t NUM_BITS_PER_KEY = 16;
+    // The filter is not built if it would take more memory than this.
+    static constexpr uint64_t MAX_NUM_WORDS = (uint64_t)1 << 24;
+
+    explicit JoinBloomFilter(uint64_t numKeys);
+
+    // Returns nullptr if the hash table has too many tuples to build a filter for.
+    static std::unique_ptr<JoinBloomFilter> build(JoinHashTable& hashTable);
+
+    inline void insert(common::hash_t hash) { words[getWordIdx(hash)] |= getMask(hash); }
+    inline bool mayContain(common::hash_t hash) const {
+        auto mask = getMask(hash);
+        return (words[getWordIdx(hash)] & mask) == mask;
+    }
+
+private:
+    // The word is chosen by the high bits of the hash, and the bits within the word by the low
+    // bits. The hash table uses the low bits to find slots, which does not matter here.
+    inline uint64_t getWordIdx(common::hash_t hash) const { return (hash >> 32) & wordIdxMask; }
+    static inline uint64_t getMask(common::hash_t hash) {
+        return ((uint64_t)1 << (hash & 63)) | ((uint64_t)1 << ((hash >> 6) & 63)) |
+               ((uint64_t)1 << ((hash >> 12) & 63)) | ((uint64_t)1 << ((hash >> 18) & 63));
+    }
+
+private:
+    uint64_t wordIdxMask;
+    std::unique_ptr<uint64_t[]> words;
+};
+
+// Shared by the BloomFilter operators on the probe side of a hash join and the HashJoinBuild
+// operators, which build the filter once all build tuples are merged. The filter stays empty if the
+// build side is spilled, in which case probe tuples are not filtered.
+struct JoinBloomFilterSharedState {
+    std::unique_ptr<JoinBloomFilter> filter;
+};
+
+} // namespace processor
+} // namespace kuzu
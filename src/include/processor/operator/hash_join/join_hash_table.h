@@ -23,6 +23,9 @@ public:
     void allocateHashSlots(uint64_t numTuples);
     void buildHashSlots();
 
+    // Computes the hashes of the keys in the same way as the hashes of the appended tuples.
+    static void computeKeyHashes(const std::vector<common::ValueVector*>& keyVectors,
+        common::ValueVector* hashVector, common::ValueVector* tmpHashVector);
     void probe(const std::vector<common::ValueVector*>& keyVectors, common::ValueVector* hashVector,
         common::ValueVector* tmpHashVector, uint8_t** probedTuples);
     // All key vectors must be flat. Thus input is a tuple, multiple matches can be found for the
@@ -39,6 +42,11 @@ public:
     }
     void merge(JoinHashTable& other) { factorizedTable->merge(*other.factorizedTable); }
     uint64_t getNumTuples() { return factorizedTable->getNumTuples(); }
+    // Removes all tuples. Hash slots must be rebuilt before the table is probed again.
+    void clear() { factorizedTable->clear(); }
+    common::hash_t getHashValue(const uint8_t* tuple) const {
+        return *(common::hash_t*)(tuple + getHashValueColOffset());
+    }
     uint8_t** getPrevTuple(const uint8_t* tuple) const {
         return (uint8_t**)(tuple + prevPtrColOffset);
     }
@@ -49,6 +57,7 @@ public:
     }
     FactorizedTable* getFactorizedTable() { return factorizedTable.get(); }
     const FactorizedTableSchema* getTableSchema() { return factorizedTable->getTableSchema(); }
+    const common::logical_type_vec_t& getKeyTypes() const { return keyTypes; }
 
 private:
     uint8_t** findHashSlot(const uint8_t* tuple) const;
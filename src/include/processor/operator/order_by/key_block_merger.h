@@ -135,7 +135,9 @@ public:
     }
 
 private:
-    uint64_t findRightKeyBlockIdx(uint8_t* leftEndTuplePtr) const;
+    // Returns the number of tuples of the left key block among the first diagonal tuples of the
+    // merged result.
+    uint64_t findMergePathSplit(uint64_t diagonal) const;
 
 public:
     static const uint32_t batch_size = 10000;
@@ -20,13 +20,7 @@ public:
 
     void executeInternal(ExecutionContext* context) override;
 
-    void finalize(ExecutionContext* /*context*/) override {
-        // TODO(Ziyi): we always call lookup function on the first factorizedTable in sharedState
-        // and that lookup function may read tuples in other factorizedTable, So we need to combine
-        // hasNoNullGuarantee with other factorizedTables. This is not a good way to solve this
-        // problem, and should be changed later.
-        sharedState->combineFTHasNoNullGuarantee();
-    }
+    void finalize(ExecutionContext* context) override;
 
     std::unique_ptr<PhysicalOperator> clone() override {
         return std::make_unique<OrderBy>(resultSetDescriptor->copy(), info->copy(), sharedState,
@@ -36,12 +30,18 @@ public:
 private:
     void initGlobalStateInternal(ExecutionContext* context) final;
 
+    void updateMemoryUsage(ExecutionContext* context);
+    void spillLocalTuples();
+
 private:
     std::unique_ptr<OrderByDataInfo> info;
     std::unique_ptr<SortLocalState> localState;
     std::shared_ptr<SortSharedState> sharedState;
     std::vector<common::ValueVector*> orderByVectors;
     std::vector<common::ValueVector*> payloadVectors;
+    // Only set if spilling is enabled.
+    std::unique_ptr<OrderBySpiller> spiller;
+    uint64_t reportedMemoryUsage = 0;
 };
 
 } // namespace processor
@@ -86,6 +86,9 @@ public:
     void encodeKeys(const std::vector<common::ValueVector*>& orderByKeys);
 
     inline void clear() { keyBlocks.clear(); }
+    // Drops the encoded keys, so that keys of a payload table that has been cleared can be encoded
+    // from scratch.
+    void resetState();
 
 private:
     template<typename type>
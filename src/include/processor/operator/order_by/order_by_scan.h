@@ -9,12 +9,17 @@ namespace processor {
 struct OrderByScanLocalState {
     std::vector<common::ValueVector*> vectorsToRead;
     std::unique_ptr<PayloadScanner> payloadScanner;
+    // Only set if the tuples have been spilled to sorted runs.
+    std::unique_ptr<SortedRunMerger> runMerger;
 
     void init(
         std::vector<DataPos>& outVectorPos, SortSharedState& sharedState, ResultSet& resultSet);
 
     // NOLINTNEXTLINE(readability-make-member-function-const): Updates vectorsToRead.
-    inline uint64_t scan() { return payloadScanner->scan(vectorsToRead); }
+    inline uint64_t scan() {
+        return runMerger != nullptr ? runMerger->scan(vectorsToRead) :
+                                      payloadScanner->scan(vectorsToRead);
+    }
 };
 
 // To preserve the ordering of tuples, the orderByScan operator will only
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "processor/operator/order_by/key_block_merger.h"
+#include "processor/result/spill_file.h"
+
+namespace kuzu {
+namespace processor {
+
+// Writes the tuples of a sorted key block to a spill file as a sorted run. Each row consists of the
+// encoded keys, the full values of the string keys, which are needed to break ties of the encoded
+// string prefixes, and the payload values. Payloads are scanned into vectors in batches, so only
+// payload tables without unflat columns can be spilled.
+class OrderBySpiller {
+public:
+    OrderBySpiller(const OrderByDataInfo& orderByDataInfo,
+        const std::vector<StrKeyColInfo>& strKeyColsInfo, uint32_t numBytesPerTuple,
+        storage::MemoryManager* memoryManager);
+
+    // payloadTables[i] must be the table of the tuples encoded with ftIdx i. If the key block holds
+    // tuples of several tables, the tables must agree on the columns that may contain nulls.
+    void spill(const MergedKeyBlocks& keyBlock, const std::vector<FactorizedTable*>& payloadTables,
+        SpillFile& file);
+
+private:
+    const std::vector<StrKeyColInfo>& strKeyColsInfo;
+    uint32_t numBytesToCompare;
+    uint32_t payloadIdxOffset;
+    std::vector<ft_col_idx_t> colIdxes;
+    std::shared_ptr<common::DataChunkState> state;
+    std::vector<std::unique_ptr<common::ValueVector>> vectors;
+    std::vector<common::ValueVector*> vectorPtrs;
+    std::unique_ptr<uint8_t*[]> tuplesToRead;
+};
+
+// Merges the sorted runs spilled by OrderBySpiller and scans their payloads in order. The current
+// row of each run is kept in a min-heap of runs.
+class SortedRunMerger {
+    struct RunState {
+        std::unique_ptr<SpillFileReader> reader;
+        uint64_t numRowsLeft;
+        // Encoded keys and full string keys of the current row. Its payload values are read when
+        // the row is scanned.
+        std::vector<uint8_t> keys;
+        std::vector<std::string> strKeys;
+    };
+
+public:
+    SortedRunMerger(const spill_files_t& runs, const std::vector<StrKeyColInfo>& strKeyColsInfo,
+        uint32_t numBytesPerTuple);
+
+    uint64_t scan(std::vector<common::ValueVector*>& vectorsToRead);
+
+private:
+    void readKeys(RunState& run);
+    // Returns true if the current row of the left run goes after the current row of the right run.
+    bool isGreater(const RunState& left, const RunState& right) const;
+
+private:
+    const std::vector<StrKeyColInfo>& strKeyColsInfo;
+    uint32_t numBytesToCompare;
+    std::vector<RunState> runs;
+    // Indexes of the runs that have rows left.
+    std::vector<uint32_t> heap;
+    std::function<bool(uint32_t, uint32_t)> heapCompareFunc;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -1,16 +1,23 @@
 #pragma once
 
+#include <atomic>
 #include <queue>
 
+#include "processor/operator/order_by/order_by_spiller.h"
 #include "processor/operator/order_by/radix_sort.h"
 #include "processor/result/factorized_table.h"
 
 namespace kuzu {
 namespace processor {
 
+// If spilling is enabled and the tuples of all threads exceed the memory limit, threads sort their
+// tuples into runs and spill them to disk instead of keeping them in memory. The runs are merged
+// when they are scanned.
 class SortSharedState {
 public:
-    SortSharedState() : nextTableIdx{0}, numBytesPerTuple{0} {
+    SortSharedState()
+        : nextTableIdx{0}, numBytesPerTuple{0}, memoryLimit{0}, memoryUsage{0}, spilling{false},
+          vfs{nullptr} {
         sortedKeyBlocks = std::make_unique<std::queue<std::shared_ptr<MergedKeyBlocks>>>();
     }
 
@@ -37,6 +44,22 @@ public:
         return sortedKeyBlocks->empty() ? nullptr : sortedKeyBlocks->front().get();
     }
 
+    void enableSpilling(
+        uint64_t memoryLimit, common::VirtualFileSystem* vfs, std::string spillDirectory);
+    inline bool isSpillingEnabled() const { return vfs != nullptr; }
+    inline bool isSpilling() const { return spilling.load(); }
+    inline void startSpilling() { spilling.store(true); }
+    inline uint64_t getMemoryLimit() const { return memoryLimit; }
+    // Applies the change of the memory used by a thread. Returns true if the tuples of all threads
+    // exceed the memory limit.
+    bool updateMemoryUsage(uint64_t prevMemoryUsage, uint64_t newMemoryUsage);
+    std::unique_ptr<SpillFile> createRunFile() const;
+    void appendSpilledRun(std::unique_ptr<SpillFile> run);
+    inline const spill_files_t& getSpilledRuns() const { return spilledRuns; }
+    // Spills the key blocks that threads have sorted in memory as a single run. Called once all
+    // threads are done, if any of them has spilled.
+    void spillSortedKeyBlocks(OrderBySpiller& spiller, storage::MemoryManager* memoryManager);
+
 private:
     std::mutex mtx;
     std::vector<std::unique_ptr<FactorizedTable>> payloadTables;
@@ -44,6 +67,13 @@ private:
     std::unique_ptr<std::queue<std::shared_ptr<MergedKeyBlocks>>> sortedKeyBlocks;
     uint32_t numBytesPerTuple;
     std::vector<StrKeyColInfo> strKeyColsInfo;
+
+    uint64_t memoryLimit;
+    std::atomic<uint64_t> memoryUsage;
+    std::atomic<bool> spilling;
+    common::VirtualFileSystem* vfs;
+    std::string spillDirectory;
+    spill_files_t spilledRuns;
 };
 
 class SortLocalState {
@@ -56,11 +86,18 @@ public:
 
     void finalize(SortSharedState& sharedState);
 
+    inline bool isEmpty() const { return payloadTable->getNumTuples() == 0; }
+    // Size of the memory blocks allocated for local tuples and their keys.
+    uint64_t getMemoryUsage() const;
+    // Sorts the local tuples into a single run, spills it and clears the local tuples.
+    void spill(SortSharedState& sharedState, OrderBySpiller& spiller);
+
 private:
     std::unique_ptr<OrderByKeyEncoder> orderByKeyEncoder;
     std::unique_ptr<RadixSort> radixSorter;
     uint64_t globalIdx;
     FactorizedTable* payloadTable;
+    storage::MemoryManager* memoryManager;
 };
 
 class PayloadScanner {
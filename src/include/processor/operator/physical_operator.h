@@ -12,6 +12,7 @@ enum class PhysicalOperatorType : uint8_t {
     AGGREGATE_SCAN,
     ATTACH_DATABASE,
     BATCH_INSERT,
+    BLOOM_FILTER,
     COMMENT_ON,
     CREATE_MACRO,
     DETACH_DATABASE,
@@ -78,12 +79,25 @@ public:
 struct OperatorMetrics {
 
 public:
-    OperatorMetrics(common::TimeMetric& executionTime, common::NumericMetric& numOutputTuple)
-        : executionTime{executionTime}, numOutputTuple{numOutputTuple} {}
+    OperatorMetrics(common::TimeMetric& executionTime, common::NumericMetric& numOutputTuple,
+        common::ResourceMetric& resources)
+        : executionTime{executionTime}, numOutputTuple{numOutputTuple}, resources{resources} {}
 
 public:
     common::TimeMetric& executionTime;
     common::NumericMetric& numOutputTuple;
+    common::ResourceMetric& resources;
+};
+
+// Resources used by an operator, excluding its children, summed over all threads.
+struct OperatorResourceUsage {
+    uint64_t numPageHits = 0;
+    uint64_t numPageMisses = 0;
+    uint64_t numBytesRead = 0;
+    // Sum of the peak memory allocated through the memory manager by each thread.
+    int64_t peakMemoryUsage = 0;
+    // Execution time of each thread in milliseconds.
+    std::vector<double> threadExecutionTimes;
 };
 
 class PhysicalOperator;
@@ -133,6 +147,7 @@ public:
     std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
         common::Profiler& profiler) const;
     std::vector<std::string> getProfilerAttributes(common::Profiler& profiler) const;
+    OperatorResourceUsage getResourceUsage(common::Profiler& profiler) const;
 
     virtual std::unique_ptr<PhysicalOperator> clone() = 0;
 
@@ -146,6 +161,7 @@ protected:
 
     inline std::string getTimeMetricKey() const { return "time-" + std::to_string(id); }
     inline std::string getNumTupleMetricKey() const { return "numTuple-" + std::to_string(id); }
+    inline std::string getResourceMetricKey() const { return "resource-" + std::to_string(id); }
 
     void registerProfilingMetrics(common::Profiler* profiler);
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "bfs_state.h"
+#include "visited_nodes.h"
 
 namespace kuzu {
 namespace processor {
@@ -8,8 +9,10 @@ namespace processor {
 template<bool TRACK_PATH>
 class AllShortestPathState : public BaseBFSState {
 public:
-    AllShortestPathState(uint8_t upperBound, TargetDstNodes* targetDstNodes)
-        : BaseBFSState{upperBound, targetDstNodes}, minDistance{0}, numVisitedDstNodes{0} {}
+    AllShortestPathState(
+        uint8_t upperBound, TargetDstNodes* targetDstNodes, VisitedNodes* visitedNodes)
+        : BaseBFSState{upperBound, targetDstNodes}, minDistance{0}, numVisitedDstNodes{0},
+          visitedNodes{visitedNodes} {}
 
     inline bool isComplete() final {
         return isCurrentFrontierEmpty() || isUpperBoundReached() ||
@@ -20,11 +23,11 @@ public:
         BaseBFSState::resetState();
         minDistance = 0;
         numVisitedDstNodes = 0;
-        visitedNodeToDistance.clear();
+        visitedNodes->resetState();
     }
 
     inline void markSrc(common::nodeID_t nodeID) override {
-        visitedNodeToDistance.insert({nodeID, -1});
+        visitedNodes->insert(nodeID, 0 /* level */);
         if (targetDstNodes->contains(nodeID)) {
             numVisitedDstNodes++;
         }
@@ -33,8 +36,9 @@ public:
 
     void markVisited(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID,
         common::relID_t relID, uint64_t multiplicity) final {
-        if (!visitedNodeToDistance.contains(nbrNodeID)) {
-            visitedNodeToDistance.insert({nbrNodeID, (int64_t)currentLevel});
+        uint8_t nbrLevel = currentLevel + 1;
+        if (!visitedNodes->contains(nbrNodeID)) {
+            visitedNodes->insert(nbrNodeID, nbrLevel);
             if (targetDstNodes->contains(nbrNodeID)) {
                 minDistance = currentLevel;
                 numVisitedDstNodes++;
@@ -44,7 +48,7 @@ public:
             } else {
                 nextFrontier->addNodeWithMultiplicity(nbrNodeID, multiplicity);
             }
-        } else if (currentLevel <= visitedNodeToDistance.at(nbrNodeID)) {
+        } else if (visitedNodes->getLevel(nbrNodeID) == nbrLevel) {
             if constexpr (TRACK_PATH) {
                 nextFrontier->addEdge(boundNodeID, nbrNodeID, relID);
             } else {
@@ -53,15 +57,31 @@ public:
         }
     }
 
+    inline bool isInCurrentFrontier(common::nodeID_t nodeID) const final {
+        return visitedNodes->contains(nodeID) && visitedNodes->getLevel(nodeID) == currentLevel;
+    }
+
 private:
     inline bool isAllDstReachedWithMinDistance() const {
         return numVisitedDstNodes == targetDstNodes->getNumNodes() && currentLevel > minDistance;
     }
 
+    inline bool startBottomUpLevel() final {
+        if (!visitedNodes->isDense() ||
+            currentFrontier->nodeIDs.size() <= visitedNodes->getNumUnvisited()) {
+            return false;
+        }
+        visitedNodes->initUnvisitedScan();
+        return true;
+    }
+    inline common::nodeID_t getNextUnvisitedNodeID() final {
+        return visitedNodes->getNextUnvisitedNodeID();
+    }
+
 private:
     uint32_t minDistance; // Min distance to add dst nodes that have been reached.
     uint64_t numVisitedDstNodes;
-    frontier::node_id_map_t<int64_t> visitedNodeToDistance;
+    VisitedNodes* visitedNodes;
 };
 
 } // namespace processor
@@ -40,12 +40,17 @@ private:
 class BaseBFSState {
 public:
     explicit BaseBFSState(uint8_t upperBound, TargetDstNodes* targetDstNodes)
-        : upperBound{upperBound}, currentLevel{0}, nextNodeIdxToExtend{0}, targetDstNodes{
-                                                                               targetDstNodes} {}
+        : upperBound{upperBound}, currentLevel{0}, nextNodeIdxToExtend{0},
+          targetDstNodes{targetDstNodes}, bottomUpEnabled{false}, bottomUp{false} {}
     virtual ~BaseBFSState() = default;
 
-    // Get next node offset to extend from current level.
+    // Get next node offset to extend from current level. If the current level is extended
+    // bottom-up, this is the next node that hasn't been visited, which is extended backwards to
+    // find its neighbors in the current frontier.
     common::nodeID_t getNextNodeID() {
+        if (bottomUp) {
+            return getNextUnvisitedNodeID();
+        }
         if (nextNodeIdxToExtend == currentFrontier->nodeIDs.size()) {
             return common::nodeID_t{common::INVALID_OFFSET, common::INVALID_TABLE_ID};
         }
@@ -55,6 +60,7 @@ public:
     virtual void resetState() {
         currentLevel = 0;
         nextNodeIdxToExtend = 0;
+        bottomUp = false;
         frontiers.clear();
         initStartFrontier();
         addNextFrontier();
@@ -69,10 +75,24 @@ public:
     }
 
     inline void finalizeCurrentLevel() { moveNextLevelAsCurrentLevel(); }
-    inline size_t getNumFrontiers() const { return frontiers.size(); }
-    inline Frontier* getFrontier(common::vector_idx_t idx) const { return frontiers[idx].get(); }
+    inline const std::vector<std::unique_ptr<Frontier>>& getFrontiers() const {
+        return frontiers;
+    }
+
+    // Direction-optimizing BFS. Levels with a large frontier compared to the number of nodes that
+    // haven't been visited yet can be extended bottom-up, i.e. from the unvisited nodes to their
+    // neighbors in the current frontier. This requires states that track visited nodes, and a
+    // recursive plan that extends in the reverse direction.
+    inline void enableBottomUp() { bottomUpEnabled = true; }
+    inline bool isBottomUp() const { return bottomUp; }
+    virtual bool isInCurrentFrontier(common::nodeID_t /*nodeID*/) const { KU_UNREACHABLE; }
 
 protected:
+    // Decides whether to extend the current level bottom-up, and prepares the scan of unvisited
+    // nodes if so.
+    virtual bool startBottomUpLevel() { return false; }
+    virtual common::nodeID_t getNextUnvisitedNodeID() { KU_UNREACHABLE; }
+
     inline bool isCurrentFrontierEmpty() const { return currentFrontier->nodeIDs.empty(); }
     inline bool isUpperBoundReached() const { return currentLevel == upperBound; }
     inline void initStartFrontier() {
@@ -88,9 +108,14 @@ protected:
         currentFrontier = nextFrontier;
         currentLevel++;
         nextNodeIdxToExtend = 0;
+        bottomUp = false;
         if (currentLevel < upperBound) { // No need to sort if we are not extending further.
             addNextFrontier();
-            std::sort(currentFrontier->nodeIDs.begin(), currentFrontier->nodeIDs.end());
+            // Levels extended bottom-up add nodes in sorted order.
+            if (!std::is_sorted(currentFrontier->nodeIDs.begin(), currentFrontier->nodeIDs.end())) {
+                std::sort(currentFrontier->nodeIDs.begin(), currentFrontier->nodeIDs.end());
+            }
+            bottomUp = bottomUpEnabled && startBottomUpLevel();
         }
     }
 
@@ -105,6 +130,9 @@ protected:
     std::vector<std::unique_ptr<Frontier>> frontiers;
     // Target information.
     TargetDstNodes* targetDstNodes;
+    // Direction information.
+    bool bottomUpEnabled;
+    bool bottomUp;
 };
 
 } // namespace processor
@@ -36,6 +36,8 @@ public:
     void addEdge(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID, common::nodeID_t relID);
 
     void addNodeWithMultiplicity(common::nodeID_t nodeID, uint64_t multiplicity);
+    // Adds a node with multiplicity 1. The caller must make sure the node is only added once.
+    inline void addNode(common::nodeID_t nodeID) { nodeIDs.push_back(nodeID); }
 
     inline uint64_t getMultiplicity(common::nodeID_t nodeID) const {
         return nodeIDToMultiplicity.empty() ? 1 : nodeIDToMultiplicity.at(nodeID);
@@ -24,7 +24,7 @@ public:
     size_t scan(RecursiveJoinVectors* vectors, common::sel_t& vectorPos,
         common::sel_t& nodeIDDataVectorPos, common::sel_t& relIDDataVectorPos);
 
-    void resetState(const BaseBFSState& bfsState);
+    void resetState(const std::vector<std::unique_ptr<Frontier>>& frontiers_);
 
 protected:
     virtual void initScanFromDstOffset() = 0;
@@ -91,17 +91,24 @@ private:
 
 /*
  * DstNodeWithMultiplicityScanner scans dst node offset & length of path and repeat it for
- * multiplicity times in value vector.
+ * multiplicity times in value vector. Frontiers are not modified, so that the frontiers of a
+ * multi-source BFS can be scanned more than once.
  */
 class DstNodeWithMultiplicityScanner : public BaseFrontierScanner {
 public:
     DstNodeWithMultiplicityScanner(TargetDstNodes* targetDstNodes, size_t k)
-        : BaseFrontierScanner{targetDstNodes, k} {}
+        : BaseFrontierScanner{targetDstNodes, k}, multiplicity{0} {}
 
 private:
-    inline void initScanFromDstOffset() final {}
+    inline void initScanFromDstOffset() final {
+        multiplicity = frontiers[k]->getMultiplicity(currentDstNodeID);
+    }
     void scanFromDstOffset(RecursiveJoinVectors* vectors, common::sel_t& vectorPos,
         common::sel_t& nodeIDDataVectorPos, common::sel_t& relIDDataVectorPos) final;
+
+private:
+    // Number of times left to write the current dst node.
+    uint64_t multiplicity;
 };
 
 /*
@@ -124,10 +131,10 @@ struct FrontiersScanner {
     void scan(RecursiveJoinVectors* vectors, common::sel_t& vectorPos,
         common::sel_t& nodeIDDataVectorPos, common::sel_t& relIDDataVectorPos);
 
-    inline void resetState(const BaseBFSState& bfsState) {
+    inline void resetState(const std::vector<std::unique_ptr<Frontier>>& frontiers) {
         cursor = 0;
         for (auto& scanner : scanners) {
-            scanner->resetState(bfsState);
+            scanner->resetState(frontiers);
         }
     }
 };
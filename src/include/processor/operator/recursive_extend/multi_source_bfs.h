@@ -0,0 +1,95 @@
+#pragma once
+
+#include "frontier.h"
+
+namespace kuzu {
+namespace processor {
+
+/*
+ * MultiSourceBFS computes shortest path BFSs from a batch of up to 64 sources at once (MS-BFS).
+ * The BFS states of a node are 64-bit words, in which the i-th bit belongs to the i-th source of
+ * the batch. Extending a node once advances the BFSs of all sources that have the node in their
+ * current frontier, so a node reached by many sources is only extended once per level.
+ *
+ * A batch consists of the 64 consecutive offsets (aligned to 64) of the source node table that
+ * contain a given source node. Sources are expected to arrive in offset order, e.g. from a scan of
+ * the source node table, so that consecutive sources are answered from the same batch. The words
+ * are kept in dense arrays indexed by node offset, one for each node table that can be visited.
+ *
+ * Once a batch is complete, the nodes visited at each level are distributed to per-source
+ * frontiers, so that they can be scanned in the same way as the frontiers of a single source BFS.
+ * Only node IDs are tracked, i.e., this serves shortest path queries that don't track paths.
+ */
+class MultiSourceBFS {
+    struct NodeTableState {
+        // Sources that have visited a node so far.
+        std::vector<uint64_t> seen;
+        // Sources that have a node in their current frontier.
+        std::vector<uint64_t> visit;
+        // Sources that have a node in their next frontier.
+        std::vector<uint64_t> visitNext;
+
+        explicit NodeTableState(common::offset_t numNodes)
+            : seen(numNodes, 0), visit(numNodes, 0), visitNext(numNodes, 0) {}
+    };
+
+public:
+    static constexpr uint64_t NUM_SOURCES_PER_BATCH = 64;
+
+    explicit MultiSourceBFS(uint8_t upperBound)
+        : upperBound{upperBound}, currentLevel{0}, nextNodeIdxToExtend{0}, boundNodeVisit{0},
+          srcTableID{common::INVALID_TABLE_ID}, firstSrcOffset{common::INVALID_OFFSET},
+          numSources{0} {}
+
+    // Allocates the dense states of a node table that can be visited during the BFS.
+    void addNodeTable(common::table_id_t tableID, common::offset_t numNodes);
+
+    inline bool containsSource(common::nodeID_t nodeID) const {
+        return nodeID.tableID == srcTableID && nodeID.offset >= firstSrcOffset &&
+               nodeID.offset < firstSrcOffset + numSources;
+    }
+    // Starts a new batch with the sources around the given source node.
+    void resetState(common::nodeID_t srcNodeID);
+    inline bool isComplete() const {
+        return currentNodeIDs.empty() || currentLevel == upperBound;
+    }
+
+    // Get next node to extend from current level.
+    common::nodeID_t getNextNodeID();
+    void markVisited(common::nodeID_t nbrNodeID);
+    void finalizeCurrentLevel();
+
+    inline const std::vector<std::unique_ptr<Frontier>>& getFrontiers(
+        common::nodeID_t srcNodeID) const {
+        KU_ASSERT(containsSource(srcNodeID));
+        return sourceFrontiers[srcNodeID.offset - firstSrcOffset];
+    }
+
+private:
+    inline NodeTableState& getNodeTableState(common::table_id_t tableID) {
+        KU_ASSERT(nodeTableStates.contains(tableID));
+        return *nodeTableStates.at(tableID);
+    }
+    void addNodeToSourceFrontiers(common::nodeID_t nodeID, uint64_t sources);
+
+private:
+    uint8_t upperBound;
+    uint8_t currentLevel;
+    uint64_t nextNodeIdxToExtend;
+    uint64_t boundNodeVisit;
+    std::unordered_map<common::table_id_t, std::unique_ptr<NodeTableState>> nodeTableStates;
+    // Nodes with at least one source bit in visit and visitNext respectively.
+    std::vector<common::nodeID_t> currentNodeIDs;
+    std::vector<common::nodeID_t> nextNodeIDs;
+    // All nodes visited in the current batch, so that their states can be cleared without
+    // scanning the dense arrays.
+    std::vector<common::nodeID_t> visitedNodeIDs;
+    // Batch information.
+    common::table_id_t srcTableID;
+    common::offset_t firstSrcOffset;
+    uint64_t numSources;
+    std::vector<std::unique_ptr<Frontier>> sourceFrontiers[NUM_SOURCES_PER_BATCH];
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -3,6 +3,8 @@
 #include "bfs_state.h"
 #include "common/enums/query_rel_type.h"
 #include "frontier_scanner.h"
+#include "multi_source_bfs.h"
+#include "visited_nodes.h"
 #include "planner/operator/extend/recursive_join_type.h"
 #include "processor/operator/mask.h"
 #include "processor/operator/physical_operator.h"
@@ -31,6 +33,10 @@ struct RecursiveJoinDataInfo {
     DataPos recursiveDstNodeIDPos;
     std::unordered_set<common::table_id_t> recursiveDstNodeTableIDs;
     DataPos recursiveEdgeIDPos;
+    // Backward recursive join info. Only set if levels can be extended bottom-up.
+    std::unique_ptr<ResultSetDescriptor> bwdLocalResultSetDescriptor;
+    DataPos bwdRecursiveDstNodeIDPos;
+    DataPos bwdRecursiveEdgeIDPos;
     // Path info
     DataPos pathPos;
     std::unordered_map<common::table_id_t, std::string> tableIDToName;
@@ -51,9 +57,16 @@ struct RecursiveJoinDataInfo {
                                                                         std::move(tableIDToName)} {}
 
     inline std::unique_ptr<RecursiveJoinDataInfo> copy() {
-        return std::make_unique<RecursiveJoinDataInfo>(srcNodePos, dstNodePos, dstNodeTableIDs,
-            pathLengthPos, localResultSetDescriptor->copy(), recursiveDstNodeIDPos,
-            recursiveDstNodeTableIDs, recursiveEdgeIDPos, pathPos, tableIDToName);
+        auto result = std::make_unique<RecursiveJoinDataInfo>(srcNodePos, dstNodePos,
+            dstNodeTableIDs, pathLengthPos, localResultSetDescriptor->copy(),
+            recursiveDstNodeIDPos, recursiveDstNodeTableIDs, recursiveEdgeIDPos, pathPos,
+            tableIDToName);
+        if (bwdLocalResultSetDescriptor != nullptr) {
+            result->bwdLocalResultSetDescriptor = bwdLocalResultSetDescriptor->copy();
+            result->bwdRecursiveDstNodeIDPos = bwdRecursiveDstNodeIDPos;
+            result->bwdRecursiveEdgeIDPos = bwdRecursiveEdgeIDPos;
+        }
+        return result;
     }
 };
 
@@ -73,20 +86,25 @@ struct RecursiveJoinVectors {
 
     common::ValueVector* recursiveEdgeIDVector = nullptr;
     common::ValueVector* recursiveDstNodeIDVector = nullptr;
+    common::ValueVector* bwdRecursiveEdgeIDVector = nullptr;
+    common::ValueVector* bwdRecursiveDstNodeIDVector = nullptr;
 };
 
 class RecursiveJoin : public PhysicalOperator {
 public:
     RecursiveJoin(uint8_t lowerBound, uint8_t upperBound, common::QueryRelType queryRelType,
-        planner::RecursiveJoinType joinType, std::shared_ptr<RecursiveJoinSharedState> sharedState,
+        planner::RecursiveJoinType joinType, bool useMultiSourceBFS,
+        std::shared_ptr<RecursiveJoinSharedState> sharedState,
         std::unique_ptr<RecursiveJoinDataInfo> dataInfo, std::unique_ptr<PhysicalOperator> child,
         uint32_t id, const std::string& paramsString,
-        std::unique_ptr<PhysicalOperator> recursiveRoot)
+        std::unique_ptr<PhysicalOperator> recursiveRoot,
+        std::unique_ptr<PhysicalOperator> bwdRecursiveRoot)
         : PhysicalOperator{PhysicalOperatorType::RECURSIVE_JOIN, std::move(child), id,
               paramsString},
           lowerBound{lowerBound}, upperBound{upperBound}, queryRelType{queryRelType},
-          joinType{joinType}, sharedState{std::move(sharedState)}, dataInfo{std::move(dataInfo)},
-          recursiveRoot{std::move(recursiveRoot)} {}
+          joinType{joinType}, useMultiSourceBFS{useMultiSourceBFS},
+          sharedState{std::move(sharedState)}, dataInfo{std::move(dataInfo)},
+          recursiveRoot{std::move(recursiveRoot)}, bwdRecursiveRoot{std::move(bwdRecursiveRoot)} {}
 
     inline RecursiveJoinSharedState* getSharedState() const { return sharedState.get(); }
 
@@ -96,12 +114,14 @@ public:
 
     inline std::unique_ptr<PhysicalOperator> clone() final {
         return std::make_unique<RecursiveJoin>(lowerBound, upperBound, queryRelType, joinType,
-            sharedState, dataInfo->copy(), children[0]->clone(), id, paramsString,
-            recursiveRoot->clone());
+            useMultiSourceBFS, sharedState, dataInfo->copy(), children[0]->clone(), id,
+            paramsString, recursiveRoot->clone(),
+            bwdRecursiveRoot == nullptr ? nullptr : bwdRecursiveRoot->clone());
     }
 
 private:
     void initLocalRecursivePlan(ExecutionContext* context);
+    void initLocalBwdRecursivePlan(ExecutionContext* context);
 
     void populateTargetDstNodes(ExecutionContext* context);
 
@@ -109,14 +129,19 @@ private:
 
     // Compute BFS for a given src node.
     void computeBFS(ExecutionContext* context);
+    // Compute BFSs for the current batch of src nodes.
+    void computeMultiSourceBFS(ExecutionContext* context);
 
     void updateVisitedNodes(common::nodeID_t boundNodeID);
+    // Marks an unvisited node as visited from its neighbors in the current frontier.
+    void updateVisitedNodesBottomUp(common::nodeID_t nodeID);
 
 private:
     uint8_t lowerBound;
     uint8_t upperBound;
     common::QueryRelType queryRelType;
     planner::RecursiveJoinType joinType;
+    bool useMultiSourceBFS;
 
     std::shared_ptr<RecursiveJoinSharedState> sharedState;
     std::unique_ptr<RecursiveJoinDataInfo> dataInfo;
@@ -125,9 +150,15 @@ private:
     std::unique_ptr<ResultSet> localResultSet;
     std::unique_ptr<PhysicalOperator> recursiveRoot;
     ScanFrontier* scanFrontier;
+    // Local backward recursive plan
+    std::unique_ptr<ResultSet> bwdLocalResultSet;
+    std::unique_ptr<PhysicalOperator> bwdRecursiveRoot;
+    ScanFrontier* bwdScanFrontier;
 
     std::unique_ptr<RecursiveJoinVectors> vectors;
+    std::unique_ptr<VisitedNodes> visitedNodes;
     std::unique_ptr<BaseBFSState> bfsState;
+    std::unique_ptr<MultiSourceBFS> multiSourceBFS;
     std::unique_ptr<FrontiersScanner> frontiersScanner;
     std::unique_ptr<TargetDstNodes> targetDstNodes;
 };
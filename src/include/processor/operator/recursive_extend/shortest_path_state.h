@@ -1,6 +1,7 @@
 #pragma once
 
 #include "bfs_state.h"
+#include "visited_nodes.h"
 
 namespace kuzu {
 namespace processor {
@@ -8,8 +9,10 @@ namespace processor {
 template<bool TRACK_PATH>
 class ShortestPathState : public BaseBFSState {
 public:
-    ShortestPathState(uint8_t upperBound, TargetDstNodes* targetDstNodes)
-        : BaseBFSState{upperBound, targetDstNodes}, numVisitedDstNodes{0} {}
+    ShortestPathState(
+        uint8_t upperBound, TargetDstNodes* targetDstNodes, VisitedNodes* visitedNodes)
+        : BaseBFSState{upperBound, targetDstNodes}, numVisitedDstNodes{0}, visitedNodes{
+                                                                               visitedNodes} {}
     ~ShortestPathState() override = default;
 
     inline bool isComplete() final {
@@ -18,41 +21,57 @@ public:
     inline void resetState() final {
         BaseBFSState::resetState();
         numVisitedDstNodes = 0;
-        visited.clear();
+        visitedNodes->resetState();
     }
 
     inline void markSrc(common::nodeID_t nodeID) final {
-        visited.insert(nodeID);
+        visitedNodes->insert(nodeID, 0 /* level */);
         if (targetDstNodes->contains(nodeID)) {
             numVisitedDstNodes++;
         }
-        currentFrontier->addNodeWithMultiplicity(nodeID, 1);
+        currentFrontier->addNode(nodeID);
     }
 
     inline void markVisited(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID,
         common::nodeID_t relID, uint64_t /*multiplicity*/) final {
-        if (visited.contains(nbrNodeID)) {
+        if (visitedNodes->contains(nbrNodeID)) {
             return;
         }
-        visited.insert(nbrNodeID);
+        visitedNodes->insert(nbrNodeID, currentLevel + 1);
         if (targetDstNodes->contains(nbrNodeID)) {
             numVisitedDstNodes++;
         }
         if constexpr (TRACK_PATH) {
             nextFrontier->addEdge(boundNodeID, nbrNodeID, relID);
         } else {
-            nextFrontier->addNodeWithMultiplicity(nbrNodeID, 1);
+            nextFrontier->addNode(nbrNodeID);
         }
     }
 
+    inline bool isInCurrentFrontier(common::nodeID_t nodeID) const final {
+        return visitedNodes->contains(nodeID) && visitedNodes->getLevel(nodeID) == currentLevel;
+    }
+
 private:
     inline bool isAllDstReached() const {
         return numVisitedDstNodes == targetDstNodes->getNumNodes();
     }
 
+    inline bool startBottomUpLevel() final {
+        if (!visitedNodes->isDense() ||
+            currentFrontier->nodeIDs.size() <= visitedNodes->getNumUnvisited()) {
+            return false;
+        }
+        visitedNodes->initUnvisitedScan();
+        return true;
+    }
+    inline common::nodeID_t getNextUnvisitedNodeID() final {
+        return visitedNodes->getNextUnvisitedNodeID();
+    }
+
 private:
     uint64_t numVisitedDstNodes;
-    frontier::node_id_set_t visited;
+    VisitedNodes* visitedNodes;
 };
 
 } // namespace processor
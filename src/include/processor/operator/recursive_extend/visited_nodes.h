@@ -0,0 +1,89 @@
+#pragma once
+
+#include <algorithm>
+
+#include "frontier.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+namespace kuzu {
+namespace processor {
+
+/*
+ * VisitedNodes tracks the nodes visited by a single source BFS, together with the level (i.e. the
+ * length of the shortest path from the source) at which each node has been visited.
+ *
+ * A BFS starts with a hash map, which is cheap to clear when only a few nodes are visited. Once
+ * a large enough fraction of the nodes has been visited, it switches to dense arrays indexed by
+ * node offset: a visited bitmap and a level array for each node table. Dense arrays are allocated
+ * from the MemoryManager in blocks, on demand, and are kept across BFSs so that they only need to
+ * be zeroed when reused.
+ */
+class VisitedNodes {
+    struct NodeTableArrays {
+        common::offset_t numNodes;
+        std::vector<std::unique_ptr<storage::MemoryBuffer>> bitmapBlocks;
+        std::vector<std::unique_ptr<storage::MemoryBuffer>> levelBlocks;
+
+        explicit NodeTableArrays(common::offset_t numNodes);
+    };
+
+public:
+    // Switch to dense arrays once at least 1/DENSE_RATIO of all nodes are visited.
+    static constexpr uint64_t DENSE_RATIO = 32;
+    static constexpr uint64_t NUM_NODES_PER_BITMAP_BLOCK =
+        common::BufferPoolConstants::PAGE_256KB_SIZE * 8;
+    static constexpr uint64_t NUM_NODES_PER_LEVEL_BLOCK =
+        common::BufferPoolConstants::PAGE_256KB_SIZE;
+
+    VisitedNodes(storage::MemoryManager* memoryManager,
+        const std::vector<std::pair<common::table_id_t, common::offset_t>>& tableIDAndNumNodes);
+
+    void resetState();
+
+    bool contains(common::nodeID_t nodeID) const;
+    // Level of a visited node.
+    uint8_t getLevel(common::nodeID_t nodeID) const;
+    void insert(common::nodeID_t nodeID, uint8_t level);
+
+    inline bool isDense() const { return dense; }
+    inline uint64_t getNumVisited() const { return numVisited; }
+    inline uint64_t getNumUnvisited() const { return numNodes - numVisited; }
+
+    // Scans the nodes that are not visited yet in the order of their IDs. Only available once the
+    // dense arrays are used.
+    void initUnvisitedScan();
+    common::nodeID_t getNextUnvisitedNodeID();
+
+private:
+    void switchToDense();
+
+    inline NodeTableArrays& getArrays(common::table_id_t tableID) {
+        return *tableArrays[getTableIdx(tableID)];
+    }
+    inline const NodeTableArrays& getArrays(common::table_id_t tableID) const {
+        return *tableArrays[getTableIdx(tableID)];
+    }
+    inline common::vector_idx_t getTableIdx(common::table_id_t tableID) const {
+        auto it = std::lower_bound(tableIDs.begin(), tableIDs.end(), tableID);
+        KU_ASSERT(it != tableIDs.end() && *it == tableID);
+        return it - tableIDs.begin();
+    }
+    static bool isVisitedInBitmap(const NodeTableArrays& arrays, common::offset_t offset);
+    uint8_t* getLevelToWrite(NodeTableArrays& arrays, common::offset_t offset);
+
+private:
+    storage::MemoryManager* memoryManager;
+    // Node tables sorted by table ID.
+    std::vector<common::table_id_t> tableIDs;
+    std::vector<std::unique_ptr<NodeTableArrays>> tableArrays;
+    uint64_t numNodes;
+    uint64_t numVisited;
+    bool dense;
+    frontier::node_id_map_t<uint8_t> visitedNodeToLevel;
+    // Unvisited node scan state.
+    common::vector_idx_t scanTableIdx;
+    common::offset_t scanOffset;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -9,9 +9,12 @@ namespace processor {
 // Note: This class is not thread-safe. It relies on its caller to correctly synchronize its state.
 class NodeTableScanState {
 public:
-    explicit NodeTableScanState(storage::NodeTable* table)
+    NodeTableScanState(
+        storage::NodeTable* table, std::vector<storage::ZoneMapPredicate> zoneMapPredicates)
         : table{table}, maxNodeOffset{common::INVALID_OFFSET}, maxMorselIdx{UINT64_MAX},
-          currentNodeOffset{0}, semiMask{std::make_unique<NodeOffsetAndMorselSemiMask>(table)} {}
+          currentNodeOffset{0}, semiMask{std::make_unique<NodeOffsetAndMorselSemiMask>(table)},
+          zoneMapPredicates{std::move(zoneMapPredicates)},
+          lastCheckedNodeGroupIdx{common::INVALID_NODE_GROUP_IDX} {}
 
     inline storage::NodeTable* getTable() { return table; }
 
@@ -23,7 +26,9 @@ public:
     inline bool isSemiMaskEnabled() { return semiMask->isEnabled(); }
     inline NodeOffsetAndMorselSemiMask* getSemiMask() { return semiMask.get(); }
 
-    std::pair<common::offset_t, common::offset_t> getNextRangeToRead();
+    // Node groups whose zone maps rule out any of the predicates are skipped as a whole.
+    std::pair<common::offset_t, common::offset_t> getNextRangeToRead(
+        transaction::Transaction* transaction);
 
 private:
     storage::NodeTable* table;
@@ -31,21 +36,26 @@ private:
     common::offset_t maxMorselIdx;
     common::offset_t currentNodeOffset;
     std::unique_ptr<NodeOffsetAndMorselSemiMask> semiMask;
+    std::vector<storage::ZoneMapPredicate> zoneMapPredicates;
+    common::node_group_idx_t lastCheckedNodeGroupIdx;
 };
 
 class ScanNodeIDSharedState {
 public:
     ScanNodeIDSharedState() : currentStateIdx{0} {};
 
-    inline void addTableState(storage::NodeTable* table) {
-        tableStates.push_back(std::make_unique<NodeTableScanState>(table));
+    inline void addTableState(
+        storage::NodeTable* table, std::vector<storage::ZoneMapPredicate> zoneMapPredicates) {
+        tableStates.push_back(
+            std::make_unique<NodeTableScanState>(table, std::move(zoneMapPredicates)));
     }
     inline uint32_t getNumTableStates() const { return tableStates.size(); }
     inline NodeTableScanState* getTableState(uint32_t idx) const { return tableStates[idx].get(); }
 
     void initialize(transaction::Transaction* transaction);
 
-    std::tuple<NodeTableScanState*, common::offset_t, common::offset_t> getNextRangeToRead();
+    std::tuple<NodeTableScanState*, common::offset_t, common::offset_t> getNextRangeToRead(
+        transaction::Transaction* transaction);
 
     uint64_t getNumNodes() const { return numNodes; }
     uint64_t getNumNodesScanned() const { return numNodesScanned; }
@@ -63,7 +73,7 @@ public:
     ScanNodeID(const DataPos& outDataPos, std::shared_ptr<ScanNodeIDSharedState> sharedState,
         uint32_t id, const std::string& paramsString)
         : PhysicalOperator{PhysicalOperatorType::SCAN_NODE_ID, id, paramsString},
-          outDataPos{outDataPos}, sharedState{std::move(sharedState)} {}
+          outDataPos{outDataPos}, sharedState{std::move(sharedState)}, yielded{false} {}
 
     bool isSource() const override { return true; }
 
@@ -91,6 +101,8 @@ private:
     DataPos outDataPos;
     std::shared_ptr<ScanNodeIDSharedState> sharedState;
     std::shared_ptr<common::ValueVector> outValueVector;
+    // Set once the thread running this operator has left the pipeline to work on another task.
+    bool yielded;
 };
 
 } // namespace processor
@@ -26,7 +26,10 @@ public:
     inline void execute(ResultSet* resultSet, ExecutionContext* context) {
         initLocalState(resultSet, context);
         metrics->executionTime.start();
-        executeInternal(context);
+        {
+            common::ResourceMetricScope resourceScope{metrics->resources};
+            executeInternal(context);
+        }
         metrics->executionTime.stop();
     }
 
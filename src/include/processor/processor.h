@@ -1,6 +1,7 @@
 #pragma once
 
 #include "common/task_system/task_scheduler.h"
+#include "processor/admission_controller.h"
 #include "processor/physical_plan.h"
 #include "processor/result/factorized_table.h"
 
@@ -14,6 +15,10 @@ public:
 
     std::shared_ptr<FactorizedTable> execute(PhysicalPlan* physicalPlan, ExecutionContext* context);
 
+    inline AdmissionController* getAdmissionController() const {
+        return admissionController.get();
+    }
+
 private:
     void decomposePlanIntoTask(PhysicalOperator* op, common::Task* task, ExecutionContext* context);
 
@@ -21,6 +26,7 @@ private:
 
 private:
     std::unique_ptr<common::TaskScheduler> taskScheduler;
+    std::unique_ptr<AdmissionController> admissionController;
 };
 
 } // namespace processor
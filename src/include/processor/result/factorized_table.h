@@ -82,6 +82,7 @@ public:
     inline bool isEmpty() { return blocks.empty(); }
     inline std::vector<std::unique_ptr<DataBlock>>& getBlocks() { return blocks; }
     inline DataBlock* getBlock(ft_block_idx_t blockIdx) { return blocks[blockIdx].get(); }
+    inline uint64_t getNumBlocks() const { return blocks.size(); }
 
     void merge(DataBlockCollection& other);
 
@@ -257,6 +258,8 @@ public:
     bool isNonOverflowColNull(const uint8_t* nullBuffer, ft_col_idx_t colIdx) const;
     void setNonOverflowColNull(uint8_t* nullBuffer, ft_col_idx_t colIdx);
     void clear();
+    // Size of the memory blocks allocated for tuples and their overflow data.
+    uint64_t getMemoryUsage() const;
 
 private:
     void setOverflowColNull(uint8_t* nullBuffer, ft_col_idx_t colIdx, ft_tuple_idx_t tupleIdx);
@@ -339,6 +342,11 @@ public:
 
     void getNextFlatTuple();
 
+    // Moves over up to numTuples flat tuples without reading them and returns the number of flat
+    // tuples moved over, the first of which is the tuple at startTupleIdx. Only used for tables
+    // without unflat columns, in which each tuple is a single flat tuple.
+    uint64_t skipFlatTuples(uint64_t numTuples, ft_tuple_idx_t& startTupleIdx);
+
     void resetState();
 
 private:
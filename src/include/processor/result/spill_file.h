@@ -0,0 +1,73 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/serializer/buffered_file.h"
+#include "common/vector/value_vector.h"
+
+namespace kuzu {
+namespace common {
+class VirtualFileSystem;
+}
+
+namespace processor {
+
+// A temporary file that operators spill rows of values to when their intermediate results don't
+// fit in memory. Values are written in a compact binary format without their types, so they must
+// be read back into vectors of the same types they were written from. The file is removed when the
+// SpillFile is destructed. A SpillFile is written by a single thread, and can be read by multiple
+// SpillFileReaders once all rows have been written.
+class SpillFile {
+    friend class SpillFileReader;
+
+public:
+    SpillFile(common::VirtualFileSystem* vfs, const std::string& directory);
+    ~SpillFile();
+
+    void writeValue(const common::ValueVector& vector, uint32_t pos);
+    template<typename T>
+    inline void write(const T& value) {
+        writer->write(reinterpret_cast<const uint8_t*>(&value), sizeof(T));
+    }
+    inline void write(const uint8_t* data, uint64_t size) { writer->write(data, size); }
+    // Rows are only counted, so readers know how many rows to read back.
+    inline void finishRow() { numRows++; }
+    // Flushes the written rows to the file. No rows can be written afterwards.
+    inline void finishWriting() { writer.reset(); }
+
+    inline uint64_t getNumRows() const { return numRows; }
+
+private:
+    common::VirtualFileSystem* vfs;
+    std::string path;
+    std::unique_ptr<common::BufferedFileWriter> writer;
+    uint64_t numRows;
+};
+
+// Reads the rows of a SpillFile in the order they were written.
+class SpillFileReader {
+public:
+    explicit SpillFileReader(const SpillFile& file);
+    ~SpillFileReader();
+
+    void readValue(common::ValueVector& vector, uint32_t pos);
+    template<typename T>
+    inline T read() {
+        T value;
+        reader->read(reinterpret_cast<uint8_t*>(&value), sizeof(T));
+        return value;
+    }
+    inline void read(uint8_t* data, uint64_t size) { reader->read(data, size); }
+
+private:
+    std::unique_ptr<common::BufferedFileReader> reader;
+    // Buffer to read strings into before they are added to a vector.
+    std::string stringBuffer;
+};
+
+using spill_files_t = std::vector<std::unique_ptr<SpillFile>>;
+
+} // namespace processor
+} // namespace kuzu
@@ -15,6 +15,9 @@ class BufferManager;
 // Keeps the state information of a page in a file.
 class PageState {
     static constexpr uint64_t DIRTY_MASK = 0x0080000000000000;
+    // Set on pages that the replacement policy considers frequently accessed. Cleared when the
+    // page is evicted.
+    static constexpr uint64_t HOT_MASK = 0x0040000000000000;
     static constexpr uint64_t STATE_MASK = 0xFF00000000000000;
     static constexpr uint64_t VERSION_MASK = 0x00FFFFFFFFFFFFFF;
     static constexpr uint64_t NUM_BITS_TO_SHIFT_FOR_STATE = 56;
@@ -81,6 +84,11 @@ public:
         stateAndVersion &= ~DIRTY_MASK;
     }
     inline bool isDirty() const { return stateAndVersion & DIRTY_MASK; }
+    inline void setHot() {
+        KU_ASSERT(getState(stateAndVersion.load()) == LOCKED);
+        stateAndVersion |= HOT_MASK;
+    }
+    inline bool isHot() const { return stateAndVersion & HOT_MASK; }
     uint64_t getStateAndVersion() const { return stateAndVersion.load(); }
 
     inline void resetToEvicted() {
@@ -3,68 +3,14 @@
 #include <functional>
 #include <vector>
 
+#include "common/metric.h"
 #include "storage/buffer_manager/bm_file_handle.h"
-#include "storage/buffer_manager/locked_queue.h"
+#include "storage/buffer_manager/page_prefetcher.h"
+#include "storage/buffer_manager/replacement_policy.h"
 
 namespace kuzu {
 namespace storage {
 
-// This class keeps state info for pages potentially can be evicted.
-// The page state of a candidate is set to MARKED when it is first enqueued. After enqueued, if the
-// candidate was recently accessed, it is no longer immediately evictable. See the state transition
-// diagram above `BufferManager` class declaration for more details.
-struct EvictionCandidate {
-    // If the candidate is Marked and its version is the same as the one kept inside the candidate,
-    // it is evictable.
-    inline bool isEvictable(uint64_t currPageStateAndVersion) const {
-        return PageState::getState(currPageStateAndVersion) == PageState::MARKED &&
-               PageState::getVersion(currPageStateAndVersion) == pageVersion;
-    }
-    // If the candidate was recently read optimistically, it is second chance evictable.
-    inline bool isSecondChanceEvictable(uint64_t currPageStateAndVersion) const {
-        return PageState::getState(currPageStateAndVersion) == PageState::UNLOCKED &&
-               PageState::getVersion(currPageStateAndVersion) == pageVersion;
-    }
-
-    BMFileHandle* fileHandle = nullptr;
-    common::page_idx_t pageIdx = common::INVALID_PAGE_IDX;
-    PageState* pageState = nullptr;
-    // The version of the corresponding page at the time the candidate is enqueued.
-    uint64_t pageVersion = -1u;
-
-    inline bool operator==(const EvictionCandidate& other) const {
-        return fileHandle == other.fileHandle && pageIdx == other.pageIdx &&
-               pageState == other.pageState && pageVersion == other.pageVersion;
-    }
-};
-
-class EvictionQueue {
-public:
-    EvictionQueue() { queue = std::make_unique<LockedQueue<EvictionCandidate>>(); }
-
-    inline void enqueue(EvictionCandidate& candidate) {
-        std::shared_lock sLck{mtx};
-        queue->enqueue(candidate);
-    }
-    inline void enqueue(BMFileHandle* fileHandle, common::page_idx_t pageIdx, PageState* pageState,
-        uint64_t pageVersion) {
-        std::shared_lock sLck{mtx};
-        queue->enqueue(EvictionCandidate{fileHandle, pageIdx, pageState, pageVersion});
-    }
-    inline bool dequeue(EvictionCandidate& candidate) {
-        std::shared_lock sLck{mtx};
-        return queue->try_dequeue(candidate);
-    }
-
-    void removeNonEvictableCandidates();
-
-    void removeCandidatesForFile(BMFileHandle& fileHandle);
-
-private:
-    std::shared_mutex mtx;
-    std::unique_ptr<LockedQueue<EvictionCandidate>> queue;
-};
-
 /**
  * The Buffer Manager (BM) is a centralized manager of database memory resources.
  * It provides two main functionalities:
@@ -94,6 +40,10 @@ private:
  * 2) it supports the caller to flush or remove pages from the BM;
  * 3) it supports the caller to directly update the content of a frame.
  *
+ * BM also supports read-ahead for sequential scans: callers can declare the pages they will read
+ * next through `prefetch()`, and these pages are read into frames by background I/O threads (see
+ * `PagePrefetcher`).
+ *
  * All accesses to the BM are through a FileHandle. This design is to de-centralize the management
  * of page states from the BM to each file handle itself. Thus each on-disk file should have a
  * unique BMFileHandle, and MM also holds a unique BMFileHandle, which is backed by an temp in-mem
@@ -111,8 +61,10 @@ private:
  * of `maxSize` for it. Each memory buffer is mapped to a unique PAGE_256KB_SIZE frame in that
  * region. Both disk pages and memory buffers are all managed by the BM to make sure that actually
  * used physical memory doesn't go beyond max size specified by users. Currently, the BM uses a
- * queue based replacement policy and the MADV_DONTNEED hint to explicitly control evictions. See
- * comments above `claimAFrame()` for more details.
+ * queue based replacement policy and the MADV_DONTNEED hint to explicitly control evictions. The
+ * replacement policy is chosen per database (see `common::EvictionPolicy`), and defaults to a
+ * single FIFO queue with second chance. See `ReplacementPolicy` and comments above `claimAFrame()`
+ * for more details.
  *
  * Page states in BM:
  * A page can be in one of the four states: a) LOCKED, b) UNLOCKED, c) MARKED, d) EVICTED.
@@ -161,11 +113,14 @@ private:
  */
 
 class BufferManager {
+    friend class PagePrefetcher;
+
 public:
     enum class PageReadPolicy : uint8_t { READ_PAGE = 0, DONT_READ_PAGE = 1 };
 
-    BufferManager(uint64_t bufferPoolSize, uint64_t maxDBSize);
-    ~BufferManager() = default;
+    BufferManager(uint64_t bufferPoolSize, uint64_t maxDBSize,
+        common::EvictionPolicy evictionPolicy = common::EvictionPolicy::FIFO);
+    ~BufferManager();
 
     uint8_t* pin(BMFileHandle& fileHandle, common::page_idx_t pageIdx,
         PageReadPolicy pageReadPolicy = PageReadPolicy::READ_PAGE);
@@ -173,6 +128,15 @@ public:
         const std::function<void(uint8_t*)>& func);
     // The function assumes that the requested page is already pinned.
     void unpin(BMFileHandle& fileHandle, common::page_idx_t pageIdx);
+    // Asynchronously reads the given pages into frames if they are not cached yet. The caller
+    // doesn't pin the pages, so they can be evicted again before being read.
+    inline void prefetch(
+        BMFileHandle& fileHandle, common::page_idx_t startPageIdx, common::page_idx_t numPages) {
+        prefetcher->prefetch(fileHandle, startPageIdx, numPages);
+    }
+    // Must be called before data files are modified outside of pin/unpin (e.g., checkpointing), so
+    // that no background read can bring stale pages into frames.
+    inline void cancelPrefetches() { prefetcher->cancelPendingRequests(); }
 
     // Currently, these functions are specifically used only for WAL files.
     void removeFilePagesFromFrames(BMFileHandle& fileHandle);
@@ -191,7 +155,15 @@ public:
     inline common::frame_group_idx_t addNewFrameGroup(common::PageSizeClass pageSizeClass) {
         return vmRegions[pageSizeClass]->addNewFrameGroup();
     }
-    inline void clearEvictionQueue() { evictionQueue = std::make_unique<EvictionQueue>(); }
+    void clearEvictionQueue();
+
+    inline uint64_t getBufferPoolSize() const { return bufferPoolSize.load(); }
+
+    // Number of pins and optimistic reads served from frames, and number of pages read from disk.
+    inline uint64_t getNumPageHits() const { return numPageHits.load(std::memory_order_relaxed); }
+    inline uint64_t getNumPageMisses() const {
+        return numPageMisses.load(std::memory_order_relaxed);
+    }
 
 private:
     static void verifySizeParams(uint64_t bufferPoolSize, uint64_t maxDBSize);
@@ -203,6 +175,10 @@ private:
 
     void cachePageIntoFrame(
         BMFileHandle& fileHandle, common::page_idx_t pageIdx, PageReadPolicy pageReadPolicy);
+    void prefetchPages(
+        BMFileHandle& fileHandle, common::page_idx_t startPageIdx, common::page_idx_t numPages);
+    void readPagesIntoFrames(
+        BMFileHandle& fileHandle, common::page_idx_t startPageIdx, common::page_idx_t numPages);
     void flushIfDirtyWithoutLock(BMFileHandle& fileHandle, common::page_idx_t pageIdx);
     void removePageFromFrame(
         BMFileHandle& fileHandle, common::page_idx_t pageIdx, bool shouldFlush);
@@ -210,6 +186,18 @@ private:
     void addToEvictionQueue(
         BMFileHandle* fileHandle, common::page_idx_t pageIdx, PageState* pageState);
 
+    // Page accesses are also counted for the calling thread, see ThreadResourceCounters.
+    inline void countPageHit() {
+        numPageHits.fetch_add(1, std::memory_order_relaxed);
+        common::ThreadResourceCounters::get().numPageHits++;
+    }
+    inline void countPageMiss(uint64_t numBytesRead) {
+        numPageMisses.fetch_add(1, std::memory_order_relaxed);
+        auto& counters = common::ThreadResourceCounters::get();
+        counters.numPageMisses++;
+        counters.numBytesRead += numBytesRead;
+    }
+
     inline uint64_t reserveUsedMemory(uint64_t size) { return usedMemory.fetch_add(size); }
     inline uint64_t freeUsedMemory(uint64_t size) {
         KU_ASSERT(usedMemory.load() >= size);
@@ -227,10 +215,15 @@ private:
     std::atomic<uint64_t> usedMemory;
     std::atomic<uint64_t> bufferPoolSize;
     std::atomic<uint64_t> numEvictionQueueInsertions;
+    std::atomic<uint64_t> numPageHits;
+    std::atomic<uint64_t> numPageMisses;
+    common::EvictionPolicy evictionPolicy;
     // Each VMRegion corresponds to a virtual memory region of a specific page size. Currently, we
     // hold two sizes of PAGE_4KB and PAGE_256KB.
     std::vector<std::unique_ptr<VMRegion>> vmRegions;
-    std::unique_ptr<EvictionQueue> evictionQueue;
+    std::unique_ptr<ReplacementPolicy> replacementPolicy;
+    // Declared last so that the I/O threads are stopped before other members are destructed.
+    std::unique_ptr<PagePrefetcher> prefetcher;
 };
 
 } // namespace storage
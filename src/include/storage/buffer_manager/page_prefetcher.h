@@ -0,0 +1,54 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace storage {
+
+class BMFileHandle;
+class BufferManager;
+
+// PagePrefetcher reads pages into frames on a small pool of dedicated I/O threads, so that
+// sequential scans can declare the page ranges they will read next and overlap the reads with
+// their own processing. Requests are served in FIFO order and are best effort: pages that are
+// already cached or pinned are skipped, and nothing is loaded if no frame can be claimed.
+// Pending requests must be cancelled (see `cancelPendingRequests`) before the content of data files
+// is changed underneath the buffer manager, e.g., during checkpointing.
+class PagePrefetcher {
+    struct PrefetchRequest {
+        BMFileHandle* fileHandle;
+        common::page_idx_t startPageIdx;
+        common::page_idx_t numPages;
+    };
+
+public:
+    PagePrefetcher(BufferManager* bm, uint64_t numThreads);
+    ~PagePrefetcher();
+
+    void prefetch(
+        BMFileHandle& fileHandle, common::page_idx_t startPageIdx, common::page_idx_t numPages);
+    // Drops all requests that are not yet started, and waits for the ones being served to finish.
+    void cancelPendingRequests();
+
+private:
+    void runWorkerThread();
+
+private:
+    BufferManager* bm;
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::condition_variable idleCV;
+    std::deque<PrefetchRequest> requests;
+    uint64_t numActiveRequests;
+    bool stopped;
+    std::vector<std::thread> workerThreads;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <deque>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "common/enums/eviction_policy.h"
+#include "storage/buffer_manager/bm_file_handle.h"
+#include "storage/buffer_manager/locked_queue.h"
+
+namespace kuzu {
+namespace storage {
+
+// This class keeps state info for pages potentially can be evicted.
+// The page state of a candidate is set to MARKED when it is first enqueued. After enqueued, if the
+// candidate was recently accessed, it is no longer immediately evictable. See the state transition
+// diagram above `BufferManager` class declaration for more details.
+struct EvictionCandidate {
+    // If the candidate is Marked and its version is the same as the one kept inside the candidate,
+    // it is evictable.
+    inline bool isEvictable(uint64_t currPageStateAndVersion) const {
+        return PageState::getState(currPageStateAndVersion) == PageState::MARKED &&
+               PageState::getVersion(currPageStateAndVersion) == pageVersion;
+    }
+    // If the candidate was recently read optimistically, it is second chance evictable.
+    inline bool isSecondChanceEvictable(uint64_t currPageStateAndVersion) const {
+        return PageState::getState(currPageStateAndVersion) == PageState::UNLOCKED &&
+               PageState::getVersion(currPageStateAndVersion) == pageVersion;
+    }
+
+    BMFileHandle* fileHandle = nullptr;
+    common::page_idx_t pageIdx = common::INVALID_PAGE_IDX;
+    PageState* pageState = nullptr;
+    // The version of the corresponding page at the time the candidate is enqueued.
+    uint64_t pageVersion = -1u;
+
+    inline bool operator==(const EvictionCandidate& other) const {
+        return fileHandle == other.fileHandle && pageIdx == other.pageIdx &&
+               pageState == other.pageState && pageVersion == other.pageVersion;
+    }
+};
+
+class EvictionQueue {
+public:
+    EvictionQueue() { queue = std::make_unique<LockedQueue<EvictionCandidate>>(); }
+
+    inline void enqueue(EvictionCandidate& candidate) {
+        std::shared_lock sLck{mtx};
+        queue->enqueue(candidate);
+    }
+    inline void enqueue(BMFileHandle* fileHandle, common::page_idx_t pageIdx, PageState* pageState,
+        uint64_t pageVersion) {
+        std::shared_lock sLck{mtx};
+        queue->enqueue(EvictionCandidate{fileHandle, pageIdx, pageState, pageVersion});
+    }
+    inline bool dequeue(EvictionCandidate& candidate) {
+        std::shared_lock sLck{mtx};
+        return queue->try_dequeue(candidate);
+    }
+
+    void removeNonEvictableCandidates();
+
+    void removeCandidatesForFile(BMFileHandle& fileHandle);
+
+private:
+    std::shared_mutex mtx;
+    std::unique_ptr<LockedQueue<EvictionCandidate>> queue;
+};
+
+// A ReplacementPolicy decides in which order unpinned pages are considered for eviction by
+// `BufferManager::claimAFrame()`. Pages are handed to the policy when they are unpinned, and the
+// buffer manager notifies the policy when a page is missed (i.e., read into a frame) and when a
+// page is evicted, so that the policy can keep track of access history.
+class ReplacementPolicy {
+public:
+    virtual ~ReplacementPolicy() = default;
+
+    static std::unique_ptr<ReplacementPolicy> create(
+        common::EvictionPolicy evictionPolicy, uint64_t bufferPoolSize);
+
+    // Adds the candidate to the queue it belongs to. Also used to move back second chance
+    // evictable candidates.
+    virtual void enqueue(EvictionCandidate& candidate) = 0;
+    // Returns the next candidate to be checked for eviction given the currently used memory.
+    virtual bool dequeue(EvictionCandidate& candidate, uint64_t usedMemory) = 0;
+    // Called when the page is read from disk into its frame. The page is LOCKED. Returns true if the
+    // page should be kept as a hot page.
+    virtual bool onPageMiss(BMFileHandle& /*fileHandle*/, common::page_idx_t /*pageIdx*/) {
+        return false;
+    }
+    // Called after the page has been removed from its frame.
+    virtual void onPageEvicted(
+        BMFileHandle& /*fileHandle*/, common::page_idx_t /*pageIdx*/, bool /*wasHot*/) {}
+
+    virtual void removeNonEvictableCandidates() = 0;
+    virtual void removeCandidatesForFile(BMFileHandle& fileHandle) = 0;
+};
+
+// The default policy. All candidates are kept in a single FIFO queue, where candidates that were
+// optimistically read since enqueued are given a second chance.
+class FIFOReplacementPolicy final : public ReplacementPolicy {
+public:
+    inline void enqueue(EvictionCandidate& candidate) override { queue.enqueue(candidate); }
+    inline bool dequeue(EvictionCandidate& candidate, uint64_t /*usedMemory*/) override {
+        return queue.dequeue(candidate);
+    }
+
+    inline void removeNonEvictableCandidates() override { queue.removeNonEvictableCandidates(); }
+    inline void removeCandidatesForFile(BMFileHandle& fileHandle) override {
+        queue.removeCandidatesForFile(fileHandle);
+    }
+
+private:
+    EvictionQueue queue;
+};
+
+// A variant of the 2Q policy from the paper "2Q: A Low Overhead High Performance Buffer Management
+// Replacement Algorithm" (https://www.vldb.org/conf/1994/P439.PDF).
+// Pages read into frames for the first time are put into a probationary queue. When a probationary
+// page is evicted, its identity is remembered in a bounded ghost queue. If a page is missed again
+// while it is still in the ghost queue, it is re-referenced at a distance longer than the
+// probationary residency, so it is read back as a hot page and put into the protected queue.
+// Eviction takes candidates from the probationary queue as long as probationary pages take more
+// than TWO_QUEUE_PROBATIONARY_RATIO of the buffer pool, and from the protected queue otherwise.
+// Pages touched only by one sequential scan never leave the probationary queue, thus cannot flush
+// hot pages, such as the CSR headers or hash index slots used by point lookups.
+// Note that repeated pins of a page while it is cached (e.g., consecutive vectors of a scan reading
+// the same page) are correlated references and don't promote the page.
+class TwoQueueReplacementPolicy final : public ReplacementPolicy {
+    struct GhostKey {
+        BMFileHandle* fileHandle;
+        common::page_idx_t pageIdx;
+
+        inline bool operator==(const GhostKey& other) const {
+            return fileHandle == other.fileHandle && pageIdx == other.pageIdx;
+        }
+    };
+    struct GhostKeyHasher {
+        inline std::size_t operator()(const GhostKey& key) const {
+            return std::hash<BMFileHandle*>()(key.fileHandle) ^
+                   (std::hash<common::page_idx_t>()(key.pageIdx) << 1);
+        }
+    };
+
+public:
+    explicit TwoQueueReplacementPolicy(uint64_t bufferPoolSize);
+
+    void enqueue(EvictionCandidate& candidate) override;
+    bool dequeue(EvictionCandidate& candidate, uint64_t usedMemory) override;
+    bool onPageMiss(BMFileHandle& fileHandle, common::page_idx_t pageIdx) override;
+    void onPageEvicted(BMFileHandle& fileHandle, common::page_idx_t pageIdx, bool wasHot) override;
+
+    void removeNonEvictableCandidates() override;
+    void removeCandidatesForFile(BMFileHandle& fileHandle) override;
+
+private:
+    uint64_t maxProbationaryMemory;
+    uint64_t maxNumGhostEntries;
+    // Memory taken by cached pages that are hot (in the protected queue).
+    std::atomic<uint64_t> protectedMemory;
+    EvictionQueue probationaryQueue;
+    EvictionQueue protectedQueue;
+    // Ghost entries are kept in FIFO order together with a sequence number, so that entries removed
+    // from the map (because they were re-referenced) can be recognized as stale in the queue.
+    std::mutex ghostMtx;
+    uint64_t nextGhostSeq;
+    std::deque<std::pair<GhostKey, uint64_t>> ghostQueue;
+    std::unordered_map<GhostKey, uint64_t, GhostKeyHasher> ghostEntries;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -28,6 +28,8 @@ enum class CompressionType : uint8_t {
     INTEGER_BITPACKING = 1,
     BOOLEAN_BITPACKING = 2,
     CONSTANT = 3,
+    INTEGER_DELTA_BITPACKING = 4,
+    ALP = 5,
 };
 
 struct CompressionMetadata {
@@ -271,6 +273,145 @@ protected:
     }
 };
 
+// Delta encoding for sorted or nearly sorted integers, e.g., CSR offsets, neighbour IDs and
+// monotonically increasing IDs. The difference between each value and its predecessor is reduced by
+// the minimum difference in the chunk and bitpacked. The compression metadata uses the layout of
+// BitpackHeader, with the offset holding the minimum difference.
+// Each page starts with the value preceding its first value, so that pages can be decompressed
+// independently. Reading from the middle of a page requires summing up the differences before it,
+// and updating a value changes the following ones, so values are never updated in place.
+template<typename T>
+class IntegerDeltaBitpacking : public CompressionAlg {
+    using U = std::make_unsigned_t<T>;
+    using S = std::make_signed_t<T>;
+    static constexpr uint64_t CHUNK_SIZE = 32;
+
+public:
+    static constexpr uint64_t PAGE_HEADER_SIZE = sizeof(uint64_t);
+
+    IntegerDeltaBitpacking() = default;
+    IntegerDeltaBitpacking(const IntegerDeltaBitpacking&) = default;
+
+    void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
+        uint8_t* dstBuffer, common::offset_t dstOffset, common::offset_t numValues,
+        const CompressionMetadata& metadata) const final;
+
+    BitpackHeader getBitWidth(const uint8_t* srcBuffer, uint64_t numValues) const;
+
+    static inline uint64_t numValues(uint64_t dataSize, const BitpackHeader& header) {
+        KU_ASSERT(header.bitWidth > 0);
+        if (dataSize <= PAGE_HEADER_SIZE) {
+            return 0;
+        }
+        auto numValues = (dataSize - PAGE_HEADER_SIZE) * 8 / header.bitWidth;
+        numValues -= numValues % CHUNK_SIZE;
+        return numValues;
+    }
+
+    CompressionMetadata getCompressionMetadata(
+        const uint8_t* srcBuffer, uint64_t numValues) const override {
+        auto header = getBitWidth(srcBuffer, numValues);
+        if (header.bitWidth >= sizeof(T) * 8) {
+            return CompressionMetadata();
+        }
+        return CompressionMetadata(CompressionType::INTEGER_DELTA_BITPACKING, header.getData());
+    }
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const struct CompressionMetadata& metadata) const final;
+
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues,
+        const struct CompressionMetadata& metadata) const final;
+};
+
+// Serialized as five bytes: the exponent, the factor and the bit width, followed by the maximum
+// number of exceptions stored in a page as a uint16_t.
+struct AlpHeader {
+    uint8_t exponent;
+    uint8_t factor;
+    uint8_t bitWidth;
+    uint16_t maxNumExceptions;
+
+    std::array<uint8_t, CompressionMetadata::DATA_SIZE> getData() const;
+
+    static AlpHeader readHeader(const std::array<uint8_t, CompressionMetadata::DATA_SIZE>& data);
+};
+
+// Lossless compression of DOUBLE and FLOAT values based on the paper "ALP: Adaptive Lossless
+// floating-Point Compression" (https://dl.acm.org/doi/pdf/10.1145/3626717).
+// Values which were decimals before being converted to floating point (e.g., sensor readings and
+// prices) are encoded as integers by multiplying them with 10^(exponent - factor), where the
+// exponent and the factor are chosen for the whole chunk from a sample of its values. Encoded
+// integers are bitpacked with a frame of reference per page. Values that don't convert back to
+// the exact same bits (e.g., NaN, infinity, -0.0 or values with too many significant digits) are
+// stored uncompressed as exceptions, which are patched after decoding.
+// The page layout is the page header (the frame of reference and the number of exceptions), the
+// exception positions, the exception values and then the bitpacked values. The exception space is
+// reserved for the maximum number of exceptions in any page of the chunk, so that all pages hold
+// the same number of values.
+template<typename T>
+class FloatCompression : public CompressionAlg {
+    static_assert(std::is_same_v<T, double> || std::is_same_v<T, float>);
+    static constexpr uint64_t CHUNK_SIZE = 32;
+
+public:
+    static constexpr uint64_t PAGE_HEADER_SIZE = sizeof(int64_t) + sizeof(uint64_t);
+    static constexpr uint8_t MAX_EXPONENT = std::is_same_v<T, double> ? 18 : 10;
+
+    FloatCompression() = default;
+    FloatCompression(const FloatCompression&) = default;
+
+    void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
+        uint8_t* dstBuffer, common::offset_t dstOffset, common::offset_t numValues,
+        const CompressionMetadata& metadata) const final;
+
+    static inline uint64_t getExceptionsSize(const AlpHeader& header) {
+        return header.maxNumExceptions * (sizeof(uint16_t) + sizeof(T));
+    }
+
+    static inline uint64_t numValues(uint64_t dataSize, const AlpHeader& header) {
+        KU_ASSERT(header.bitWidth > 0);
+        if (dataSize <= PAGE_HEADER_SIZE + getExceptionsSize(header)) {
+            return 0;
+        }
+        auto numValues = (dataSize - PAGE_HEADER_SIZE - getExceptionsSize(header)) * 8 /
+                         header.bitWidth;
+        numValues -= numValues % CHUNK_SIZE;
+        return numValues;
+    }
+
+    CompressionMetadata getCompressionMetadata(
+        const uint8_t* srcBuffer, uint64_t numValues) const override;
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const struct CompressionMetadata& metadata) const final;
+
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues,
+        const struct CompressionMetadata& metadata) const final;
+
+    // Returns false if the value can't be encoded with the given exponent and factor, in which case
+    // it has to be stored as an exception.
+    static bool encode(T value, uint8_t exponent, uint8_t factor, int64_t& encoded);
+    static inline T decode(int64_t encoded, uint8_t exponent, uint8_t factor) {
+        return static_cast<T>(encoded) * POW10[factor] * NEG_POW10[exponent];
+    }
+
+private:
+    // Chooses the exponent and the factor from a sample of the values.
+    static std::pair<uint8_t, uint8_t> findExponentAndFactor(
+        const T* values, uint64_t numValues);
+
+private:
+    static constexpr T POW10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+    static constexpr T NEG_POW10[] = {1e0, 1e-1, 1e-2, 1e-3, 1e-4, 1e-5, 1e-6, 1e-7, 1e-8, 1e-9,
+        1e-10, 1e-11, 1e-12, 1e-13, 1e-14, 1e-15, 1e-16, 1e-17, 1e-18};
+};
+
 class BooleanBitpacking : public CompressionAlg {
 public:
     BooleanBitpacking() = default;
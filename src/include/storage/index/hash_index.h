@@ -62,6 +62,12 @@ public:
     using Key =
         typename std::conditional<std::same_as<T, common::ku_string_t>, std::string_view, T>::type;
     bool lookupInternal(transaction::Transaction* transaction, Key key, common::offset_t& result);
+    // Looks up a batch of keys whose hashes are already computed. Keys that reach the persistent
+    // index are probed in primary slot order, after the pages of their slots have been prefetched,
+    // so that page reads overlap with probing and consecutive probes mostly hit the same page.
+    // found[i] tells whether keys[i] exists, in which case results[i] is set to its offset.
+    void lookupBatchInternal(transaction::Transaction* transaction, const Key* keys,
+        const common::hash_t* hashes, uint64_t numKeys, common::offset_t* results, bool* found);
     void deleteInternal(Key key) const;
     bool insertInternal(Key key, common::offset_t value);
 
@@ -72,8 +78,12 @@ public:
     inline BMFileHandle* getFileHandle() const { return fileHandle.get(); }
 
 private:
-    bool lookupInPersistentIndex(
-        transaction::TransactionType trxType, Key key, common::offset_t& result);
+    inline bool lookupInPersistentIndex(
+        transaction::TransactionType trxType, Key key, common::offset_t& result) {
+        return lookupInPersistentIndex(trxType, key, HashIndexUtils::hash(key), result);
+    }
+    bool lookupInPersistentIndex(transaction::TransactionType trxType, Key key,
+        common::hash_t hashValue, common::offset_t& result);
     // The following two functions are only used in prepareCommit, and are not thread-safe.
     void insertIntoPersistentIndex(Key key, common::offset_t value);
     void deleteFromPersistentIndex(Key key);
@@ -227,6 +237,11 @@ public:
 
     bool lookup(transaction::Transaction* trx, common::ValueVector* keyVector, uint64_t vectorPos,
         common::offset_t& result);
+    // Looks up all selected keys of the vector, and sets offsets[i] to the offset of the i-th
+    // selected key. Returns the position in the selection vector of the first key that doesn't
+    // exist, or the number of selected keys if all of them exist.
+    uint64_t batchLookup(transaction::Transaction* trx, const common::ValueVector& keyVector,
+        common::offset_t* offsets);
 
     inline bool insert(common::ku_string_t key, common::offset_t value) {
         return insert(key.getAsStringView(), value);
@@ -254,6 +269,11 @@ public:
     BMFileHandle* getFileHandle() { return fileHandle.get(); }
     OverflowFile* getOverflowFile() { return overflowFile.get(); }
 
+private:
+    template<typename T>
+    uint64_t batchLookupInternal(transaction::Transaction* trx,
+        const common::ValueVector& keyVector, common::offset_t* offsets);
+
 private:
     common::PhysicalTypeID keyDataTypeID;
     std::shared_ptr<BMFileHandle> fileHandle;
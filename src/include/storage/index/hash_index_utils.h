@@ -59,7 +59,10 @@ public:
     }
 
     inline static uint64_t getHashIndexPosition(common::IndexHashable auto key) {
-        return (HashIndexUtils::hash(key) >> (64 - NUM_HASH_INDEXES_LOG2)) & (NUM_HASH_INDEXES - 1);
+        return getHashIndexPositionForHash(HashIndexUtils::hash(key));
+    }
+    inline static uint64_t getHashIndexPositionForHash(common::hash_t hash) {
+        return (hash >> (64 - NUM_HASH_INDEXES_LOG2)) & (NUM_HASH_INDEXES - 1);
     }
 
     static inline uint64_t getNumRequiredEntries(
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <vector>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace storage {
+
+// Equi-depth histogram over the values of a numeric property. Values are kept as doubles, and
+// bucket i covers [bounds[i], bounds[i+1]] with the same number of values in every bucket. Values
+// within a bucket are assumed to be uniformly distributed.
+// Histograms are built from a sample of each flushed column chunk and merged into the property
+// statistics. Like `HyperLogLog`, they only accumulate, so values that are overwritten are still
+// accounted for.
+class Histogram {
+public:
+    static constexpr uint64_t MAX_NUM_BUCKETS = 32;
+
+    Histogram() : numValues{0} {}
+
+    // Builds a histogram over `numValues` values represented by the given sample.
+    static Histogram build(std::vector<double> sample, uint64_t numValues);
+
+    void merge(const Histogram& other);
+
+    inline bool isEmpty() const { return numValues == 0; }
+    inline uint64_t getNumValues() const { return numValues; }
+    // Estimated fraction of values that are less than or equal to `value`.
+    double estimateFractionLessOrEqual(double value) const;
+
+    void serialize(common::Serializer& serializer) const;
+    static Histogram deserialize(common::Deserializer& deserializer);
+
+private:
+    inline uint64_t getNumBuckets() const { return bounds.size() - 1; }
+
+private:
+    uint64_t numValues;
+    std::vector<double> bounds;
+};
+
+} // namespace storage
+} // namespace kuzu
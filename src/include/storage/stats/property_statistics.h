@@ -1,6 +1,8 @@
 #pragma once
 
 #include "common/types/types.h"
+#include "storage/stats/histogram.h"
+#include "storage/stats/hyper_log_log.h"
 
 namespace kuzu {
 namespace transaction {
@@ -8,6 +10,8 @@ class Transaction;
 };
 namespace storage {
 
+class ColumnChunk;
+
 class PropertyStatistics {
 public:
     PropertyStatistics() = default;
@@ -15,6 +19,16 @@ public:
 
     inline bool mayHaveNull() const { return mayHaveNullValue; }
 
+    // Distinct values and histograms are only collected for numeric and string properties of node
+    // tables. An empty sketch means that the statistics are unknown.
+    inline bool hasNumDistinctValues() const { return !distinctValues.isEmpty(); }
+    inline uint64_t getNumDistinctValues() const { return distinctValues.estimate(); }
+    inline const Histogram& getHistogram() const { return histogram; }
+
+    // Accumulates the distinct values and the value distribution of the chunk.
+    void update(ColumnChunk& chunk);
+    void merge(const PropertyStatistics& other);
+
     void serialize(common::Serializer& serializer) const;
     static std::unique_ptr<PropertyStatistics> deserialize(common::Deserializer& deserializer);
 
@@ -24,6 +38,8 @@ private:
     // Stores whether or not the property is known to have contained a null value
     // If false, the property is guaranteed to not contain any nulls
     bool mayHaveNullValue = false;
+    HyperLogLog distinctValues;
+    Histogram histogram;
 };
 
 class TablesStatistics;
@@ -41,6 +57,8 @@ public:
 
     bool mayHaveNull(const transaction::Transaction& transaction);
     void setHasNull(const transaction::Transaction& transaction);
+    // Collects statistics of the chunk and merges them into the statistics of the property.
+    void update(ColumnChunk& chunk);
 
 private:
     TablesStatistics* tablesStatistics;
@@ -35,6 +35,11 @@ public:
         KU_ASSERT(propertyStatistics.contains(propertyID));
         return *(propertyStatistics.at(propertyID));
     }
+    inline const PropertyStatistics* getPropertyStatisticsIfExists(
+        common::property_id_t propertyID) const {
+        return propertyStatistics.contains(propertyID) ? propertyStatistics.at(propertyID).get() :
+                                                         nullptr;
+    }
     inline void setPropertyStatistics(
         common::property_id_t propertyID, PropertyStatistics newStats) {
         propertyStatistics[propertyID] = std::make_unique<PropertyStatistics>(newStats);
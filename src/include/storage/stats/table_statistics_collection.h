@@ -76,6 +76,14 @@ public:
 
     void setPropertyStatisticsForTable(
         common::table_id_t tableID, common::property_id_t propertyID, PropertyStatistics stats);
+    // Merges statistics collected from newly written chunks into the statistics of the property.
+    // Safe to call concurrently from multiple writers.
+    void mergePropertyStatisticsForTable(common::table_id_t tableID,
+        common::property_id_t propertyID, const PropertyStatistics& stats);
+    // Read-only access for the planner. Write transactions see their own updates if they have
+    // any. Returns nullptr if the property isn't tracked.
+    const PropertyStatistics* getPropertyStatistics(transaction::TransactionType transactionType,
+        common::table_id_t tableID, common::property_id_t propertyID) const;
 
     static std::unique_ptr<MetadataDAHInfo> createMetadataDAHInfo(
         const common::LogicalType& dataType, BMFileHandle& metadataFH, BufferManager* bm, WAL* wal);
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "common/enums/expression_type.h"
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace storage {
+
+// A numeric value widened to the largest type of its family, i.e., INT64 for signed integers,
+// UINT64 for unsigned integers and DOUBLE for floating points.
+union StorageValue {
+    int64_t signedInt;
+    uint64_t unsignedInt;
+    double floatVal;
+
+    StorageValue() : unsignedInt{0} {}
+    explicit StorageValue(int64_t value) : signedInt{value} {}
+    explicit StorageValue(uint64_t value) : unsignedInt{value} {}
+    explicit StorageValue(double value) : floatVal{value} {}
+
+    template<typename T>
+    T get() const;
+
+    // Reads the value at `pos` from a buffer of values of the given physical type.
+    static StorageValue read(
+        const uint8_t* data, common::offset_t pos, common::PhysicalTypeID physicalType);
+};
+
+template<>
+inline int64_t StorageValue::get<int64_t>() const {
+    return signedInt;
+}
+template<>
+inline uint64_t StorageValue::get<uint64_t>() const {
+    return unsignedInt;
+}
+template<>
+inline double StorageValue::get<double>() const {
+    return floatVal;
+}
+
+// Minimum and maximum of the non-null values in a column chunk. Zone maps are kept in the chunk
+// metadata of numeric columns, and let scans skip node groups that cannot satisfy a comparison
+// against a constant. They are conservative: in-place writes only widen the range, and values
+// that are deleted or set to null are not removed from it until the chunk is rewritten.
+struct ZoneMap {
+    // An invalid zone map is unknown and matches any predicate.
+    bool isValid = false;
+    bool hasNonNullValues = false;
+    StorageValue min;
+    StorageValue max;
+
+    static inline ZoneMap empty() { return ZoneMap{true, false, StorageValue(), StorageValue()}; }
+    static bool isSupported(const common::LogicalType& dataType);
+
+    // Widens the range with the non-null values in [offset, offset + numValues). Returns true if
+    // the zone map changed.
+    bool update(const uint8_t* data, common::offset_t offset, common::offset_t numValues,
+        common::PhysicalTypeID physicalType, const uint64_t* nullMask = nullptr);
+    // Returns false only if no value in the chunk can satisfy `value <comparison> constant`.
+    bool mayMatch(common::ExpressionType comparison, StorageValue constant,
+        common::PhysicalTypeID physicalType) const;
+};
+
+// A comparison `column <comparison> value` that a scan can check against zone maps.
+struct ZoneMapPredicate {
+    common::column_id_t columnID;
+    common::ExpressionType comparison;
+    StorageValue value;
+    common::PhysicalTypeID physicalType;
+};
+
+} // namespace storage
+} // namespace kuzu
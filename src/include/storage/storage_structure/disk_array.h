@@ -115,6 +115,10 @@ public:
         transaction::TransactionType trxType = transaction::TransactionType::READ_ONLY);
 
     void get(uint64_t idx, transaction::TransactionType trxType, std::span<uint8_t> val);
+    // Asks the buffer manager to read the pages holding the given elements in the background.
+    // Indices must be sorted so that each page is requested once. Only the committed version of
+    // the pages is prefetched.
+    void prefetch(std::span<const uint64_t> sortedIdxs);
 
     // Note: This function is to be used only by the WRITE trx.
     void update(uint64_t idx, std::span<uint8_t> val);
@@ -234,6 +238,7 @@ public:
         diskArray.get(idx, trxType, getSpan(val));
         return val;
     }
+    inline void prefetch(std::span<const uint64_t> sortedIdxs) { diskArray.prefetch(sortedIdxs); }
 
     // Note: Currently, this function doesn't support shrinking the size of the array.
     inline uint64_t resize(uint64_t newNumElements) {
@@ -74,6 +74,7 @@ public:
     }
 
     Column* getNullColumn();
+    inline RWPropertyStats& getPropertyStatistics() { return propertyStatistics; }
 
     virtual void prepareCommit();
     virtual void prepareCommitForChunk(transaction::Transaction* transaction,
@@ -135,6 +136,10 @@ protected:
 
     void readFromPage(transaction::Transaction* transaction, common::page_idx_t pageIdx,
         const std::function<void(uint8_t*)>& func);
+    // Declares the pages that a sequential scan over [startOffsetInChunk, endOffsetInChunk) will
+    // read next to the buffer manager.
+    void readAhead(transaction::Transaction* transaction, const ColumnChunkMetadata& chunkMeta,
+        common::offset_t startOffsetInChunk, common::offset_t endOffsetInChunk);
 
     virtual void writeValue(const ColumnChunkMetadata& chunkMeta,
         common::node_group_idx_t nodeGroupIdx, common::offset_t offsetInChunk,
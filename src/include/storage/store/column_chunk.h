@@ -9,6 +9,7 @@
 #include "common/vector/value_vector.h"
 #include "storage/buffer_manager/bm_file_handle.h"
 #include "storage/compression/compression.h"
+#include "storage/stats/zone_map.h"
 
 namespace kuzu {
 namespace storage {
@@ -21,6 +22,7 @@ struct ColumnChunkMetadata {
     common::page_idx_t numPages;
     uint64_t numValues;
     CompressionMetadata compMeta;
+    ZoneMap zoneMap;
 
     ColumnChunkMetadata() : pageIdx{common::INVALID_PAGE_IDX}, numPages{0}, numValues{0} {}
     ColumnChunkMetadata(common::page_idx_t pageIdx, common::page_idx_t numPages,
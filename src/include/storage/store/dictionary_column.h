@@ -17,7 +17,8 @@ public:
         DictionaryChunk& dictChunk);
     // Offsets to scan should be a sorted list of pairs mapping the index of the entry in the string
     // dictionary (as read from the index column) to the output index in the result vector to store
-    // the string.
+    // the string. If the strings of the node group are mostly duplicated, the dictionary codes of
+    // the result vector are also set (see `StringVector::getDictionaryCodes`).
     void scan(transaction::Transaction* transaction, common::node_group_idx_t nodeGroupIdx,
         std::vector<std::pair<DictionaryChunk::string_index_t, uint64_t>>& offsetsToScan,
         common::ValueVector* resultVector, const ColumnChunkMetadata& indexMeta);
@@ -71,6 +71,8 @@ public:
             transaction, std::move(columnIDs), inNodeIDVector, *readState.dataReadState);
     }
     void read(transaction::Transaction* transaction, TableReadState& readState) override;
+    bool canSkipNodeGroup(transaction::Transaction* transaction,
+        common::node_group_idx_t nodeGroupIdx, const std::vector<ZoneMapPredicate>& predicates);
 
     // Return the max node offset during insertions.
     common::offset_t validateUniquenessConstraint(transaction::Transaction* transaction,
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "storage/stats/zone_map.h"
 #include "storage/store/table_data.h"
 
 namespace kuzu {
@@ -28,6 +29,11 @@ public:
         const common::ValueVector& nodeIDVector,
         const std::vector<common::ValueVector*>& outputVectors) override;
 
+    // Returns true if the zone maps of the node group show that no node in it can satisfy all
+    // predicates. Local changes of the transaction are not considered.
+    bool canSkipNodeGroup(transaction::Transaction* transaction,
+        common::node_group_idx_t nodeGroupIdx, const std::vector<ZoneMapPredicate>& predicates);
+
     // Flush the nodeGroup to disk and update metadataDAs.
     void append(ChunkedNodeGroup* nodeGroup) override;
 
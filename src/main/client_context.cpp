@@ -8,8 +8,11 @@
 #include "common/random_engine.h"
 #include "common/string_utils.h"
 #include "extension/extension.h"
+#include "json.hpp"
 #include "main/database.h"
 #include "main/db_config.h"
+#include "main/plan_printer.h"
+#include "main/query_stats_log.h"
 #include "optimizer/optimizer.h"
 #include "parser/parser.h"
 #include "parser/visitor/statement_read_write_analyzer.h"
@@ -17,6 +20,7 @@
 #include "planner/planner.h"
 #include "processor/plan_mapper.h"
 #include "processor/processor.h"
+#include "storage/buffer_manager/buffer_manager.h"
 #include "storage/storage_manager.h"
 #include "transaction/transaction_context.h"
 
@@ -59,6 +63,10 @@ ClientContext::ClientContext(Database* database) : database{database} {
     config.enableProgressBar = ClientConfigDefault::ENABLE_PROGRESS_BAR;
     config.showProgressAfter = ClientConfigDefault::SHOW_PROGRESS_AFTER;
     config.enableMultiCopy = ClientConfigDefault::ENABLE_MULTI_COPY;
+    config.hashJoinMemoryLimit = ClientConfigDefault::HASH_JOIN_MEMORY_LIMIT;
+    config.aggregateMemoryLimit = ClientConfigDefault::AGGREGATE_MEMORY_LIMIT;
+    config.orderByMemoryLimit = ClientConfigDefault::ORDER_BY_MEMORY_LIMIT;
+    config.profileJson = ClientConfigDefault::PROFILE_JSON;
 }
 
 uint64_t ClientContext::getTimeoutRemainingInMS() const {
@@ -164,6 +172,14 @@ catalog::Catalog* ClientContext::getCatalog() const {
     return database->catalog.get();
 }
 
+processor::AdmissionController* ClientContext::getAdmissionController() const {
+    return database->queryProcessor->getAdmissionController();
+}
+
+QueryStatsLog* ClientContext::getQueryStatsLog() const {
+    return database->queryStatsLog.get();
+}
+
 VirtualFileSystem* ClientContext::getVFSUnsafe() const {
     return database->vfs.get();
 }
@@ -190,7 +206,6 @@ std::string ClientContext::getEnvVariable(const std::string& name) {
 }
 
 std::unique_ptr<PreparedStatement> ClientContext::prepare(std::string_view query) {
-    auto preparedStatement = std::unique_ptr<PreparedStatement>();
     if (query.empty()) {
         return preparedStatementWithError("Connection Exception: Query is empty.");
     }
@@ -203,7 +218,9 @@ std::unique_ptr<PreparedStatement> ClientContext::prepare(std::string_view query
         return preparedStatementWithError(
             "Connection Exception: We do not support prepare multiple statements.");
     }
-    return prepareNoLock(parsedStatements[0]);
+    auto preparedStatement = prepareNoLock(parsedStatements[0]);
+    preparedStatement->query = query;
+    return preparedStatement;
 }
 
 std::unique_ptr<PreparedStatement> ClientContext::prepareTest(std::string_view query) {
@@ -243,6 +260,7 @@ std::unique_ptr<QueryResult> ClientContext::query(
     for (auto& statement : parsedStatements) {
         auto preparedStatement = prepareNoLock(statement,
             enumerateAllPlans /* enumerate all plans */, encodedJoin, false /*requireNewTx*/);
+        preparedStatement->query = query;
         auto currentQueryResult = executeAndAutoCommitIfNecessaryNoLock(
             preparedStatement.get(), 0u, false /*requiredNexTx*/);
         if (!lastResult) {
@@ -376,6 +394,7 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
     KU_ASSERT(preparedStatement->parsedStatement != nullptr);
     auto rebindPreparedStatement = prepareNoLock(
         preparedStatement->parsedStatement, false, "", false, preparedStatement->parameterMap);
+    rebindPreparedStatement->query = preparedStatement->query;
     return executeAndAutoCommitIfNecessaryNoLock(rebindPreparedStatement.get(), 0u, false);
 }
 
@@ -399,6 +418,15 @@ std::unique_ptr<QueryResult> ClientContext::executeAndAutoCommitIfNecessaryNoLoc
     if (!preparedStatement->isSuccess()) {
         return queryResultWithError(preparedStatement->errMsg);
     }
+    this->resetActiveQuery();
+    this->startTimer();
+    // Queries are admitted before starting their transactions, so that waiting queries don't keep
+    // checkpoints waiting. Queries inside an active transaction are not made to wait.
+    std::unique_ptr<AdmittedQuery> admittedQuery;
+    try {
+        admittedQuery = database->queryProcessor->getAdmissionController()->admit(
+            this, config.numThreads, getTx() == nullptr /* canWait */);
+    } catch (Exception& exception) { return queryResultWithError(exception.what()); }
     if (preparedStatement->parsedStatement->requireTx() && requiredNexTx && getTx() == nullptr) {
         this->transactionContext->beginAutoTransaction(preparedStatement->isReadOnly());
         if (!preparedStatement->readOnly) {
@@ -406,8 +434,6 @@ std::unique_ptr<QueryResult> ClientContext::executeAndAutoCommitIfNecessaryNoLoc
             database->storageManager->initStatistics();
         }
     }
-    this->resetActiveQuery();
-    this->startTimer();
     auto mapper = PlanMapper(this);
     std::unique_ptr<PhysicalPlan> physicalPlan;
     if (preparedStatement->isSuccess()) {
@@ -422,8 +448,11 @@ std::unique_ptr<QueryResult> ClientContext::executeAndAutoCommitIfNecessaryNoLoc
     }
     auto queryResult = std::make_unique<QueryResult>(preparedStatement->preparedSummary);
     auto profiler = std::make_unique<Profiler>();
-    auto executionContext = std::make_unique<ExecutionContext>(profiler.get(), this);
+    auto executionContext = std::make_unique<ExecutionContext>(
+        profiler.get(), this, admittedQuery->getNumThreads());
     profiler->enabled = preparedStatement->isProfile();
+    auto numPageHitsBefore = database->bufferManager->getNumPageHits();
+    auto numPageMissesBefore = database->bufferManager->getNumPageMisses();
     auto executingTimer = TimeMetric(true /* enable */);
     executingTimer.start();
     std::shared_ptr<FactorizedTable> resultFT;
@@ -447,8 +476,17 @@ std::unique_ptr<QueryResult> ClientContext::executeAndAutoCommitIfNecessaryNoLoc
     }
     executingTimer.stop();
     queryResult->querySummary->executionTime = executingTimer.getElapsedTimeMS();
+    if (profiler->enabled) {
+        queryResult->querySummary->profileJson =
+            PlanPrinter(physicalPlan.get(), profiler.get()).printPlanToJson().dump();
+    }
     queryResult->initResultTableAndIterator(
         std::move(resultFT), preparedStatement->statementResult->getColumns());
+    database->queryStatsLog->add(QueryStats{preparedStatement->query,
+        admittedQuery->getNumThreads(), queryResult->querySummary->getCompilingTime(),
+        queryResult->querySummary->getExecutionTime(), queryResult->getNumTuples(),
+        database->bufferManager->getNumPageHits() - numPageHitsBefore,
+        database->bufferManager->getNumPageMisses() - numPageMissesBefore});
     return queryResult;
 }
 
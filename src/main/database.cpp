@@ -16,6 +16,7 @@
 #include "common/utils.h"
 #include "extension/extension.h"
 #include "main/db_config.h"
+#include "main/query_stats_log.h"
 #include "processor/processor.h"
 #include "spdlog/spdlog.h"
 #include "storage/storage_extension.h"
@@ -33,8 +34,9 @@ namespace kuzu {
 namespace main {
 
 SystemConfig::SystemConfig(uint64_t bufferPoolSize_, uint64_t maxNumThreads, bool enableCompression,
-    bool readOnly, uint64_t maxDBSize)
-    : maxNumThreads{maxNumThreads}, enableCompression{enableCompression}, readOnly(readOnly) {
+    bool readOnly, uint64_t maxDBSize, EvictionPolicy evictionPolicy)
+    : maxNumThreads{maxNumThreads}, enableCompression{enableCompression}, readOnly(readOnly),
+      evictionPolicy{evictionPolicy} {
     if (bufferPoolSize_ == -1u || bufferPoolSize_ == 0) {
 #if defined(_WIN32)
         MEMORYSTATUSEX status;
@@ -82,8 +84,8 @@ Database::Database(std::string_view databasePath, SystemConfig systemConfig)
     auto clientContext = ClientContext(this);
     auto dbPathStr = std::string(databasePath);
     this->databasePath = vfs->expandPath(&clientContext, dbPathStr);
-    bufferManager = std::make_unique<BufferManager>(
-        this->systemConfig.bufferPoolSize, this->systemConfig.maxDBSize);
+    bufferManager = std::make_unique<BufferManager>(this->systemConfig.bufferPoolSize,
+        this->systemConfig.maxDBSize, this->systemConfig.evictionPolicy);
     memoryManager = std::make_unique<MemoryManager>(bufferManager.get(), vfs.get());
     queryProcessor = std::make_unique<processor::QueryProcessor>(this->systemConfig.maxNumThreads);
     initDBDirAndCoreFilesIfNecessary();
@@ -96,6 +98,7 @@ Database::Database(std::string_view databasePath, SystemConfig systemConfig)
     transactionManager = std::make_unique<transaction::TransactionManager>(*wal);
     extensionOptions = std::make_unique<extension::ExtensionOptions>();
     databaseManager = std::make_unique<DatabaseManager>();
+    queryStatsLog = std::make_unique<QueryStatsLog>();
 }
 
 Database::~Database() {
@@ -250,6 +253,8 @@ void Database::rollback(
 void Database::checkpointAndClearWAL(WALReplayMode replayMode) {
     KU_ASSERT(replayMode == WALReplayMode::COMMIT_CHECKPOINT ||
               replayMode == WALReplayMode::RECOVERY_CHECKPOINT);
+    // Checkpointing writes to data files directly, so no page should be read ahead concurrently.
+    bufferManager->cancelPrefetches();
     auto walReplayer = std::make_unique<WALReplayer>(
         wal.get(), storageManager.get(), bufferManager.get(), catalog.get(), replayMode, vfs.get());
     walReplayer->replay();
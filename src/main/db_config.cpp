@@ -16,7 +16,9 @@ static ConfigurationOption options[] = { // NOLINT(cert-err58-cpp):
     GET_CONFIGURATION(VarLengthExtendMaxDepthSetting), GET_CONFIGURATION(EnableSemiMaskSetting),
     GET_CONFIGURATION(HomeDirectorySetting), GET_CONFIGURATION(FileSearchPathSetting),
     GET_CONFIGURATION(ProgressBarSetting), GET_CONFIGURATION(ProgressBarTimerSetting),
-    GET_CONFIGURATION(EnableMultiCopySetting)};
+    GET_CONFIGURATION(EnableMultiCopySetting), GET_CONFIGURATION(HashJoinMemoryLimitSetting),
+    GET_CONFIGURATION(AggregateMemoryLimitSetting), GET_CONFIGURATION(OrderByMemoryLimitSetting),
+    GET_CONFIGURATION(ProfileJsonSetting)};
 
 ConfigurationOption* DBConfig::getOptionByName(const std::string& optionName) {
     auto lOptionName = optionName;
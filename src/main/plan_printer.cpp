@@ -326,6 +326,13 @@ nlohmann::json PlanPrinter::toJson(PhysicalOperator* physicalOperator, Profiler&
         for (auto& [key, val] : physicalOperator->getProfilerKeyValAttributes(profiler_)) {
             json[key] = val;
         }
+        // Unlike the printed attributes, resources are always present in the json.
+        auto resourceUsage = physicalOperator->getResourceUsage(profiler_);
+        json["NumPageHits"] = resourceUsage.numPageHits;
+        json["NumPageMisses"] = resourceUsage.numPageMisses;
+        json["NumBytesRead"] = resourceUsage.numBytesRead;
+        json["PeakMemoryUsage"] = resourceUsage.peakMemoryUsage;
+        json["ThreadExecutionTimes"] = resourceUsage.threadExecutionTimes;
     }
     for (auto i = 0u; i < physicalOperator->getNumChildren(); ++i) {
         json["Child" + std::to_string(i)] = toJson(physicalOperator->getChild(i), profiler_);
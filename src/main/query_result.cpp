@@ -194,6 +194,11 @@ std::string QueryResult::toSingleQueryString() {
     return result;
 }
 
+uint64_t QueryResult::skipNextTuples(uint64_t numTuples, uint64_t& startTupleIdx) {
+    validateQuerySucceed();
+    return iterator->skipFlatTuples(numTuples, startTupleIdx);
+}
+
 void QueryResult::validateQuerySucceed() const {
     if (!success) {
         throw Exception(errMsg);
@@ -210,5 +215,11 @@ std::unique_ptr<ArrowArray> QueryResult::getNextArrowChunk(int64_t chunkSize) {
     return data;
 }
 
+std::unique_ptr<ArrowArrayStream> QueryResult::getArrowArrayStream(int64_t chunkSize) {
+    auto stream = std::make_unique<ArrowArrayStream>();
+    ArrowConverter::toArrowArrayStream(*this, stream.get(), chunkSize);
+    return stream;
+}
+
 } // namespace main
 } // namespace kuzu
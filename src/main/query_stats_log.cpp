@@ -0,0 +1,20 @@
+#include "main/query_stats_log.h"
+
+namespace kuzu {
+namespace main {
+
+void QueryStatsLog::add(QueryStats queryStats) {
+    std::lock_guard lck{mtx};
+    if (stats.size() == MAX_NUM_QUERIES) {
+        stats.pop_front();
+    }
+    stats.push_back(std::move(queryStats));
+}
+
+std::vector<QueryStats> QueryStatsLog::getStats() const {
+    std::lock_guard lck{mtx};
+    return {stats.begin(), stats.end()};
+}
+
+} // namespace main
+} // namespace kuzu
@@ -15,6 +15,10 @@ double QuerySummary::getExecutionTime() const {
     return executionTime;
 }
 
+std::string QuerySummary::getProfileJson() const {
+    return profileJson;
+}
+
 void QuerySummary::setPreparedSummary(PreparedSummary preparedSummary_) {
     preparedSummary = preparedSummary_;
 }
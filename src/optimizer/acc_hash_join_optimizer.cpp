@@ -7,6 +7,7 @@
 #include "planner/operator/logical_hash_join.h"
 #include "planner/operator/logical_intersect.h"
 #include "planner/operator/scan/logical_scan_internal_id.h"
+#include "planner/operator/sip/logical_bloom_filter.h"
 #include "planner/operator/sip/logical_semi_masker.h"
 
 using namespace kuzu::common;
@@ -90,18 +91,100 @@ bool HashJoinSIPOptimizer::tryBuildToProbeHJSIP(planner::LogicalOperator* op) {
     }
     auto probeRoot = hashJoin->getChild(0);
     auto buildRoot = hashJoin->getChild(1);
+    auto hasSemiMaskOnAllKeys = true;
     for (auto& nodeID : hashJoin->getJoinNodeIDs()) {
         auto ops = resolveOperatorsToApplySemiMask(*nodeID, probeRoot.get());
         if (!ops.empty()) {
             buildRoot = appendNodeSemiMasker(ops, buildRoot);
+        } else {
+            hasSemiMaskOnAllKeys = false;
         }
     }
+    if (!hasSemiMaskOnAllKeys) {
+        // Some keys are not scanned on the probe side, e.g. nodes that are extended to, so probe
+        // tuples are filtered on the build side keys instead.
+        tryAppendBloomFilter(hashJoin);
+    }
     hashJoin->setSIP(planner::SidewaysInfoPassing::BUILD_TO_PROBE);
     hashJoin->setJoinSubPlanSolveOrder(JoinSubPlanSolveOrder::PROBE_BUILD);
     hashJoin->setChild(1, buildRoot);
     return true;
 }
 
+// Operators whose first child is in the same pipeline and which produce each output tuple from
+// a single input tuple of the first child, keeping its values. Dropping input tuples that cannot
+// be joined above such an operator does not change the result of the join. The first child of a
+// join with probe to build SIP is an accumulate scanned by the join, which is mapped assuming the
+// scan is directly below the join.
+static bool canFilterBelow(LogicalOperator* op) {
+    switch (op->getOperatorType()) {
+    case LogicalOperatorType::HASH_JOIN:
+        return ((LogicalHashJoin*)op)->getSIP() != SidewaysInfoPassing::PROBE_TO_BUILD;
+    case LogicalOperatorType::INTERSECT:
+        return ((LogicalIntersect*)op)->getSIP() != SidewaysInfoPassing::PROBE_TO_BUILD;
+    case LogicalOperatorType::BLOOM_FILTER:
+    case LogicalOperatorType::CROSS_PRODUCT:
+    case LogicalOperatorType::EXTEND:
+    case LogicalOperatorType::FILTER:
+    case LogicalOperatorType::FLATTEN:
+    case LogicalOperatorType::NODE_LABEL_FILTER:
+    case LogicalOperatorType::PROJECTION:
+    case LogicalOperatorType::RECURSIVE_EXTEND:
+    case LogicalOperatorType::SCAN_NODE_PROPERTY:
+    case LogicalOperatorType::SEMI_MASKER:
+    case LogicalOperatorType::UNWIND:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Operators that are worth skipping for the tuples that cannot be joined.
+static bool isExpensive(LogicalOperator* op) {
+    switch (op->getOperatorType()) {
+    case LogicalOperatorType::CROSS_PRODUCT:
+    case LogicalOperatorType::EXTEND:
+    case LogicalOperatorType::HASH_JOIN:
+    case LogicalOperatorType::INTERSECT:
+    case LogicalOperatorType::RECURSIVE_EXTEND:
+    case LogicalOperatorType::SCAN_NODE_PROPERTY:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void HashJoinSIPOptimizer::tryAppendBloomFilter(planner::LogicalHashJoin* hashJoin) {
+    expression_vector probeKeys;
+    for (auto& [probeKey, buildKey] : hashJoin->getJoinConditions()) {
+        probeKeys.push_back(probeKey);
+    }
+    auto hasAllKeysInScope = [&](const Schema& schema) {
+        for (auto& key : probeKeys) {
+            if (!schema.isExpressionInScope(*key)) {
+                return false;
+            }
+        }
+        return true;
+    };
+    // Find the lowest operator on the probe side pipeline whose input has all keys in scope.
+    LogicalOperator* parent = nullptr;
+    auto hasExpensiveOperator = false;
+    auto op = hashJoin->getChild(0).get();
+    while (canFilterBelow(op) && hasAllKeysInScope(*op->getChild(0)->getSchema())) {
+        parent = op;
+        hasExpensiveOperator |= isExpensive(op);
+        op = op->getChild(0).get();
+    }
+    if (!hasExpensiveOperator) {
+        return;
+    }
+    auto bloomFilter = std::make_shared<LogicalBloomFilter>(probeKeys, parent->getChild(0));
+    bloomFilter->computeFlatSchema();
+    parent->setChild(0, bloomFilter);
+    hashJoin->setBloomFilter(bloomFilter.get());
+}
+
 void HashJoinSIPOptimizer::visitIntersect(planner::LogicalOperator* op) {
     auto intersect = (LogicalIntersect*)op;
     if (intersect->getSIP() == planner::SidewaysInfoPassing::PROHIBIT_PROBE_TO_BUILD) {
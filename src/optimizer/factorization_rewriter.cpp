@@ -21,6 +21,7 @@
 #include "planner/operator/persistent/logical_insert.h"
 #include "planner/operator/persistent/logical_merge.h"
 #include "planner/operator/persistent/logical_set.h"
+#include "planner/operator/sip/logical_bloom_filter.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::planner;
@@ -150,6 +151,12 @@ void FactorizationRewriter::visitFilter(planner::LogicalOperator* op) {
     filter->setChild(0, appendFlattens(filter->getChild(0), groupsPosToFlatten));
 }
 
+void FactorizationRewriter::visitBloomFilter(planner::LogicalOperator* op) {
+    auto bloomFilter = (LogicalBloomFilter*)op;
+    auto groupsPosToFlatten = bloomFilter->getGroupsPosToFlatten();
+    bloomFilter->setChild(0, appendFlattens(bloomFilter->getChild(0), groupsPosToFlatten));
+}
+
 void FactorizationRewriter::visitSetNodeProperty(planner::LogicalOperator* op) {
     auto setNodeProperty = (LogicalSetNodeProperty*)op;
     for (auto i = 0u; i < setNodeProperty->getInfosRef().size(); ++i) {
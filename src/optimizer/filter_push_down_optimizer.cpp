@@ -9,6 +9,7 @@
 #include "planner/operator/logical_hash_join.h"
 #include "planner/operator/scan/logical_dummy_scan.h"
 #include "planner/operator/scan/logical_index_scan.h"
+#include "planner/operator/scan/logical_scan_internal_id.h"
 #include "planner/operator/scan/logical_scan_node_property.h"
 
 using namespace kuzu::binder;
@@ -93,6 +94,29 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitCrossProductRepla
     return hashJoin;
 }
 
+// Returns true if the predicate compares a property of the given variable with a constant of the
+// same type, e.g. a.age > 30 or $x = a.age.
+static bool isPropertyConstantComparison(
+    const Expression& predicate, const std::string& variableName) {
+    if (!isExpressionComparison(predicate.expressionType)) {
+        return false;
+    }
+    auto isConstant = [](const Expression& expression) {
+        return expression.expressionType == ExpressionType::LITERAL ||
+               expression.expressionType == ExpressionType::PARAMETER;
+    };
+    auto isProperty = [&](const Expression& expression) {
+        return expression.expressionType == ExpressionType::PROPERTY &&
+               ((PropertyExpression&)expression).getVariableName() == variableName;
+    };
+    auto left = predicate.getChild(0);
+    auto right = predicate.getChild(1);
+    if (left->getDataType().getLogicalTypeID() != right->getDataType().getLogicalTypeID()) {
+        return false;
+    }
+    return (isProperty(*left) && isConstant(*right)) || (isConstant(*left) && isProperty(*right));
+}
+
 std::shared_ptr<planner::LogicalOperator> FilterPushDownOptimizer::visitScanNodePropertyReplace(
     const std::shared_ptr<planner::LogicalOperator>& op) {
     auto scan = (LogicalScanNodeProperty*)op.get();
@@ -122,6 +146,20 @@ std::shared_ptr<planner::LogicalOperator> FilterPushDownOptimizer::visitScanNode
     }
     // Perform filter push down.
     auto currentRoot = scan->getChild(0);
+    if (currentRoot->getOperatorType() == LogicalOperatorType::SCAN_INTERNAL_ID) {
+        auto scanInternalID = (LogicalScanInternalID*)currentRoot.get();
+        auto variableName = ((PropertyExpression&)*nodeID).getVariableName();
+        for (auto& predicate : predicateSet->equalityPredicates) {
+            if (isPropertyConstantComparison(*predicate, variableName)) {
+                scanInternalID->addPropertyPredicate(predicate);
+            }
+        }
+        for (auto& predicate : predicateSet->nonEqualityPredicates) {
+            if (isPropertyConstantComparison(*predicate, variableName)) {
+                scanInternalID->addPropertyPredicate(predicate);
+            }
+        }
+    }
     for (auto& predicate : predicateSet->equalityPredicates) {
         currentRoot = pushDownToScanNode(nodeID, tableIDs, predicate, currentRoot);
     }
@@ -64,6 +64,9 @@ void LogicalOperatorVisitor::visitOperatorSwitch(planner::LogicalOperator* op) {
     case LogicalOperatorType::FILTER: {
         visitFilter(op);
     } break;
+    case LogicalOperatorType::BLOOM_FILTER: {
+        visitBloomFilter(op);
+    } break;
     case LogicalOperatorType::SET_NODE_PROPERTY: {
         visitSetNodeProperty(op);
     } break;
@@ -153,6 +156,9 @@ std::shared_ptr<planner::LogicalOperator> LogicalOperatorVisitor::visitOperatorR
     case LogicalOperatorType::FILTER: {
         return visitFilterReplace(op);
     }
+    case LogicalOperatorType::BLOOM_FILTER: {
+        return visitBloomFilterReplace(op);
+    }
     case LogicalOperatorType::SET_NODE_PROPERTY: {
         return visitSetNodePropertyReplace(op);
     }
@@ -1,5 +1,6 @@
 #include "planner/join_order/cardinality_estimator.h"
 
+#include "binder/expression/literal_expression.h"
 #include "binder/expression/property_expression.h"
 #include "planner/join_order/join_order_util.h"
 #include "planner/operator/scan/logical_scan_internal_id.h"
@@ -38,13 +39,16 @@ uint64_t CardinalityEstimator::estimateScanNode(LogicalOperator* op) {
     return atLeastOne(getNodeIDDom(scan->getInternalID()->getUniqueName()));
 }
 
-uint64_t CardinalityEstimator::estimateHashJoin(
-    const expression_vector& joinKeys, const LogicalPlan& probePlan, const LogicalPlan& buildPlan) {
-    auto denominator = 1u;
+uint64_t CardinalityEstimator::estimateHashJoin(const expression_vector& joinKeys,
+    const LogicalPlan& probePlan, const LogicalPlan& buildPlan, Transaction* transaction) {
+    uint64_t denominator = 1;
     for (auto& joinKey : joinKeys) {
-        // TODO(Xiyang): we should be able to estimate non-ID-based joins as well.
         if (nodeIDName2dom.contains(joinKey->getUniqueName())) {
             denominator *= getNodeIDDom(joinKey->getUniqueName());
+        } else if (joinKey->expressionType == ExpressionType::PROPERTY) {
+            auto& property =
+                ku_dynamic_cast<const Expression&, const PropertyExpression&>(*joinKey);
+            denominator *= atLeastOne(getNumDistinctValues(property, transaction));
         }
     }
     return atLeastOne(probePlan.estCardinality *
@@ -89,7 +93,11 @@ static bool isPrimaryKey(const Expression& expression) {
 }
 
 uint64_t CardinalityEstimator::estimateFilter(
-    const LogicalPlan& childPlan, const Expression& predicate) {
+    const LogicalPlan& childPlan, const Expression& predicate, Transaction* transaction) {
+    auto selectivity = getSelectivity(predicate, transaction);
+    if (selectivity >= 0) {
+        return atLeastOne(childPlan.estCardinality * selectivity);
+    }
     if (predicate.expressionType == ExpressionType::EQUALS) {
         if (isPrimaryKey(*predicate.getChild(0)) || isPrimaryKey(*predicate.getChild(1))) {
             return 1;
@@ -122,6 +130,169 @@ uint64_t CardinalityEstimator::getNumRels(
     return atLeastOne(numRels);
 }
 
+static bool getNumericLiteral(const Expression& expression, double& result) {
+    if (expression.expressionType != ExpressionType::LITERAL) {
+        return false;
+    }
+    auto value =
+        ku_dynamic_cast<const Expression&, const LiteralExpression&>(expression).getValue();
+    if (value->isNull()) {
+        return false;
+    }
+    switch (value->getDataType()->getPhysicalType()) {
+    case PhysicalTypeID::INT64: {
+        result = value->val.int64Val;
+    } break;
+    case PhysicalTypeID::INT32: {
+        result = value->val.int32Val;
+    } break;
+    case PhysicalTypeID::INT16: {
+        result = value->val.int16Val;
+    } break;
+    case PhysicalTypeID::INT8: {
+        result = value->val.int8Val;
+    } break;
+    case PhysicalTypeID::UINT64: {
+        result = value->val.uint64Val;
+    } break;
+    case PhysicalTypeID::UINT32: {
+        result = value->val.uint32Val;
+    } break;
+    case PhysicalTypeID::UINT16: {
+        result = value->val.uint16Val;
+    } break;
+    case PhysicalTypeID::UINT8: {
+        result = value->val.uint8Val;
+    } break;
+    case PhysicalTypeID::DOUBLE: {
+        result = value->val.doubleVal;
+    } break;
+    case PhysicalTypeID::FLOAT: {
+        result = value->val.floatVal;
+    } break;
+    default:
+        return false;
+    }
+    return true;
+}
+
+static ExpressionType reverseComparison(ExpressionType comparison) {
+    switch (comparison) {
+    case ExpressionType::GREATER_THAN:
+        return ExpressionType::LESS_THAN;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return ExpressionType::LESS_THAN_EQUALS;
+    case ExpressionType::LESS_THAN:
+        return ExpressionType::GREATER_THAN;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return ExpressionType::GREATER_THAN_EQUALS;
+    default:
+        return comparison;
+    }
+}
+
+double CardinalityEstimator::getSelectivity(const Expression& predicate, Transaction* transaction) {
+    if (!isExpressionComparison(predicate.expressionType)) {
+        return -1;
+    }
+    auto left = predicate.getChild(0);
+    auto right = predicate.getChild(1);
+    auto comparison = predicate.expressionType;
+    if (left->expressionType != ExpressionType::PROPERTY) {
+        std::swap(left, right);
+        comparison = reverseComparison(comparison);
+    }
+    if (left->expressionType != ExpressionType::PROPERTY) {
+        return -1;
+    }
+    auto& property = ku_dynamic_cast<const Expression&, const PropertyExpression&>(*left);
+    if (property.isPrimaryKey() || property.isInternalID()) {
+        return -1;
+    }
+    switch (comparison) {
+    case ExpressionType::EQUALS:
+    case ExpressionType::NOT_EQUALS: {
+        auto numDistinctValues = getNumDistinctValues(property, transaction);
+        if (right->expressionType == ExpressionType::PROPERTY) {
+            auto& otherProperty =
+                ku_dynamic_cast<const Expression&, const PropertyExpression&>(*right);
+            auto otherNumDistinctValues = getNumDistinctValues(otherProperty, transaction);
+            if (numDistinctValues == 0 || otherNumDistinctValues == 0) {
+                return -1;
+            }
+            numDistinctValues = std::max(numDistinctValues, otherNumDistinctValues);
+        }
+        if (numDistinctValues == 0) {
+            return -1;
+        }
+        auto selectivity = 1.0 / numDistinctValues;
+        return comparison == ExpressionType::EQUALS ? selectivity : 1 - selectivity;
+    }
+    case ExpressionType::LESS_THAN:
+    case ExpressionType::LESS_THAN_EQUALS:
+    case ExpressionType::GREATER_THAN:
+    case ExpressionType::GREATER_THAN_EQUALS: {
+        double value;
+        if (!getNumericLiteral(*right, value)) {
+            return -1;
+        }
+        auto fraction = getFractionLessOrEqual(property, value, transaction);
+        if (fraction < 0) {
+            return -1;
+        }
+        if (comparison == ExpressionType::LESS_THAN ||
+            comparison == ExpressionType::LESS_THAN_EQUALS) {
+            return fraction;
+        }
+        return 1 - fraction;
+    }
+    default:
+        return -1;
+    }
+}
+
+const storage::PropertyStatistics* CardinalityEstimator::getPropertyStatistics(
+    table_id_t tableID, property_id_t propertyID, Transaction* transaction) const {
+    if (nodesStatistics == nullptr) {
+        return nullptr;
+    }
+    // Only node properties have distinct values and histograms for now.
+    return nodesStatistics->getPropertyStatistics(transaction->getType(), tableID, propertyID);
+}
+
+uint64_t CardinalityEstimator::getNumDistinctValues(
+    const PropertyExpression& property, Transaction* transaction) const {
+    uint64_t numDistinctValues = 0;
+    for (auto& [tableID, propertyID] : property.getPropertyIDPerTable()) {
+        auto statistics = getPropertyStatistics(tableID, propertyID, transaction);
+        if (statistics == nullptr || !statistics->hasNumDistinctValues()) {
+            return 0;
+        }
+        numDistinctValues += statistics->getNumDistinctValues();
+    }
+    return numDistinctValues;
+}
+
+double CardinalityEstimator::getFractionLessOrEqual(
+    const PropertyExpression& property, double value, Transaction* transaction) const {
+    double numValuesLessOrEqual = 0;
+    uint64_t numValues = 0;
+    for (auto& [tableID, propertyID] : property.getPropertyIDPerTable()) {
+        auto statistics = getPropertyStatistics(tableID, propertyID, transaction);
+        if (statistics == nullptr || statistics->getHistogram().isEmpty()) {
+            return -1;
+        }
+        auto& histogram = statistics->getHistogram();
+        numValuesLessOrEqual +=
+            histogram.estimateFractionLessOrEqual(value) * histogram.getNumValues();
+        numValues += histogram.getNumValues();
+    }
+    if (numValues == 0) {
+        return -1;
+    }
+    return numValuesLessOrEqual / numValues;
+}
+
 double CardinalityEstimator::getExtensionRate(
     const RelExpression& rel, const NodeExpression& boundNode, Transaction* transaction) {
     auto numBoundNodes = (double)getNumNodes(boundNode.getTableIDs(), transaction);
@@ -11,6 +11,8 @@ std::string LogicalOperatorUtils::logicalOperatorTypeToString(LogicalOperatorTyp
         return "ATTACH_DATABASE";
     case LogicalOperatorType::ACCUMULATE:
         return "ACCUMULATE";
+    case LogicalOperatorType::BLOOM_FILTER:
+        return "BLOOM_FILTER";
     case LogicalOperatorType::AGGREGATE:
         return "AGGREGATE";
     case LogicalOperatorType::ALTER:
@@ -0,0 +1,30 @@
+#include "planner/operator/sip/logical_bloom_filter.h"
+
+#include "planner/operator/factorization/flatten_resolver.h"
+
+namespace kuzu {
+namespace planner {
+
+static f_group_pos_set getKeyGroupsPos(const binder::expression_vector& keys, Schema* schema) {
+    f_group_pos_set keyGroupsPos;
+    for (auto& key : keys) {
+        keyGroupsPos.insert(schema->getGroupPos(*key));
+    }
+    return keyGroupsPos;
+}
+
+f_group_pos_set LogicalBloomFilter::getGroupsPosToFlatten() {
+    auto childSchema = children[0]->getSchema();
+    return factorization::FlattenAllButOne::getGroupsPosToFlatten(
+        getKeyGroupsPos(keys, childSchema), childSchema);
+}
+
+f_group_pos LogicalBloomFilter::getGroupPosToSelect() const {
+    auto childSchema = children[0]->getSchema();
+    auto keyGroupsPos = getKeyGroupsPos(keys, childSchema);
+    SchemaUtils::validateAtMostOneUnFlatGroup(keyGroupsPos, *childSchema);
+    return SchemaUtils::getLeadingGroupPos(keyGroupsPos, *childSchema);
+}
+
+} // namespace planner
+} // namespace kuzu
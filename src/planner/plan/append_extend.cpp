@@ -165,6 +165,24 @@ void Planner::appendRecursiveExtend(const std::shared_ptr<NodeExpression>& bound
     }
     auto extend = std::make_shared<LogicalRecursiveExtend>(boundNode, nbrNode, rel, direction,
         RecursiveJoinType::TRACK_PATH, plan.getLastOperator(), recursivePlan->getLastOperator());
+    if (rel->getRelType() == QueryRelType::SHORTEST && !boundNode->isMultiLabeled()) {
+        auto numSources = plan.getCardinality();
+        auto numNodes = cardinalityEstimator.getNumNodes(*boundNode);
+        extend->setMultiSourceBFS(
+            numSources >= PlannerKnobs::MULTI_SOURCE_BFS_MIN_NUM_SOURCES &&
+            numSources >= numNodes * PlannerKnobs::MULTI_SOURCE_BFS_MIN_SOURCE_RATIO);
+    }
+    if ((rel->getRelType() == QueryRelType::SHORTEST ||
+            rel->getRelType() == QueryRelType::ALL_SHORTEST) &&
+        recursiveInfo->nodePredicate == nullptr) {
+        // Shortest path BFSs can extend a level bottom-up, from unvisited nodes to their neighbors
+        // in the frontier. This requires extending in the reverse direction. Node predicates are
+        // evaluated on the nodes being extended, so they can't be evaluated bottom-up.
+        auto bwdRecursivePlan = std::make_unique<LogicalPlan>();
+        createRecursivePlan(*recursiveInfo, ExtendDirectionUtils::getReverseDirection(direction),
+            *bwdRecursivePlan);
+        extend->setBwdRecursiveChild(bwdRecursivePlan->getLastOperator());
+    }
     appendFlattens(extend->getGroupsPosToFlatten(), plan);
     extend->setChild(0, plan.getLastOperator());
     extend->computeFactorizedSchema();
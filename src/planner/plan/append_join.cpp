@@ -35,7 +35,8 @@ void Planner::appendHashJoin(const binder::expression_vector& joinNodeIDs, JoinT
     resultPlan.setCost(CostModel::computeHashJoinCost(joinNodeIDs, probePlan, buildPlan));
     // Update cardinality
     resultPlan.setCardinality(
-        cardinalityEstimator.estimateHashJoin(joinNodeIDs, probePlan, buildPlan));
+        cardinalityEstimator.estimateHashJoin(
+            joinNodeIDs, probePlan, buildPlan, clientContext->getTx()));
     resultPlan.setLastOperator(std::move(hashJoin));
 }
 
@@ -417,6 +417,10 @@ static std::unique_ptr<LogicalPlan> getWCOJBuildPlanForRel(
 void Planner::planWCOJoin(const SubqueryGraph& subgraph,
     const std::vector<std::shared_ptr<RelExpression>>& rels,
     const std::shared_ptr<NodeExpression>& intersectNode) {
+    // Intersect compares node offsets only, so it cannot tell apart nodes of different tables.
+    if (intersectNode->isMultiLabeled()) {
+        return;
+    }
     auto newSubgraph = subgraph;
     std::vector<SubqueryGraph> prevSubgraphs;
     prevSubgraphs.push_back(subgraph);
@@ -0,0 +1,94 @@
+#include "processor/admission_controller.h"
+
+#include <algorithm>
+
+#include "common/assert.h"
+#include "common/constants.h"
+#include "common/exception/interrupt.h"
+#include "common/timer.h"
+#include "main/client_context.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+AdmittedQuery::~AdmittedQuery() {
+    controller->release(numThreads);
+}
+
+AdmissionController::AdmissionController(uint64_t numThreads)
+    : numThreads{std::max(numThreads, (uint64_t)1)}, numThreadsInUse{0}, numRunningQueries{0},
+      nextTicket{0}, numAdmittedQueries{0}, numWaitedQueries{0}, numDegradedQueries{0},
+      totalWaitTimeInMS{0}, maxWaitTimeInMS{0} {}
+
+std::unique_ptr<AdmittedQuery> AdmissionController::admit(
+    main::ClientContext* context, uint64_t numThreadsRequested, bool canWait) {
+    numThreadsRequested = std::clamp(numThreadsRequested, (uint64_t)1, numThreads);
+    std::unique_lock lck{mtx};
+    if (!canWait || (waitingTickets.empty() && numThreadsInUse < numThreads)) {
+        return std::make_unique<AdmittedQuery>(this, grantNoLock(numThreadsRequested));
+    }
+    auto ticket = nextTicket++;
+    waitingTickets.push_back(ticket);
+    numWaitedQueries++;
+    Timer timer;
+    timer.start();
+    while (waitingTickets.front() != ticket || numThreadsInUse >= numThreads) {
+        if (context->interrupted() ||
+            (context->hasTimeout() && context->getTimeoutRemainingInMS() == 0)) {
+            std::erase(waitingTickets, ticket);
+            lck.unlock();
+            // The query behind this one may be admitted now.
+            cv.notify_all();
+            throw InterruptException{};
+        }
+        // Waiting queries are woken up by release(). Timeouts and interrupts are checked
+        // periodically.
+        cv.wait_for(lck, std::chrono::microseconds(THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS));
+    }
+    waitingTickets.pop_front();
+    timer.stop();
+    auto waitTimeInMS = timer.getDuration() / 1000;
+    totalWaitTimeInMS += waitTimeInMS;
+    maxWaitTimeInMS = std::max(maxWaitTimeInMS, waitTimeInMS);
+    auto admittedQuery = std::make_unique<AdmittedQuery>(this, grantNoLock(numThreadsRequested));
+    lck.unlock();
+    cv.notify_all();
+    return admittedQuery;
+}
+
+AdmissionStats AdmissionController::getStats() {
+    std::unique_lock lck{mtx};
+    return AdmissionStats{numThreads, numThreadsInUse, numRunningQueries, waitingTickets.size(),
+        numAdmittedQueries, numWaitedQueries, numDegradedQueries, totalWaitTimeInMS,
+        maxWaitTimeInMS};
+}
+
+uint64_t AdmissionController::grantNoLock(uint64_t numThreadsRequested) {
+    auto numFreeThreads = numThreadsInUse < numThreads ? numThreads - numThreadsInUse : 0;
+    // Leave room for the queries that are still waiting behind this one.
+    auto fairShare = numThreads / (numRunningQueries + waitingTickets.size() + 1);
+    auto numThreadsGranted =
+        std::max(std::min({numThreadsRequested, numFreeThreads, fairShare}), (uint64_t)1);
+    if (numThreadsGranted < numThreadsRequested) {
+        numDegradedQueries++;
+    }
+    numThreadsInUse += numThreadsGranted;
+    numRunningQueries++;
+    numAdmittedQueries++;
+    return numThreadsGranted;
+}
+
+void AdmissionController::release(uint64_t numThreadsToRelease) {
+    {
+        std::unique_lock lck{mtx};
+        KU_ASSERT(numThreadsInUse >= numThreadsToRelease && numRunningQueries > 0);
+        numThreadsInUse -= numThreadsToRelease;
+        numRunningQueries--;
+    }
+    cv.notify_all();
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -10,6 +10,7 @@
 #include "common/exception/not_implemented.h"
 #include "common/string_format.h"
 #include "expression_evaluator/case_evaluator.h"
+#include "expression_evaluator/conjunctive_comparison_evaluator.h"
 #include "expression_evaluator/function_evaluator.h"
 #include "expression_evaluator/literal_evaluator.h"
 #include "expression_evaluator/node_rel_evaluator.h"
@@ -67,6 +68,12 @@ std::unique_ptr<ExpressionEvaluator> ExpressionMapper::getEvaluator(
     } else if (ExpressionType::CASE_ELSE == expressionType) {
         return getCaseEvaluator(expression, schema);
     } else if (canEvaluateAsFunction(expressionType)) {
+        if (expressionType == ExpressionType::AND) {
+            auto evaluator = getConjunctiveComparisonEvaluator(expression->splitOnAND(), schema);
+            if (evaluator != nullptr) {
+                return evaluator;
+            }
+        }
         return getFunctionEvaluator(expression, schema);
     } else {
         // LCOV_EXCL_START
@@ -94,6 +101,74 @@ std::unique_ptr<ExpressionEvaluator> ExpressionMapper::getConstantEvaluator(
     }
 }
 
+static bool isNonNullConstant(const Expression& expression) {
+    switch (expression.expressionType) {
+    case ExpressionType::LITERAL:
+        return !((LiteralExpression&)expression).isNull();
+    case ExpressionType::PARAMETER: {
+        auto value = ((ParameterExpression&)expression).getLiteral();
+        return value != nullptr && !value->isNull();
+    }
+    default:
+        return false;
+    }
+}
+
+// Returns the comparison with its operands swapped, e.g. a < b for b > a.
+static ExpressionType getSwappedComparison(ExpressionType comparisonType) {
+    switch (comparisonType) {
+    case ExpressionType::GREATER_THAN:
+        return ExpressionType::LESS_THAN;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return ExpressionType::LESS_THAN_EQUALS;
+    case ExpressionType::LESS_THAN:
+        return ExpressionType::GREATER_THAN;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return ExpressionType::GREATER_THAN_EQUALS;
+    default:
+        return comparisonType;
+    }
+}
+
+std::unique_ptr<ExpressionEvaluator> ExpressionMapper::getConjunctiveComparisonEvaluator(
+    const expression_vector& predicates, const Schema* schema) {
+    if (predicates.size() < 2 || schema == nullptr) {
+        return nullptr;
+    }
+    std::vector<ExpressionType> comparisonTypes;
+    std::vector<std::unique_ptr<ExpressionEvaluator>> childrenEvaluators;
+    auto groupPos = INVALID_F_GROUP_POS;
+    for (auto& predicate : predicates) {
+        if (!isExpressionComparison(predicate->expressionType)) {
+            return nullptr;
+        }
+        auto left = predicate->getChild(0);
+        auto right = predicate->getChild(1);
+        if (left->getDataType() != right->getDataType() ||
+            !ConjunctiveComparisonEvaluator::isTypeSupported(left->getDataType())) {
+            return nullptr;
+        }
+        auto comparisonType = predicate->expressionType;
+        if (isNonNullConstant(*left)) {
+            std::swap(left, right);
+            comparisonType = getSwappedComparison(comparisonType);
+        }
+        if (!schema->isExpressionInScope(*left) || !isNonNullConstant(*right)) {
+            return nullptr;
+        }
+        if (groupPos == INVALID_F_GROUP_POS) {
+            groupPos = schema->getGroupPos(*left);
+        } else if (groupPos != schema->getGroupPos(*left)) {
+            return nullptr;
+        }
+        comparisonTypes.push_back(comparisonType);
+        childrenEvaluators.push_back(getReferenceEvaluator(left, schema));
+        childrenEvaluators.push_back(getEvaluator(right, schema));
+    }
+    return std::make_unique<ConjunctiveComparisonEvaluator>(
+        std::move(comparisonTypes), std::move(childrenEvaluators));
+}
+
 std::unique_ptr<ExpressionEvaluator> ExpressionMapper::getLiteralEvaluator(
     const Expression& expression) {
     auto& literalExpression = (LiteralExpression&)expression;
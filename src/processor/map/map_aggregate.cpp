@@ -1,10 +1,13 @@
 #include "binder/expression/function_expression.h"
+#include "function/aggregate/collect.h"
+#include "main/client_context.h"
 #include "planner/operator/logical_aggregate.h"
 #include "processor/operator/aggregate/hash_aggregate.h"
 #include "processor/operator/aggregate/hash_aggregate_scan.h"
 #include "processor/operator/aggregate/simple_aggregate.h"
 #include "processor/operator/aggregate/simple_aggregate_scan.h"
 #include "processor/plan_mapper.h"
+#include "storage/storage_manager.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::common;
@@ -93,6 +96,26 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapAggregate(LogicalOperator* logi
     }
 }
 
+// Aggregate states are spilled as raw bytes, so they can only be spilled if they don't depend on
+// memory outside of the hash table. This rules out distinct aggregates, whose states depend on the
+// distinct hash tables, as well as COLLECT and MIN/MAX of strings, whose states own buffers.
+static bool canSpillAggregateStates(
+    const std::vector<std::unique_ptr<AggregateFunction>>& aggregateFunctions) {
+    for (auto& aggregateFunction : aggregateFunctions) {
+        if (aggregateFunction->isFunctionDistinct() ||
+            aggregateFunction->name == CollectFunction::name) {
+            return false;
+        }
+        auto isMinMax = aggregateFunction->name == AggregateMinFunction::name ||
+                        aggregateFunction->name == AggregateMaxFunction::name;
+        if (isMinMax && LogicalType{aggregateFunction->parameterTypeIDs[0]}.getPhysicalType() ==
+                            PhysicalTypeID::STRING) {
+            return false;
+        }
+    }
+    return true;
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::createHashAggregate(
     const binder::expression_vector& keyExpressions,
     const binder::expression_vector& dependentKeyExpressions,
@@ -101,6 +124,15 @@ std::unique_ptr<PhysicalOperator> PlanMapper::createHashAggregate(
     std::vector<DataPos> aggregatesOutputPos, planner::Schema* inSchema, planner::Schema* outSchema,
     std::unique_ptr<PhysicalOperator> prevOperator, const std::string& paramsString) {
     auto sharedState = make_shared<HashAggregateSharedState>(aggregateFunctions);
+    if (canSpillAggregateStates(aggregateFunctions)) {
+        auto memoryLimit = clientContext->getClientConfig()->aggregateMemoryLimit;
+        if (memoryLimit == 0) {
+            memoryLimit =
+                clientContext->getMemoryManager()->getBufferManager()->getBufferPoolSize() / 2;
+        }
+        sharedState->enableSpilling(memoryLimit, clientContext->getVFSUnsafe(),
+            clientContext->getStorageManager()->getWAL()->getDirectory());
+    }
     auto flatKeyExpressions = getKeyExpressions(keyExpressions, *inSchema, true /* isFlat */);
     auto unFlatKeyExpressions = getKeyExpressions(keyExpressions, *inSchema, false /* isFlat */);
     auto aggregate = make_unique<HashAggregate>(std::make_unique<ResultSetDescriptor>(inSchema),
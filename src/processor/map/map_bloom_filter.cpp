@@ -0,0 +1,25 @@
+#include "planner/operator/sip/logical_bloom_filter.h"
+#include "processor/operator/bloom_filter.h"
+#include "processor/plan_mapper.h"
+
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace processor {
+
+std::unique_ptr<PhysicalOperator> PlanMapper::mapBloomFilter(LogicalOperator* logicalOperator) {
+    auto bloomFilter = (LogicalBloomFilter*)logicalOperator;
+    auto inSchema = bloomFilter->getChild(0)->getSchema();
+    auto prevOperator = mapOperator(logicalOperator->getChild(0).get());
+    std::vector<DataPos> keysPos;
+    for (auto& key : bloomFilter->getKeys()) {
+        keysPos.emplace_back(inSchema->getExpressionPos(*key));
+    }
+    // The filter is built by the hash join that this filter is set to, see mapHashJoin.
+    auto sharedState = std::make_shared<JoinBloomFilterSharedState>();
+    return std::make_unique<BloomFilter>(std::move(sharedState), std::move(keysPos),
+        bloomFilter->getGroupPosToSelect(), std::move(prevOperator), getOperatorID(), bloomFilter->getExpressionsForPrinting());
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -2,13 +2,45 @@
 #include "processor/operator/filter.h"
 #include "processor/plan_mapper.h"
 
+using namespace kuzu::binder;
 using namespace kuzu::planner;
 
 namespace kuzu {
 namespace processor {
 
+// Adjacent filters selecting the same data chunk are mapped to a single filter if their predicates
+// can be evaluated together as a conjunction of comparisons, which avoids pulling each vector
+// through one filter per predicate.
 std::unique_ptr<PhysicalOperator> PlanMapper::mapFilter(LogicalOperator* logicalOperator) {
     auto& logicalFilter = (const LogicalFilter&)*logicalOperator;
+    auto groupPosToSelect = logicalFilter.getGroupPosToSelect();
+    std::vector<LogicalFilter*> filters;
+    filters.push_back((LogicalFilter*)logicalOperator);
+    while (filters.back()->getChild(0)->getOperatorType() == LogicalOperatorType::FILTER) {
+        auto filter = (LogicalFilter*)filters.back()->getChild(0).get();
+        if (filter->getGroupPosToSelect() != groupPosToSelect) {
+            break;
+        }
+        filters.push_back(filter);
+    }
+    if (filters.size() > 1) {
+        // Predicates of the filters closer to the scan are evaluated first, same as without fusing.
+        expression_vector predicates;
+        std::string paramsString;
+        for (auto it = filters.rbegin(); it != filters.rend(); ++it) {
+            predicates.push_back((*it)->getPredicate());
+            paramsString += (paramsString.empty() ? "" : " AND ") +
+                            (*it)->getExpressionsForPrinting();
+        }
+        auto inSchema = filters.back()->getChild(0)->getSchema();
+        auto physicalRootExpr =
+            ExpressionMapper::getConjunctiveComparisonEvaluator(predicates, inSchema);
+        if (physicalRootExpr != nullptr) {
+            auto prevOperator = mapOperator(filters.back()->getChild(0).get());
+            return make_unique<Filter>(std::move(physicalRootExpr), groupPosToSelect,
+                std::move(prevOperator), getOperatorID(), paramsString);
+        }
+    }
     auto inSchema = logicalFilter.getChild(0)->getSchema();
     auto prevOperator = mapOperator(logicalOperator->getChild(0).get());
     auto physicalRootExpr = ExpressionMapper::getEvaluator(logicalFilter.getPredicate(), inSchema);
@@ -1,7 +1,11 @@
+#include "common/cast.h"
+#include "main/client_context.h"
 #include "planner/operator/logical_hash_join.h"
+#include "processor/operator/bloom_filter.h"
 #include "processor/operator/hash_join/hash_join_build.h"
 #include "processor/operator/hash_join/hash_join_probe.h"
 #include "processor/plan_mapper.h"
+#include "storage/storage_manager.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::planner;
@@ -86,6 +90,19 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(LogicalOperator* logic
     auto globalHashTable = std::make_unique<JoinHashTable>(*clientContext->getMemoryManager(),
         LogicalType::copy(buildKeyTypes), buildInfo->getTableSchema()->copy());
     auto sharedState = std::make_shared<HashJoinSharedState>(std::move(globalHashTable));
+    auto memoryLimit = clientContext->getClientConfig()->hashJoinMemoryLimit;
+    if (memoryLimit == 0) {
+        memoryLimit =
+            clientContext->getMemoryManager()->getBufferManager()->getBufferPoolSize() / 2;
+    }
+    sharedState->enableSpilling(memoryLimit, clientContext->getVFSUnsafe(),
+        clientContext->getStorageManager()->getWAL()->getDirectory());
+    if (hashJoin->getBloomFilter() != nullptr) {
+        // The probe side has been mapped, including the Bloom filter on it.
+        auto bloomFilter = ku_dynamic_cast<PhysicalOperator*, BloomFilter*>(
+            logicalOpToPhysicalOpMap.at(hashJoin->getBloomFilter()));
+        sharedState->setBloomFilterState(bloomFilter->getSharedState());
+    }
     auto hashJoinBuild =
         make_unique<HashJoinBuild>(std::make_unique<ResultSetDescriptor>(buildSchema), sharedState,
             std::move(buildInfo), std::move(buildSidePrevOperator), getOperatorID(), paramsString);
@@ -99,6 +116,15 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(LogicalOperator* logic
         probePayloadsOutPos.emplace_back(outSchema->getExpressionPos(*payload));
     }
     ProbeDataInfo probeDataInfo(probeKeysDataPos, probePayloadsOutPos);
+    expression_set probeSideExpressions{probeKeys.begin(), probeKeys.end()};
+    for (auto& expression : hashJoin->getChild(0)->getSchema()->getExpressionsInScope()) {
+        if (outSchema->isExpressionInScope(*expression)) {
+            probeSideExpressions.insert(expression);
+        }
+    }
+    for (auto& expression : probeSideExpressions) {
+        probeDataInfo.probeSideDataPos.emplace_back(outSchema->getExpressionPos(*expression));
+    }
     if (hashJoin->getJoinType() == JoinType::MARK) {
         auto mark = hashJoin->getMark();
         auto markOutputPos = DataPos(outSchema->getExpressionPos(*mark));
@@ -1,3 +1,4 @@
+#include "main/client_context.h"
 #include "planner/operator/logical_order_by.h"
 #include "processor/operator/order_by/order_by.h"
 #include "processor/operator/order_by/order_by_merge.h"
@@ -5,6 +6,7 @@
 #include "processor/operator/order_by/top_k.h"
 #include "processor/operator/order_by/top_k_scanner.h"
 #include "processor/plan_mapper.h"
+#include "storage/storage_manager.h"
 
 using namespace kuzu::common;
 using namespace kuzu::planner;
@@ -67,6 +69,16 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapOrderBy(LogicalOperator* logica
             outPos, topKSharedState, std::move(topK), getOperatorID(), paramsString);
     } else {
         auto orderBySharedState = std::make_shared<SortSharedState>();
+        // Payloads are spilled in batches of tuples, which rules out unflat payload columns.
+        if (orderByDataInfo->payloadTableSchema->getNumUnflatColumns() == 0) {
+            auto memoryLimit = clientContext->getClientConfig()->orderByMemoryLimit;
+            if (memoryLimit == 0) {
+                memoryLimit =
+                    clientContext->getMemoryManager()->getBufferManager()->getBufferPoolSize() / 2;
+            }
+            orderBySharedState->enableSpilling(memoryLimit, clientContext->getVFSUnsafe(),
+                clientContext->getStorageManager()->getWAL()->getDirectory());
+        }
         auto orderBy = make_unique<OrderBy>(std::make_unique<ResultSetDescriptor>(inSchema),
             std::move(orderByDataInfo), orderBySharedState, std::move(prevOperator),
             getOperatorID(), paramsString);
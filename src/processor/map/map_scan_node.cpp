@@ -1,23 +1,86 @@
+#include "binder/expression/literal_expression.h"
+#include "binder/expression/parameter_expression.h"
+#include "binder/expression/property_expression.h"
 #include "common/cast.h"
 #include "planner/operator/scan/logical_scan_internal_id.h"
 #include "processor/operator/scan_node_id.h"
 #include "processor/plan_mapper.h"
 #include "storage/storage_manager.h"
 
+using namespace kuzu::binder;
+using namespace kuzu::common;
 using namespace kuzu::planner;
+using namespace kuzu::storage;
 
 namespace kuzu {
 namespace processor {
 
+static ExpressionType flipComparison(ExpressionType comparison) {
+    switch (comparison) {
+    case ExpressionType::GREATER_THAN:
+        return ExpressionType::LESS_THAN;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return ExpressionType::LESS_THAN_EQUALS;
+    case ExpressionType::LESS_THAN:
+        return ExpressionType::GREATER_THAN;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return ExpressionType::GREATER_THAN_EQUALS;
+    default:
+        return comparison;
+    }
+}
+
+static Value* getConstantValue(const Expression& expression) {
+    if (expression.expressionType == ExpressionType::LITERAL) {
+        return ((LiteralExpression&)expression).getValue();
+    }
+    KU_ASSERT(expression.expressionType == ExpressionType::PARAMETER);
+    return ((ParameterExpression&)expression).getLiteral().get();
+}
+
+static std::vector<ZoneMapPredicate> getZoneMapPredicates(const expression_vector& predicates,
+    table_id_t tableID, catalog::TableCatalogEntry* tableEntry) {
+    std::vector<ZoneMapPredicate> result;
+    for (auto& predicate : predicates) {
+        auto comparison = predicate->expressionType;
+        auto propertyExpression = predicate->getChild(0);
+        auto constantExpression = predicate->getChild(1);
+        if (propertyExpression->expressionType != ExpressionType::PROPERTY) {
+            std::swap(propertyExpression, constantExpression);
+            comparison = flipComparison(comparison);
+        }
+        auto& property = (PropertyExpression&)*propertyExpression;
+        auto dataType = property.getDataType();
+        if (!property.hasPropertyID(tableID) || !ZoneMap::isSupported(dataType)) {
+            continue;
+        }
+        auto value = getConstantValue(*constantExpression);
+        if (value->isNull() ||
+            value->getDataType()->getLogicalTypeID() != dataType.getLogicalTypeID()) {
+            continue;
+        }
+        ValueVector vector{dataType};
+        vector.copyFromValue(0 /* pos */, *value);
+        auto physicalType = dataType.getPhysicalType();
+        result.push_back(ZoneMapPredicate{
+            tableEntry->getColumnID(property.getPropertyID(tableID)), comparison,
+            StorageValue::read(vector.getData(), 0 /* pos */, physicalType), physicalType});
+    }
+    return result;
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapScanInternalID(LogicalOperator* logicalOperator) {
-    auto scan = common::ku_dynamic_cast<LogicalOperator*, LogicalScanInternalID*>(logicalOperator);
+    auto scan = ku_dynamic_cast<LogicalOperator*, LogicalScanInternalID*>(logicalOperator);
     auto outSchema = scan->getSchema();
     auto dataPos = DataPos(outSchema->getExpressionPos(*scan->getInternalID()));
     auto sharedState = std::make_shared<ScanNodeIDSharedState>();
     for (auto& tableID : scan->getTableIDs()) {
-        auto nodeTable = common::ku_dynamic_cast<storage::Table*, storage::NodeTable*>(
+        auto nodeTable = ku_dynamic_cast<Table*, NodeTable*>(
             clientContext->getStorageManager()->getTable(tableID));
-        sharedState->addTableState(nodeTable);
+        auto tableEntry =
+            clientContext->getCatalog()->getTableCatalogEntry(clientContext->getTx(), tableID);
+        sharedState->addTableState(
+            nodeTable, getZoneMapPredicates(scan->getPropertyPredicates(), tableID, tableEntry));
     }
     return std::make_unique<ScanNodeID>(
         dataPos, sharedState, getOperatorID(), scan->getExpressionsForPrinting());
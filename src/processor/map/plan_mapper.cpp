@@ -69,6 +69,9 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapOperator(LogicalOperator* logic
     case LogicalOperatorType::SEMI_MASKER: {
         physicalOperator = mapSemiMasker(logicalOperator);
     } break;
+    case LogicalOperatorType::BLOOM_FILTER: {
+        physicalOperator = mapBloomFilter(logicalOperator);
+    } break;
     case LogicalOperatorType::HASH_JOIN: {
         physicalOperator = mapHashJoin(logicalOperator);
     } break;
@@ -65,54 +65,187 @@ bool AggregateHashTable::isAggregateValueDistinctForGroupByKeys(
 }
 
 void AggregateHashTable::merge(AggregateHashTable& other) {
-    std::shared_ptr<DataChunkState> vectorsToScanState = std::make_shared<DataChunkState>();
-    std::vector<ValueVector*> vectorsToScan(keyTypes.size() + dependentKeyDataTypes.size());
-    std::vector<ValueVector*> groupByHashVectors(keyTypes.size());
-    std::vector<ValueVector*> groupByNonHashVectors(dependentKeyDataTypes.size());
-    std::vector<std::unique_ptr<ValueVector>> hashKeyVectors(keyTypes.size());
-    std::vector<std::unique_ptr<ValueVector>> nonHashKeyVectors(groupByNonHashVectors.size());
-    for (auto i = 0u; i < keyTypes.size(); i++) {
-        auto hashKeyVec = std::make_unique<ValueVector>(keyTypes[i], &memoryManager);
-        hashKeyVec->state = vectorsToScanState;
-        vectorsToScan[i] = hashKeyVec.get();
-        groupByHashVectors[i] = hashKeyVec.get();
-        hashKeyVectors[i] = std::move(hashKeyVec);
-    }
-    for (auto i = 0u; i < dependentKeyDataTypes.size(); i++) {
-        auto nonHashKeyVec =
-            std::make_unique<ValueVector>(dependentKeyDataTypes[i], &memoryManager);
-        nonHashKeyVec->state = vectorsToScanState;
-        vectorsToScan[i + keyTypes.size()] = nonHashKeyVec.get();
-        groupByNonHashVectors[i] = nonHashKeyVec.get();
-        nonHashKeyVectors[i] = std::move(nonHashKeyVec);
-    }
-    hashVector->state = vectorsToScanState;
-    hashVector->setAllNonNull();
-    vectorsToScan.emplace_back(hashVector.get());
-
+    auto state = std::make_shared<DataChunkState>();
+    auto vectors = createVectorsToMerge(state);
+    std::vector<ValueVector*> vectorsToScan;
+    for (auto& vector : vectors) {
+        vectorsToScan.push_back(vector.get());
+    }
+    std::vector<ValueVector*> keyVectors{
+        vectorsToScan.begin(), vectorsToScan.begin() + keyTypes.size()};
+    std::vector<ValueVector*> dependentKeyVectors{
+        vectorsToScan.begin() + keyTypes.size(), vectorsToScan.end()};
+    vectorsToScan.push_back(hashVector.get());
     std::vector<uint32_t> colIdxesToScan(vectorsToScan.size() - 1);
     iota(colIdxesToScan.begin(), colIdxesToScan.end(), 0);
     // Note: we store hash values at the last column of factorizedTable.
     colIdxesToScan.push_back(factorizedTable->getTableSchema()->getNumColumns() - 1);
+    auto otherEntries = std::make_unique<uint8_t*[]>(DEFAULT_VECTOR_CAPACITY);
     uint64_t startTupleIdx = 0;
     while (startTupleIdx < other.factorizedTable->getNumTuples()) {
         auto numTuplesToScan = std::min(
             other.factorizedTable->getNumTuples() - startTupleIdx, DEFAULT_VECTOR_CAPACITY);
         other.factorizedTable->scan(vectorsToScan, startTupleIdx, numTuplesToScan, colIdxesToScan);
-        findHashSlots(std::vector<ValueVector*>(), groupByHashVectors, groupByNonHashVectors,
-            vectorsToScanState.get());
-        auto aggregateStateOffset = aggStateColOffsetInFT;
-        for (auto& aggregateFunction : aggregateFunctions) {
-            for (auto i = 0u; i < numTuplesToScan; i++) {
-                aggregateFunction->combineState(
-                    hashSlotsToUpdateAggState[i]->entry + aggregateStateOffset,
-                    other.factorizedTable->getTuple(startTupleIdx + i) + aggregateStateOffset,
-                    &memoryManager);
+        for (auto i = 0u; i < numTuplesToScan; i++) {
+            otherEntries[i] = other.factorizedTable->getTuple(startTupleIdx + i);
+        }
+        combineEntries(keyVectors, dependentKeyVectors, state.get(), otherEntries.get());
+        startTupleIdx += numTuplesToScan;
+    }
+}
+
+std::vector<std::vector<uint8_t*>> AggregateHashTable::getPartitionedEntries() const {
+    std::vector<std::vector<uint8_t*>> partitionedEntries(AggregateConstants::NUM_PARTITIONS);
+    for (auto i = 0u; i < factorizedTable->getNumTuples(); i++) {
+        auto entry = factorizedTable->getTuple(i);
+        partitionedEntries[getPartitionIdx(*(hash_t*)(entry + hashColOffsetInFT))].push_back(entry);
+    }
+    return partitionedEntries;
+}
+
+std::unique_ptr<AggregateHashTable> AggregateHashTable::createEmptyCopy(
+    uint64_t numEntriesToAllocate) const {
+    return std::make_unique<AggregateHashTable>(memoryManager, LogicalType::copy(keyTypes),
+        LogicalType::copy(dependentKeyDataTypes), aggregateFunctions, numEntriesToAllocate);
+}
+
+void AggregateHashTable::merge(AggregateHashTable& other, const std::vector<uint8_t*>& entries) {
+    auto state = std::make_shared<DataChunkState>();
+    auto vectors = createVectorsToMerge(state);
+    std::vector<ValueVector*> vectorsToScan;
+    for (auto& vector : vectors) {
+        vectorsToScan.push_back(vector.get());
+    }
+    std::vector<ValueVector*> keyVectors{
+        vectorsToScan.begin(), vectorsToScan.begin() + keyTypes.size()};
+    std::vector<ValueVector*> dependentKeyVectors{
+        vectorsToScan.begin() + keyTypes.size(), vectorsToScan.end()};
+    vectorsToScan.push_back(hashVector.get());
+    std::vector<uint32_t> colIdxesToScan(vectorsToScan.size() - 1);
+    iota(colIdxesToScan.begin(), colIdxesToScan.end(), 0);
+    colIdxesToScan.push_back(hashColIdxInFT);
+    auto otherEntries = const_cast<uint8_t**>(entries.data());
+    for (auto startIdx = 0u; startIdx < entries.size(); startIdx += DEFAULT_VECTOR_CAPACITY) {
+        auto numEntriesToScan =
+            std::min<uint64_t>(entries.size() - startIdx, DEFAULT_VECTOR_CAPACITY);
+        other.factorizedTable->lookup(
+            vectorsToScan, colIdxesToScan, otherEntries, startIdx, numEntriesToScan);
+        combineEntries(
+            keyVectors, dependentKeyVectors, state.get(), otherEntries + startIdx);
+    }
+}
+
+void AggregateHashTable::spill(const spill_files_t& partitionFiles) {
+    KU_ASSERT(partitionFiles.size() == AggregateConstants::NUM_PARTITIONS);
+    auto state = std::make_shared<DataChunkState>();
+    auto vectors = createVectorsToMerge(state);
+    std::vector<ValueVector*> vectorsToScan;
+    for (auto& vector : vectors) {
+        vectorsToScan.push_back(vector.get());
+    }
+    std::vector<uint32_t> colIdxesToScan(vectorsToScan.size());
+    iota(colIdxesToScan.begin(), colIdxesToScan.end(), 0);
+    auto numBytesForAggStates = hashColOffsetInFT - aggStateColOffsetInFT;
+    uint64_t startTupleIdx = 0;
+    while (startTupleIdx < factorizedTable->getNumTuples()) {
+        auto numTuplesToScan =
+            std::min(factorizedTable->getNumTuples() - startTupleIdx, DEFAULT_VECTOR_CAPACITY);
+        factorizedTable->scan(vectorsToScan, startTupleIdx, numTuplesToScan, colIdxesToScan);
+        for (auto i = 0u; i < numTuplesToScan; i++) {
+            auto entry = factorizedTable->getTuple(startTupleIdx + i);
+            auto hash = *(hash_t*)(entry + hashColOffsetInFT);
+            auto& file = *partitionFiles[getPartitionIdx(hash)];
+            for (auto& vector : vectors) {
+                file.writeValue(*vector, i);
             }
-            aggregateStateOffset += aggregateFunction->getAggregateStateSize();
+            file.write(entry + aggStateColOffsetInFT, numBytesForAggStates);
+            file.write<hash_t>(hash);
+            file.finishRow();
         }
         startTupleIdx += numTuplesToScan;
     }
+    // Hash slots are shrunk back to their initial size, so that they don't keep the memory usage of
+    // the table above the limit that it is spilled at.
+    factorizedTable->clear();
+    hashSlotsBlocks.clear();
+    initializeHashTable(0 /* numEntriesToAllocate */);
+}
+
+void AggregateHashTable::mergeSpilledEntries(const SpillFile& file) {
+    auto state = std::make_shared<DataChunkState>();
+    auto vectors = createVectorsToMerge(state);
+    std::vector<ValueVector*> keyVectors;
+    std::vector<ValueVector*> dependentKeyVectors;
+    for (auto i = 0u; i < vectors.size(); i++) {
+        if (i < keyTypes.size()) {
+            keyVectors.push_back(vectors[i].get());
+        } else {
+            dependentKeyVectors.push_back(vectors[i].get());
+        }
+    }
+    // Aggregate states are read into a buffer laid out like the entries of the table.
+    auto numBytesPerEntry = factorizedTable->getTableSchema()->getNumBytesPerTuple();
+    auto numBytesForAggStates = hashColOffsetInFT - aggStateColOffsetInFT;
+    auto spilledEntries = std::make_unique<uint8_t[]>(DEFAULT_VECTOR_CAPACITY * numBytesPerEntry);
+    auto spilledEntryPtrs = std::make_unique<uint8_t*[]>(DEFAULT_VECTOR_CAPACITY);
+    for (auto i = 0u; i < DEFAULT_VECTOR_CAPACITY; i++) {
+        spilledEntryPtrs[i] = spilledEntries.get() + i * numBytesPerEntry;
+    }
+    SpillFileReader reader{file};
+    auto numRows = file.getNumRows();
+    for (auto startIdx = 0u; startIdx < numRows; startIdx += DEFAULT_VECTOR_CAPACITY) {
+        auto numRowsToRead = std::min<uint64_t>(numRows - startIdx, DEFAULT_VECTOR_CAPACITY);
+        for (auto& vector : vectors) {
+            vector->resetAuxiliaryBuffer();
+        }
+        for (auto i = 0u; i < numRowsToRead; i++) {
+            for (auto& vector : vectors) {
+                reader.readValue(*vector, i);
+            }
+            reader.read(spilledEntryPtrs[i] + aggStateColOffsetInFT, numBytesForAggStates);
+            hashVector->setValue<hash_t>(i, reader.read<hash_t>());
+        }
+        state->initOriginalAndSelectedSize(numRowsToRead);
+        combineEntries(keyVectors, dependentKeyVectors, state.get(), spilledEntryPtrs.get());
+    }
+}
+
+uint64_t AggregateHashTable::getMemoryUsage() const {
+    return factorizedTable->getMemoryUsage() +
+           hashSlotsBlocks.size() * BufferPoolConstants::PAGE_256KB_SIZE;
+}
+
+std::vector<std::unique_ptr<ValueVector>> AggregateHashTable::createVectorsToMerge(
+    const std::shared_ptr<DataChunkState>& state) {
+    std::vector<std::unique_ptr<ValueVector>> vectors;
+    for (auto& type : keyTypes) {
+        vectors.push_back(std::make_unique<ValueVector>(type, &memoryManager));
+    }
+    for (auto& type : dependentKeyDataTypes) {
+        vectors.push_back(std::make_unique<ValueVector>(type, &memoryManager));
+    }
+    for (auto& vector : vectors) {
+        vector->state = state;
+    }
+    hashVector->state = state;
+    hashVector->setAllNonNull();
+    return vectors;
+}
+
+void AggregateHashTable::combineEntries(const std::vector<ValueVector*>& keyVectors,
+    const std::vector<ValueVector*>& dependentKeyVectors, DataChunkState* state,
+    uint8_t** otherEntries) {
+    auto numEntries = state->selVector->selectedSize;
+    resizeHashTableIfNecessary(numEntries);
+    findHashSlots(std::vector<ValueVector*>(), keyVectors, dependentKeyVectors, state);
+    auto aggregateStateOffset = aggStateColOffsetInFT;
+    for (auto& aggregateFunction : aggregateFunctions) {
+        for (auto i = 0u; i < numEntries; i++) {
+            aggregateFunction->combineState(hashSlotsToUpdateAggState[i]->entry + aggregateStateOffset,
+                otherEntries[i] + aggregateStateOffset, &memoryManager);
+        }
+        aggregateStateOffset += aggregateFunction->getAggregateStateSize();
+    }
 }
 
 void AggregateHashTable::finalizeAggregateStates() {
@@ -9,21 +9,53 @@ using namespace kuzu::storage;
 namespace kuzu {
 namespace processor {
 
+void HashAggregateSharedState::enableSpilling(
+    uint64_t memoryLimit_, VirtualFileSystem* vfs_, std::string spillDirectory_) {
+    memoryLimit = memoryLimit_;
+    vfs = vfs_;
+    spillDirectory = std::move(spillDirectory_);
+}
+
+spill_files_t HashAggregateSharedState::createPartitionFiles() const {
+    spill_files_t files;
+    for (auto i = 0u; i < AggregateConstants::NUM_PARTITIONS; i++) {
+        files.push_back(std::make_unique<SpillFile>(vfs, spillDirectory));
+    }
+    return files;
+}
+
 void HashAggregateSharedState::appendAggregateHashTable(
-    std::unique_ptr<AggregateHashTable> aggregateHashTable) {
+    std::unique_ptr<AggregateHashTable> aggregateHashTable,
+    std::vector<std::vector<uint8_t*>> partitionedEntries, spill_files_t localPartitionFiles) {
     std::unique_lock lck{mtx};
     localAggregateHashTables.push_back(std::move(aggregateHashTable));
+    localPartitionedEntries.push_back(std::move(partitionedEntries));
+    if (localPartitionFiles.empty()) {
+        return;
+    }
+    partitionFiles.resize(AggregateConstants::NUM_PARTITIONS);
+    for (auto i = 0u; i < localPartitionFiles.size(); i++) {
+        localPartitionFiles[i]->finishWriting();
+        partitionFiles[i].push_back(std::move(localPartitionFiles[i]));
+    }
 }
 
 void HashAggregateSharedState::combineAggregateHashTable(MemoryManager& /*memoryManager*/) {
     std::unique_lock lck{mtx};
+    uint64_t numEntries = 0;
+    for (auto& ht : localAggregateHashTables) {
+        numEntries += ht->getNumEntries();
+    }
+    partitioned = !partitionFiles.empty() ||
+                  (localAggregateHashTables.size() > 1 &&
+                      numEntries >= AggregateConstants::MIN_NUM_ENTRIES_TO_PARTITION);
+    if (partitioned) {
+        return;
+    }
+    localPartitionedEntries.clear();
     if (localAggregateHashTables.size() == 1) {
         globalAggregateHashTable = std::move(localAggregateHashTables[0]);
     } else {
-        auto numEntries = 0u;
-        for (auto& ht : localAggregateHashTables) {
-            numEntries += ht->getNumEntries();
-        }
         localAggregateHashTables[0]->resize(nextPowerOfTwo(numEntries));
         globalAggregateHashTable = std::move(localAggregateHashTables[0]);
         for (auto i = 1u; i < localAggregateHashTables.size(); i++) {
@@ -34,9 +66,59 @@ void HashAggregateSharedState::combineAggregateHashTable(MemoryManager& /*memory
 
 void HashAggregateSharedState::finalizeAggregateHashTable() {
     std::unique_lock lck{mtx};
+    if (partitioned) {
+        // Aggregate states of each partition are finalized once the partition is merged.
+        return;
+    }
     globalAggregateHashTable->finalizeAggregateStates();
 }
 
+std::unique_ptr<AggregateHashTable> HashAggregateSharedState::mergeNextPartition() {
+    uint64_t partitionIdx;
+    {
+        std::unique_lock lck{mtx};
+        if (nextPartitionIdx >= AggregateConstants::NUM_PARTITIONS) {
+            return nullptr;
+        }
+        partitionIdx = nextPartitionIdx++;
+    }
+    // Local hash tables and spill files are only read from here, and each partition is merged by a
+    // single thread, so no lock is needed while merging.
+    uint64_t numEntries = 0;
+    for (auto& partitionedEntries : localPartitionedEntries) {
+        numEntries += partitionedEntries[partitionIdx].size();
+    }
+    auto hashTable = localAggregateHashTables[0]->createEmptyCopy(numEntries);
+    for (auto i = 0u; i < localAggregateHashTables.size(); i++) {
+        hashTable->merge(*localAggregateHashTables[i], localPartitionedEntries[i][partitionIdx]);
+    }
+    if (!partitionFiles.empty()) {
+        for (auto& file : partitionFiles[partitionIdx]) {
+            hashTable->mergeSpilledEntries(*file);
+        }
+        partitionFiles[partitionIdx].clear();
+    }
+    hashTable->finalizeAggregateStates();
+    return hashTable;
+}
+
+uint64_t HashAggregateSharedState::getNumTuples() {
+    std::unique_lock lck{mtx};
+    if (!partitioned) {
+        return globalAggregateHashTable->getNumEntries();
+    }
+    uint64_t numTuples = 0;
+    for (auto& ht : localAggregateHashTables) {
+        numTuples += ht->getNumEntries();
+    }
+    for (auto& files : partitionFiles) {
+        for (auto& file : files) {
+            numTuples += file->getNumRows();
+        }
+    }
+    return numTuples;
+}
+
 std::pair<uint64_t, uint64_t> HashAggregateSharedState::getNextRangeToRead() {
     std::unique_lock lck{mtx};
     if (currentOffset >= globalAggregateHashTable->getNumEntries()) {
@@ -76,11 +158,21 @@ void HashAggregate::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
 }
 
 void HashAggregate::executeInternal(ExecutionContext* context) {
+    auto numThreads = context->clientContext->getClientConfig()->numThreads;
     while (children[0]->getNextTuple(context)) {
         localAggregateHashTable->append(flatKeyVectors, unFlatKeyVectors, dependentKeyVectors,
             leadingState, aggregateInputs, resultSet->multiplicity);
+        if (sharedState->isSpillingEnabled() && localAggregateHashTable->getNumEntries() > 0 &&
+            localAggregateHashTable->getMemoryUsage() > sharedState->getMemoryLimit() / numThreads) {
+            if (localPartitionFiles.empty()) {
+                localPartitionFiles = sharedState->createPartitionFiles();
+            }
+            localAggregateHashTable->spill(localPartitionFiles);
+        }
     }
-    sharedState->appendAggregateHashTable(std::move(localAggregateHashTable));
+    auto partitionedEntries = localAggregateHashTable->getPartitionedEntries();
+    sharedState->appendAggregateHashTable(std::move(localAggregateHashTable),
+        std::move(partitionedEntries), std::move(localPartitionFiles));
 }
 
 void HashAggregate::finalize(ExecutionContext* context) {
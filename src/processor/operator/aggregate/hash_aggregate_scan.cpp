@@ -1,5 +1,6 @@
 #include "processor/operator/aggregate/hash_aggregate_scan.h"
 
+using namespace kuzu::common;
 using namespace kuzu::function;
 
 namespace kuzu {
@@ -16,25 +17,42 @@ void HashAggregateScan::initLocalStateInternal(ResultSet* resultSet, ExecutionCo
 }
 
 bool HashAggregateScan::getNextTuplesInternal(ExecutionContext* /*context*/) {
-    auto [startOffset, endOffset] = sharedState->getNextRangeToRead();
-    if (startOffset >= endOffset) {
-        return false;
+    if (!sharedState->isPartitioned()) {
+        auto [startOffset, endOffset] = sharedState->getNextRangeToRead();
+        if (startOffset >= endOffset) {
+            return false;
+        }
+        scanEntries(sharedState->getGlobalHashTable(), startOffset, endOffset - startOffset);
+        return true;
+    }
+    while (partitionHashTable == nullptr || nextEntryIdx >= partitionHashTable->getNumEntries()) {
+        partitionHashTable = sharedState->mergeNextPartition();
+        nextEntryIdx = 0;
+        if (partitionHashTable == nullptr) {
+            return false;
+        }
     }
-    auto numRowsToScan = endOffset - startOffset;
-    sharedState->getFactorizedTable()->scan(
-        groupByKeyVectors, startOffset, numRowsToScan, groupByKeyVectorsColIdxes);
-    for (auto pos = 0u; pos < numRowsToScan; ++pos) {
-        auto entry = sharedState->getRow(startOffset + pos);
-        auto offset = sharedState->getFactorizedTable()->getTableSchema()->getColOffset(
-            groupByKeyVectors.size());
+    auto numEntriesToScan =
+        std::min(DEFAULT_VECTOR_CAPACITY, partitionHashTable->getNumEntries() - nextEntryIdx);
+    scanEntries(*partitionHashTable, nextEntryIdx, numEntriesToScan);
+    nextEntryIdx += numEntriesToScan;
+    return true;
+}
+
+void HashAggregateScan::scanEntries(
+    AggregateHashTable& hashTable, uint64_t startOffset, uint64_t numEntries) {
+    auto factorizedTable = hashTable.getFactorizedTable();
+    factorizedTable->scan(groupByKeyVectors, startOffset, numEntries, groupByKeyVectorsColIdxes);
+    for (auto pos = 0u; pos < numEntries; ++pos) {
+        auto entry = hashTable.getEntry(startOffset + pos);
+        auto offset = factorizedTable->getTableSchema()->getColOffset(groupByKeyVectors.size());
         for (auto& vector : aggregateVectors) {
             auto aggState = (AggregateState*)(entry + offset);
             writeAggregateResultToVector(*vector, pos, aggState);
             offset += aggState->getStateSize();
         }
     }
-    metrics->numOutputTuple.increase(numRowsToScan);
-    return true;
+    metrics->numOutputTuple.increase(numEntries);
 }
 
 } // namespace processor
@@ -0,0 +1,78 @@
+#include "processor/operator/bloom_filter.h"
+
+#include "processor/operator/hash_join/join_hash_table.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+void BloomFilter::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
+    for (auto& pos : keysPos) {
+        keyVectors.push_back(resultSet->getValueVector(pos).get());
+    }
+    keyState = resultSet->dataChunks[dataChunkToSelectPos]->state.get();
+    auto memoryManager = context->clientContext->getMemoryManager();
+    hashVector = std::make_unique<ValueVector>(LogicalTypeID::INT64, memoryManager);
+    if (keyVectors.size() > 1) {
+        tmpHashVector = std::make_unique<ValueVector>(LogicalTypeID::INT64, memoryManager);
+    }
+}
+
+bool BloomFilter::getNextTuplesInternal(ExecutionContext* context) {
+    if (sharedState->filter == nullptr) {
+        // The build side is spilled or too large to be filtered on.
+        if (!children[0]->getNextTuple(context)) {
+            return false;
+        }
+        metrics->numOutputTuple.increase(keyState->selVector->selectedSize);
+        return true;
+    }
+    sel_t numSelectedValues;
+    do {
+        restoreSelVector(keyState->selVector);
+        if (!children[0]->getNextTuple(context)) {
+            return false;
+        }
+        saveSelVector(keyState->selVector);
+        numSelectedValues = hasNonNullFlatKeys() ? selectKeysInFilter() : 0;
+    } while (numSelectedValues == 0);
+    metrics->numOutputTuple.increase(numSelectedValues);
+    return true;
+}
+
+bool BloomFilter::hasNonNullFlatKeys() const {
+    for (auto& vector : keyVectors) {
+        if (vector->state.get() != keyState &&
+            vector->isNull(vector->state->selVector->selectedPositions[0])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+sel_t BloomFilter::selectKeysInFilter() {
+    // Only the selection vector of the key state is overwritten by this operator, so null keys are
+    // only discarded from it.
+    for (auto& vector : keyVectors) {
+        if (vector->state.get() == keyState && !ValueVector::discardNull(*vector)) {
+            return 0;
+        }
+    }
+    JoinHashTable::computeKeyHashes(keyVectors, hashVector.get(), tmpHashVector.get());
+    auto filter = sharedState->filter.get();
+    auto hashes = reinterpret_cast<hash_t*>(hashVector->getData());
+    auto selVector = keyState->selVector.get();
+    auto buffer = selVector->getMultableBuffer();
+    sel_t numSelectedValues = 0;
+    for (auto i = 0u; i < selVector->selectedSize; ++i) {
+        auto pos = selVector->selectedPositions[i];
+        buffer[numSelectedValues] = pos;
+        numSelectedValues += filter->mayContain(hashes[pos]);
+    }
+    selVector->setToFiltered(numSelectedValues);
+    return numSelectedValues;
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -6,9 +6,62 @@ using namespace kuzu::storage;
 namespace kuzu {
 namespace processor {
 
-void HashJoinSharedState::mergeLocalHashTable(JoinHashTable& localHashTable) {
+bool HashJoinSharedState::mergeLocalHashTable(JoinHashTable& localHashTable) {
     std::unique_lock lck(mtx);
+    if (spilling) {
+        return false;
+    }
     hashTable->merge(localHashTable);
+    return true;
+}
+
+void HashJoinSharedState::enableSpilling(
+    uint64_t memoryLimit_, VirtualFileSystem* vfs_, std::string spillDirectory_) {
+    memoryLimit = memoryLimit_;
+    vfs = vfs_;
+    spillDirectory = std::move(spillDirectory_);
+    partitionFiles.resize(HashJoinConstants::NUM_PARTITIONS);
+}
+
+bool HashJoinSharedState::updateMemoryUsage(uint64_t prevMemoryUsage, uint64_t newMemoryUsage) {
+    uint64_t totalMemoryUsage;
+    if (newMemoryUsage >= prevMemoryUsage) {
+        auto delta = newMemoryUsage - prevMemoryUsage;
+        totalMemoryUsage = memoryUsage.fetch_add(delta) + delta;
+    } else {
+        auto delta = prevMemoryUsage - newMemoryUsage;
+        totalMemoryUsage = memoryUsage.fetch_sub(delta) - delta;
+    }
+    return totalMemoryUsage > memoryLimit;
+}
+
+spill_files_t HashJoinSharedState::createPartitionFiles() const {
+    spill_files_t files;
+    for (auto i = 0u; i < HashJoinConstants::NUM_PARTITIONS; i++) {
+        files.push_back(std::make_unique<SpillFile>(vfs, spillDirectory));
+    }
+    return files;
+}
+
+void HashJoinSharedState::startSpilling(
+    HashJoinSpiller& spiller, const spill_files_t& localPartitionFiles) {
+    std::unique_lock lck(mtx);
+    if (spilling) {
+        return;
+    }
+    auto prevMemoryUsage = hashTable->getFactorizedTable()->getMemoryUsage();
+    spiller.spill(*hashTable, localPartitionFiles);
+    updateMemoryUsage(prevMemoryUsage, hashTable->getFactorizedTable()->getMemoryUsage());
+    spilling = true;
+}
+
+void HashJoinSharedState::mergePartitionFiles(spill_files_t& localPartitionFiles) {
+    std::unique_lock lck(mtx);
+    for (auto i = 0u; i < localPartitionFiles.size(); i++) {
+        localPartitionFiles[i]->finishWriting();
+        partitionFiles[i].push_back(std::move(localPartitionFiles[i]));
+    }
+    localPartitionFiles.clear();
 }
 
 void HashJoinBuild::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
@@ -27,8 +80,20 @@ void HashJoinBuild::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
     for (auto& pos : info->payloadsPos) {
         payloadVectors.push_back(resultSet->getValueVector(pos).get());
     }
-    hashTable = std::make_unique<JoinHashTable>(*context->clientContext->getMemoryManager(),
-        std::move(keyTypes), info->tableSchema->copy());
+    auto memoryManager = context->clientContext->getMemoryManager();
+    if (sharedState->isSpillingEnabled()) {
+        std::vector<LogicalType> columnTypes;
+        for (auto& vector : keyVectors) {
+            columnTypes.push_back(vector->dataType);
+        }
+        for (auto& vector : payloadVectors) {
+            columnTypes.push_back(vector->dataType);
+        }
+        spiller = std::make_unique<HashJoinSpiller>(
+            *info->tableSchema, info->getNumKeys(), columnTypes, memoryManager);
+    }
+    hashTable = std::make_unique<JoinHashTable>(
+        *memoryManager, std::move(keyTypes), info->tableSchema->copy());
 }
 
 void HashJoinBuild::setKeyState(common::DataChunkState* state) {
@@ -40,9 +105,17 @@ void HashJoinBuild::setKeyState(common::DataChunkState* state) {
 }
 
 void HashJoinBuild::finalize(ExecutionContext* /*context*/) {
+    if (sharedState->isSpilling()) {
+        // Hash slots are built for one partition at a time while probing.
+        return;
+    }
     auto numTuples = sharedState->getHashTable()->getNumTuples();
     sharedState->getHashTable()->allocateHashSlots(numTuples);
     sharedState->getHashTable()->buildHashSlots();
+    auto bloomFilterState = sharedState->getBloomFilterState();
+    if (bloomFilterState != nullptr) {
+        bloomFilterState->filter = JoinBloomFilter::build(*sharedState->getHashTable());
+    }
 }
 
 void HashJoinBuild::executeInternal(ExecutionContext* context) {
@@ -51,9 +124,52 @@ void HashJoinBuild::executeInternal(ExecutionContext* context) {
         for (auto i = 0u; i < resultSet->multiplicity; ++i) {
             appendVectors();
         }
+        if (spiller != nullptr) {
+            updateMemoryUsage(context);
+        }
+    }
+    // Merge with global hash table once local tuples are all appended. If the build side is being
+    // spilled, local tuples are spilled as well.
+    if (!sharedState->mergeLocalHashTable(*hashTable)) {
+        spillLocalHashTable();
+    }
+    if (!localPartitionFiles.empty()) {
+        sharedState->mergePartitionFiles(localPartitionFiles);
+    }
+}
+
+void HashJoinBuild::updateMemoryUsage(ExecutionContext* context) {
+    auto memoryUsage = hashTable->getFactorizedTable()->getMemoryUsage();
+    auto exceedsMemoryLimit = sharedState->updateMemoryUsage(reportedMemoryUsage, memoryUsage);
+    reportedMemoryUsage = memoryUsage;
+    if (!sharedState->isSpilling()) {
+        if (!exceedsMemoryLimit) {
+            return;
+        }
+        if (localPartitionFiles.empty()) {
+            localPartitionFiles = sharedState->createPartitionFiles();
+        }
+        sharedState->startSpilling(*spiller, localPartitionFiles);
+        spillLocalHashTable();
+        return;
+    }
+    // Once the build side is spilled, each thread spills its tuples whenever they exceed its share
+    // of the memory limit.
+    auto numThreads = context->clientContext->getClientConfig()->numThreads;
+    if (memoryUsage > sharedState->getMemoryLimit() / numThreads) {
+        spillLocalHashTable();
+    }
+}
+
+void HashJoinBuild::spillLocalHashTable() {
+    KU_ASSERT(spiller != nullptr);
+    if (localPartitionFiles.empty()) {
+        localPartitionFiles = sharedState->createPartitionFiles();
     }
-    // Merge with global hash table once local tuples are all appended.
-    sharedState->mergeLocalHashTable(*hashTable);
+    spiller->spill(*hashTable, localPartitionFiles);
+    auto memoryUsage = hashTable->getFactorizedTable()->getMemoryUsage();
+    sharedState->updateMemoryUsage(reportedMemoryUsage, memoryUsage);
+    reportedMemoryUsage = memoryUsage;
 }
 
 } // namespace processor
@@ -29,6 +29,183 @@ void HashJoinProbe::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
         tmpHashVector = std::make_unique<ValueVector>(
             LogicalTypeID::INT64, context->clientContext->getMemoryManager());
     }
+    hashTable = sharedState->getHashTable();
+    if (sharedState->isSpilling()) {
+        initSpillState(resultSet, context);
+    }
+}
+
+void HashJoinProbe::initSpillState(ResultSet* resultSet, ExecutionContext* context) {
+    spillState = std::make_unique<ProbeSpillState>();
+    spillState->memoryManager = context->clientContext->getMemoryManager();
+    std::vector<LogicalType> buildColumnTypes;
+    for (auto& type : hashTable->getKeyTypes()) {
+        buildColumnTypes.push_back(type);
+    }
+    for (auto& vector : vectorsToReadInto) {
+        buildColumnTypes.push_back(vector->dataType);
+    }
+    spillState->buildSpiller = std::make_unique<HashJoinSpiller>(*hashTable->getTableSchema(),
+        keyVectors.size(), buildColumnTypes, spillState->memoryManager);
+    std::unordered_map<data_chunk_pos_t, uint32_t> chunkIdxes;
+    for (auto& dataPos : probeDataInfo.probeSideDataPos) {
+        if (!chunkIdxes.contains(dataPos.dataChunkPos)) {
+            chunkIdxes.insert({dataPos.dataChunkPos, spillState->chunkVectors.size()});
+            spillState->chunkVectors.emplace_back();
+            spillState->chunkStates.push_back(
+                resultSet->dataChunks[dataPos.dataChunkPos]->state.get());
+            spillState->chunkSelVectors.push_back(
+                std::make_shared<SelectionVector>(DEFAULT_VECTOR_CAPACITY));
+        }
+        spillState->chunkVectors[chunkIdxes.at(dataPos.dataChunkPos)].push_back(
+            resultSet->getValueVector(dataPos).get());
+    }
+    if (!flatProbe) {
+        spillState->keyChunkIdx = chunkIdxes.at(probeDataInfo.keysDataPos[0].dataChunkPos);
+    }
+}
+
+bool HashJoinProbe::getNextProbeTuples(ExecutionContext* context) {
+    if (spillState == nullptr) {
+        return children[0]->getNextTuple(context);
+    }
+    if (!spillState->isProbeSideSpilled) {
+        spillProbeTuples(context);
+        spillState->isProbeSideSpilled = true;
+    }
+    return readSpilledProbeTuples();
+}
+
+void HashJoinProbe::spillProbeTuples(ExecutionContext* context) {
+    spillState->partitionFiles = sharedState->createPartitionFiles();
+    while (children[0]->getNextTuple(context)) {
+        if (spillState->isChunkFlat.empty()) {
+            for (auto& state : spillState->chunkStates) {
+                spillState->isChunkFlat.push_back(state->isFlat());
+            }
+        }
+        // Tuples with null keys don't match, but are spilled as well, since they are still part
+        // of the output of left, count and mark joins.
+        JoinHashTable::computeKeyHashes(keyVectors, hashVector.get(), tmpHashVector.get());
+        auto selVector = hashVector->state->selVector.get();
+        if (flatProbe) {
+            auto hash = hashVector->getValue<hash_t>(selVector->selectedPositions[0]);
+            writeProbeRow(*spillState->partitionFiles[HashJoinSpiller::getPartitionIdx(hash)],
+                UINT32_MAX /* keyPos */);
+            continue;
+        }
+        for (auto i = 0u; i < selVector->selectedSize; i++) {
+            auto pos = selVector->selectedPositions[i];
+            auto hash = hashVector->getValue<hash_t>(pos);
+            writeProbeRow(
+                *spillState->partitionFiles[HashJoinSpiller::getPartitionIdx(hash)], pos);
+        }
+    }
+    for (auto& file : spillState->partitionFiles) {
+        file->finishWriting();
+    }
+}
+
+// A row holds the values of one probe tuple, chunk by chunk. For the chunk of an unflat key, it
+// holds the values at the key's position. For any other unflat chunk, it holds the number of
+// selected values, followed by the values.
+void HashJoinProbe::writeProbeRow(SpillFile& file, sel_t keyPos) {
+    for (auto i = 0u; i < spillState->chunkVectors.size(); i++) {
+        auto& vectors = spillState->chunkVectors[i];
+        auto selVector = spillState->chunkStates[i]->selVector.get();
+        if (i == spillState->keyChunkIdx || spillState->isChunkFlat[i]) {
+            auto pos = i == spillState->keyChunkIdx ? keyPos : selVector->selectedPositions[0];
+            for (auto& vector : vectors) {
+                file.writeValue(*vector, pos);
+            }
+            continue;
+        }
+        file.write<uint32_t>(selVector->selectedSize);
+        for (auto j = 0u; j < selVector->selectedSize; j++) {
+            auto pos = selVector->selectedPositions[j];
+            for (auto& vector : vectors) {
+                file.writeValue(*vector, pos);
+            }
+        }
+    }
+    file.finishRow();
+}
+
+bool HashJoinProbe::readSpilledProbeTuples() {
+    while (spillState->numRowsToRead == 0) {
+        if (spillState->nextPartitionIdx == HashJoinConstants::NUM_PARTITIONS) {
+            return false;
+        }
+        loadPartition(spillState->nextPartitionIdx++);
+    }
+    for (auto i = 0u; i < spillState->chunkVectors.size(); i++) {
+        for (auto& vector : spillState->chunkVectors[i]) {
+            vector->resetAuxiliaryBuffer();
+        }
+        spillState->chunkStates[i]->selVector = spillState->chunkSelVectors[i];
+    }
+    // Tuples with an unflat key can be read in a batch if there are no other chunks.
+    if (spillState->keyChunkIdx != UINT32_MAX && spillState->chunkVectors.size() == 1) {
+        auto numRowsToRead =
+            std::min<uint64_t>(DEFAULT_VECTOR_CAPACITY, spillState->numRowsToRead);
+        for (auto i = 0u; i < numRowsToRead; i++) {
+            for (auto& vector : spillState->chunkVectors[0]) {
+                spillState->reader->readValue(*vector, i);
+            }
+        }
+        spillState->chunkSelVectors[0]->setToUnfiltered(numRowsToRead);
+        spillState->chunkStates[0]->setOriginalSize(numRowsToRead);
+        spillState->numRowsToRead -= numRowsToRead;
+        return true;
+    }
+    readProbeRow();
+    spillState->numRowsToRead--;
+    return true;
+}
+
+void HashJoinProbe::readProbeRow() {
+    auto reader = spillState->reader.get();
+    for (auto i = 0u; i < spillState->chunkVectors.size(); i++) {
+        auto& vectors = spillState->chunkVectors[i];
+        auto state = spillState->chunkStates[i];
+        uint32_t numValues = 1;
+        if (spillState->isChunkFlat[i]) {
+            state->setToFlat();
+        } else if (i != spillState->keyChunkIdx) {
+            numValues = reader->read<uint32_t>();
+        }
+        for (auto j = 0u; j < numValues; j++) {
+            for (auto& vector : vectors) {
+                reader->readValue(*vector, j);
+            }
+        }
+        spillState->chunkSelVectors[i]->setToUnfiltered(numValues);
+        state->setOriginalSize(numValues);
+    }
+}
+
+void HashJoinProbe::loadPartition(uint64_t partitionIdx) {
+    // Release the previous partition before loading the next one.
+    spillState->reader.reset();
+    spillState->partitionHashTable.reset();
+    auto& probeFile = *spillState->partitionFiles[partitionIdx];
+    spillState->numRowsToRead = probeFile.getNumRows();
+    if (spillState->numRowsToRead == 0) {
+        return;
+    }
+    auto globalHashTable = sharedState->getHashTable();
+    spillState->partitionHashTable = std::make_unique<JoinHashTable>(*spillState->memoryManager,
+        LogicalType::copy(globalHashTable->getKeyTypes()),
+        globalHashTable->getTableSchema()->copy());
+    auto partitionHashTable = spillState->partitionHashTable.get();
+    spillState->buildSpiller->load(
+        sharedState->getPartitionFiles(partitionIdx), *partitionHashTable);
+    if (partitionHashTable->getNumTuples() > 0) {
+        partitionHashTable->allocateHashSlots(partitionHashTable->getNumTuples());
+        partitionHashTable->buildHashSlots();
+    }
+    hashTable = partitionHashTable;
+    spillState->reader = std::make_unique<SpillFileReader>(probeFile);
 }
 
 bool HashJoinProbe::getMatchedTuplesForFlatKey(ExecutionContext* context) {
@@ -41,14 +218,14 @@ bool HashJoinProbe::getMatchedTuplesForFlatKey(ExecutionContext* context) {
         // which changes the selected position.
         // TODO(Guodong): we have potential bugs here because all keys' states should be restored.
         restoreSelVector(keyVectors[0]->state->selVector);
-        if (!children[0]->getNextTuple(context)) {
+        if (!getNextProbeTuples(context)) {
             return false;
         }
         saveSelVector(keyVectors[0]->state->selVector);
-        sharedState->getHashTable()->probe(
+        hashTable->probe(
             keyVectors, hashVector.get(), tmpHashVector.get(), probeState->probedTuples.get());
     }
-    auto numMatchedTuples = sharedState->getHashTable()->matchFlatKeys(
+    auto numMatchedTuples = hashTable->matchFlatKeys(
         keyVectors, probeState->probedTuples.get(), probeState->matchedTuples.get());
     probeState->matchedSelVector->selectedSize = numMatchedTuples;
     probeState->nextMatchedTupleIdx = 0;
@@ -59,14 +236,14 @@ bool HashJoinProbe::getMatchedTuplesForUnFlatKey(ExecutionContext* context) {
     KU_ASSERT(keyVectors.size() == 1);
     auto keyVector = keyVectors[0];
     restoreSelVector(keyVector->state->selVector);
-    if (!children[0]->getNextTuple(context)) {
+    if (!getNextProbeTuples(context)) {
         return false;
     }
     saveSelVector(keyVector->state->selVector);
-    sharedState->getHashTable()->probe(
+    hashTable->probe(
         keyVectors, hashVector.get(), tmpHashVector.get(), probeState->probedTuples.get());
     auto numMatchedTuples =
-        sharedState->getHashTable()->matchUnFlatKey(keyVector, probeState->probedTuples.get(),
+        hashTable->matchUnFlatKey(keyVector, probeState->probedTuples.get(),
             probeState->matchedTuples.get(), probeState->matchedSelVector.get());
     probeState->matchedSelVector->selectedSize = numMatchedTuples;
     probeState->nextMatchedTupleIdx = 0;
@@ -78,7 +255,7 @@ uint64_t HashJoinProbe::getInnerJoinResultForFlatKey() {
         return 0;
     }
     auto numTuplesToRead = 1;
-    sharedState->getHashTable()->lookup(vectorsToReadInto, columnIdxsToReadFrom,
+    hashTable->lookup(vectorsToReadInto, columnIdxsToReadFrom,
         probeState->matchedTuples.get(), probeState->nextMatchedTupleIdx, numTuplesToRead);
     probeState->nextMatchedTupleIdx += numTuplesToRead;
     return numTuplesToRead;
@@ -98,7 +275,7 @@ uint64_t HashJoinProbe::getInnerJoinResultForUnFlatKey() {
         }
         keySelVector->setToFiltered(numTuplesToRead);
     }
-    sharedState->getHashTable()->lookup(vectorsToReadInto, columnIdxsToReadFrom,
+    hashTable->lookup(vectorsToReadInto, columnIdxsToReadFrom,
         probeState->matchedTuples.get(), probeState->nextMatchedTupleIdx, numTuplesToRead);
     probeState->nextMatchedTupleIdx += numTuplesToRead;
     return numTuplesToRead;
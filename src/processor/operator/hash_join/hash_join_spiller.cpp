@@ -0,0 +1,114 @@
+#include "processor/operator/hash_join/hash_join_spiller.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace processor {
+
+HashJoinSpiller::HashJoinSpiller(const FactorizedTableSchema& tableSchema, uint32_t numKeys,
+    const std::vector<LogicalType>& columnTypes, MemoryManager* memoryManager)
+    : hasUnflatCol{false} {
+    for (auto i = 0u; i < columnTypes.size(); i++) {
+        colIdxes.push_back(i);
+        isUnflatCol.push_back(!tableSchema.getColumn(i)->isFlat());
+        hasUnflatCol |= isUnflatCol.back();
+    }
+    if (hasUnflatCol) {
+        keyState = DataChunkState::getSingleValueDataChunkState();
+    } else {
+        keyState = std::make_shared<DataChunkState>();
+    }
+    for (auto i = 0u; i < columnTypes.size(); i++) {
+        auto vector = std::make_unique<ValueVector>(columnTypes[i], memoryManager);
+        if (isUnflatCol[i]) {
+            unflatColStates.push_back(std::make_shared<DataChunkState>());
+            vector->setState(unflatColStates.back());
+        } else {
+            vector->setState(keyState);
+        }
+        vectorPtrs.push_back(vector.get());
+        if (i < numKeys) {
+            keyVectors.push_back(vector.get());
+        } else {
+            payloadVectors.push_back(vector.get());
+        }
+        vectors.push_back(std::move(vector));
+    }
+}
+
+void HashJoinSpiller::spill(JoinHashTable& hashTable, const spill_files_t& partitionFiles) {
+    KU_ASSERT(partitionFiles.size() == HashJoinConstants::NUM_PARTITIONS);
+    auto factorizedTable = hashTable.getFactorizedTable();
+    auto numTuples = factorizedTable->getNumTuples();
+    // Unflat columns can only be scanned one tuple at a time.
+    auto batchSize = hasUnflatCol ? 1 : DEFAULT_VECTOR_CAPACITY;
+    for (auto startIdx = 0u; startIdx < numTuples; startIdx += batchSize) {
+        auto numTuplesToScan = std::min<uint64_t>(batchSize, numTuples - startIdx);
+        if (!hasUnflatCol) {
+            keyState->selVector->setToUnfiltered(numTuplesToScan);
+        }
+        factorizedTable->scan(vectorPtrs, startIdx, numTuplesToScan, colIdxes);
+        for (auto i = 0u; i < numTuplesToScan; i++) {
+            auto hash = hashTable.getHashValue(factorizedTable->getTuple(startIdx + i));
+            auto& file = *partitionFiles[getPartitionIdx(hash)];
+            writeRow(file, hasUnflatCol ? 0 : i);
+            file.finishRow();
+        }
+    }
+    hashTable.clear();
+}
+
+void HashJoinSpiller::load(const spill_files_t& files, JoinHashTable& hashTable) {
+    auto batchSize = hasUnflatCol ? 1 : DEFAULT_VECTOR_CAPACITY;
+    for (auto& file : files) {
+        SpillFileReader reader{*file};
+        auto numRows = file->getNumRows();
+        for (auto startIdx = 0u; startIdx < numRows; startIdx += batchSize) {
+            auto numRowsToRead = std::min<uint64_t>(batchSize, numRows - startIdx);
+            for (auto& vector : vectors) {
+                vector->resetAuxiliaryBuffer();
+            }
+            for (auto i = 0u; i < numRowsToRead; i++) {
+                readRow(reader, i);
+            }
+            if (!hasUnflatCol) {
+                keyState->selVector->setToUnfiltered(numRowsToRead);
+            }
+            hashTable.appendVectors(keyVectors, payloadVectors, keyState.get());
+        }
+    }
+}
+
+void HashJoinSpiller::writeRow(SpillFile& file, uint32_t pos) {
+    for (auto i = 0u; i < vectors.size(); i++) {
+        auto& vector = *vectors[i];
+        if (!isUnflatCol[i]) {
+            file.writeValue(vector, pos);
+            continue;
+        }
+        auto numValues = vector.state->selVector->selectedSize;
+        file.write<uint32_t>(numValues);
+        for (auto j = 0u; j < numValues; j++) {
+            file.writeValue(vector, j);
+        }
+    }
+}
+
+void HashJoinSpiller::readRow(SpillFileReader& reader, uint32_t pos) {
+    for (auto i = 0u; i < vectors.size(); i++) {
+        auto& vector = *vectors[i];
+        if (!isUnflatCol[i]) {
+            reader.readValue(vector, pos);
+            continue;
+        }
+        auto numValues = reader.read<uint32_t>();
+        for (auto j = 0u; j < numValues; j++) {
+            reader.readValue(vector, j);
+        }
+        vector.state->selVector->setToUnfiltered(numValues);
+    }
+}
+
+} // namespace processor
+} // namespace kuzu
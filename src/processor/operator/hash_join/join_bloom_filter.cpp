@@ -0,0 +1,39 @@
+#include "processor/operator/hash_join/join_bloom_filter.h"
+
+#include <cstring>
+
+#include "common/utils.h"
+#include "processor/operator/hash_join/join_hash_table.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+JoinBloomFilter::JoinBloomFilter(uint64_t numKeys) {
+    auto numWords = nextPowerOfTwo(std::max<uint64_t>(numKeys * NUM_BITS_PER_KEY / 64, 1));
+    wordIdxMask = numWords - 1;
+    words = std::make_unique<uint64_t[]>(numWords);
+    memset(words.get(), 0, numWords * sizeof(uint64_t));
+}
+
+std::unique_ptr<JoinBloomFilter> JoinBloomFilter::build(JoinHashTable& hashTable) {
+    auto numTuples = hashTable.getNumTuples();
+    if (numTuples * NUM_BITS_PER_KEY / 64 > MAX_NUM_WORDS) {
+        return nullptr;
+    }
+    auto filter = std::make_unique<JoinBloomFilter>(numTuples);
+    auto factorizedTable = hashTable.getFactorizedTable();
+    auto numBytesPerTuple = factorizedTable->getTableSchema()->getNumBytesPerTuple();
+    for (auto& tupleBlock : factorizedTable->getTupleDataBlocks()) {
+        auto tuple = tupleBlock->getData();
+        for (auto i = 0u; i < tupleBlock->numTuples; i++) {
+            filter->insert(hashTable.getHashValue(tuple));
+            tuple += numBytesPerTuple;
+        }
+    }
+    return filter;
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -123,20 +123,28 @@ void JoinHashTable::buildHashSlots() {
     }
 }
 
+void JoinHashTable::computeKeyHashes(const std::vector<ValueVector*>& keyVectors,
+    ValueVector* hashVector, ValueVector* tmpHashVector) {
+    function::VectorHashFunction::computeHash(keyVectors[0], hashVector);
+    for (auto i = 1u; i < keyVectors.size(); i++) {
+        function::VectorHashFunction::computeHash(keyVectors[i], tmpHashVector);
+        function::VectorHashFunction::combineHash(hashVector, tmpHashVector, hashVector);
+    }
+}
+
 void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, ValueVector* hashVector,
     ValueVector* tmpHashVector, uint8_t** probedTuples) {
     KU_ASSERT(keyVectors.size() == keyTypes.size());
     if (getNumTuples() == 0) {
+        // The same probed tuples can be used to probe multiple tables, e.g., partitions of a
+        // spilled build side, so they need to be reset.
+        std::fill(probedTuples, probedTuples + DEFAULT_VECTOR_CAPACITY, nullptr);
         return;
     }
     if (!discardNullFromKeys(keyVectors)) {
         return;
     }
-    function::VectorHashFunction::computeHash(keyVectors[0], hashVector);
-    for (auto i = 1u; i < keyVectors.size(); i++) {
-        function::VectorHashFunction::computeHash(keyVectors[i], tmpHashVector);
-        function::VectorHashFunction::combineHash(hashVector, tmpHashVector, hashVector);
-    }
+    computeKeyHashes(keyVectors, hashVector, tmpHashVector);
     for (auto i = 0u; i < hashVector->state->selVector->selectedSize; i++) {
         auto pos = hashVector->state->selVector->selectedPositions[i];
         KU_ASSERT(i < DEFAULT_VECTOR_CAPACITY);
@@ -180,7 +188,7 @@ sel_t JoinHashTable::matchUnFlatKey(ValueVector* keyVector, uint8_t** probedTupl
 }
 
 uint8_t** JoinHashTable::findHashSlot(const uint8_t* tuple) const {
-    auto hash = *(hash_t*)(tuple + getHashValueColOffset());
+    auto hash = getHashValue(tuple);
     auto slotIdx = getSlotIdxForHash(hash);
     return (uint8_t**)(hashSlotsBlocks[slotIdx >> numSlotsPerBlockLog2]->getData() +
                        (slotIdx & slotIdxInBlockMask) * sizeof(uint8_t*));
@@ -67,12 +67,11 @@ void stringPKFillOffsetArraysFromVector(transaction::Transaction* transaction,
     const IndexLookupInfo& info, ValueVector* keyVector, offset_t* offsets) {
     auto numKeys = keyVector->state->selVector->selectedSize;
     if (info.batchInsertSharedState == nullptr) {
-        for (auto i = 0u; i < numKeys; i++) {
-            auto key =
-                keyVector->getValue<ku_string_t>(keyVector->state->selVector->selectedPositions[i]);
-            if (!info.index->lookup(transaction, key.getAsStringView(), offsets[i])) {
-                throw RuntimeException(ExceptionMessage::nonExistentPKException(key.getAsString()));
-            }
+        auto missingKeyPos = info.index->batchLookup(transaction, *keyVector, offsets);
+        if (missingKeyPos < numKeys) {
+            auto key = keyVector->getValue<ku_string_t>(
+                keyVector->state->selVector->selectedPositions[missingKeyPos]);
+            throw RuntimeException(ExceptionMessage::nonExistentPKException(key.getAsString()));
         }
     } else {
         auto nodeBatchInsertSharedState =
@@ -93,13 +92,12 @@ void primitivePKFillOffsetArraysFromVector(transaction::Transaction* transaction
     const IndexLookupInfo& info, ValueVector* keyVector, offset_t* offsets) {
     auto numKeys = keyVector->state->selVector->selectedSize;
     if (info.batchInsertSharedState == nullptr) {
-        for (auto i = 0u; i < numKeys; i++) {
-            auto pos = keyVector->state->selVector->selectedPositions[i];
-            auto key = keyVector->getValue<T>(pos);
-            if (!info.index->lookup(transaction, key, offsets[i])) {
-                throw RuntimeException(
-                    ExceptionMessage::nonExistentPKException(TypeUtils::toString(key)));
-            }
+        auto missingKeyPos = info.index->batchLookup(transaction, *keyVector, offsets);
+        if (missingKeyPos < numKeys) {
+            auto key = keyVector->getValue<T>(
+                keyVector->state->selVector->selectedPositions[missingKeyPos]);
+            throw RuntimeException(
+                ExceptionMessage::nonExistentPKException(TypeUtils::toString(key)));
         }
     } else {
         auto nodeBatchInsertSharedState =
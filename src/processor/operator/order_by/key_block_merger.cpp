@@ -62,75 +62,43 @@ void BlockPtrInfo::updateTuplePtrIfNecessary() {
     }
 }
 
-uint64_t KeyBlockMergeTask::findRightKeyBlockIdx(uint8_t* leftEndTuplePtr) const {
-    // Find a tuple in the right memory block such that:
-    // 1. The value of the current tuple is smaller than the value in leftEndTuple.
-    // 2. Either the value of next tuple is larger than the value in leftEndTuple or
-    // the current tuple is the last tuple in the right memory block.
-    int64_t startIdx = rightKeyBlockNextIdx;
-    int64_t endIdx = rightKeyBlock->getNumTuples() - 1;
-
-    while (startIdx <= endIdx) {
-        uint64_t curTupleIdx = (startIdx + endIdx) / 2;
-        uint8_t* curTuplePtr = rightKeyBlock->getTuple(curTupleIdx);
-
-        if (keyBlockMerger.compareTuplePtr(leftEndTuplePtr, curTuplePtr)) {
-            if (curTupleIdx == rightKeyBlock->getNumTuples() - 1 ||
-                !keyBlockMerger.compareTuplePtr(
-                    leftEndTuplePtr, rightKeyBlock->getTuple(curTupleIdx + 1))) {
-                // If the current tuple is the last tuple or the value of next tuple is larger than
-                // the value of leftEndTuple, return the curTupleIdx.
-                return curTupleIdx;
-            } else {
-                startIdx = curTupleIdx + 1;
-            }
+uint64_t KeyBlockMergeTask::findMergePathSplit(uint64_t diagonal) const {
+    // Find the number of tuples, leftIdx, that the left key block contributes to the first
+    // diagonal tuples of the merged result, i.e. the point at which the merge path crosses the
+    // diagonal. Tuples from the left key block go first on ties, so leftIdx is the smallest index
+    // such that the tuple at leftIdx in the left key block is larger than the tuple at
+    // diagonal - leftIdx - 1 in the right key block.
+    auto startIdx = diagonal > rightKeyBlock->getNumTuples() ?
+                        diagonal - rightKeyBlock->getNumTuples() :
+                        0;
+    auto endIdx = std::min(diagonal, leftKeyBlock->getNumTuples());
+    while (startIdx < endIdx) {
+        auto curTupleIdx = (startIdx + endIdx) / 2;
+        if (keyBlockMerger.compareTuplePtr(leftKeyBlock->getTuple(curTupleIdx),
+                rightKeyBlock->getTuple(diagonal - curTupleIdx - 1))) {
+            endIdx = curTupleIdx;
         } else {
-            endIdx = curTupleIdx - 1;
+            startIdx = curTupleIdx + 1;
         }
     }
-    // If such tuple doesn't exist, return -1.
-    return -1;
+    return startIdx;
 }
 
 std::unique_ptr<KeyBlockMergeMorsel> KeyBlockMergeTask::getMorsel() {
-    // We grab a batch of tuples from the left memory block, then do a binary search on the
-    // right memory block to find the range of tuples to merge.
+    // Each morsel merges the next batch_size tuples of the result. The ranges of the left and
+    // right key blocks that make up these tuples are found with a binary search along the diagonal
+    // of the merge path, so morsels have the same size however the tuples are distributed
+    // between the two key blocks.
     activeMorsels++;
-    if (rightKeyBlockNextIdx >= rightKeyBlock->getNumTuples()) {
-        // If there is no more tuples left in the right key block,
-        // just append all tuples in the left key block to the result key block.
-        auto keyBlockMergeMorsel =
-            std::make_unique<KeyBlockMergeMorsel>(leftKeyBlockNextIdx, leftKeyBlock->getNumTuples(),
-                rightKeyBlock->getNumTuples(), rightKeyBlock->getNumTuples());
-        leftKeyBlockNextIdx = leftKeyBlock->getNumTuples();
-        return keyBlockMergeMorsel;
-    }
-
-    auto leftKeyBlockStartIdx = leftKeyBlockNextIdx;
-    leftKeyBlockNextIdx += batch_size;
-
-    if (leftKeyBlockNextIdx >= leftKeyBlock->getNumTuples()) {
-        // This is the last batch of tuples in the left key block to merge, so just merge it with
-        // remaining tuples of the right key block.
-        auto keyBlockMergeMorsel = std::make_unique<KeyBlockMergeMorsel>(leftKeyBlockStartIdx,
-            std::min(leftKeyBlockNextIdx, leftKeyBlock->getNumTuples()), rightKeyBlockNextIdx,
-            rightKeyBlock->getNumTuples());
-        rightKeyBlockNextIdx = rightKeyBlock->getNumTuples();
-        return keyBlockMergeMorsel;
-    } else {
-        // Conduct a binary search to find the ending index in the right memory block.
-        auto leftEndIdxPtr = leftKeyBlock->getTuple(leftKeyBlockNextIdx - 1);
-        auto rightEndIdx = findRightKeyBlockIdx(leftEndIdxPtr);
-
-        auto keyBlockMergeMorsel = std::make_unique<KeyBlockMergeMorsel>(leftKeyBlockStartIdx,
-            std::min(leftKeyBlockNextIdx, leftKeyBlock->getNumTuples()), rightKeyBlockNextIdx,
-            rightEndIdx == (uint64_t)-1 ? rightKeyBlockNextIdx : ++rightEndIdx);
-
-        if (rightEndIdx != (uint64_t)-1) {
-            rightKeyBlockNextIdx = rightEndIdx;
-        }
-        return keyBlockMergeMorsel;
-    }
+    auto numTuplesToMerge = leftKeyBlock->getNumTuples() + rightKeyBlock->getNumTuples();
+    auto diagonal = std::min<uint64_t>(
+        leftKeyBlockNextIdx + rightKeyBlockNextIdx + batch_size, numTuplesToMerge);
+    auto leftKeyBlockEndIdx = findMergePathSplit(diagonal);
+    auto keyBlockMergeMorsel = std::make_unique<KeyBlockMergeMorsel>(leftKeyBlockNextIdx,
+        leftKeyBlockEndIdx, rightKeyBlockNextIdx, diagonal - leftKeyBlockEndIdx);
+    leftKeyBlockNextIdx = leftKeyBlockEndIdx;
+    rightKeyBlockNextIdx = diagonal - leftKeyBlockEndIdx;
+    return keyBlockMergeMorsel;
 }
 
 void KeyBlockMerger::mergeKeyBlocks(KeyBlockMergeMorsel& keyBlockMergeMorsel) const {
@@ -210,6 +178,8 @@ bool KeyBlockMerger::compareTuplePtrWithStringCol(
             bool isRightStrLong =
                 OrderByKeyEncoder::isLongStr(rightStrColPtr, strKeyColInfo.isAscOrder);
             if (!isLeftStrLong && !isRightStrLong) {
+                lastComparedBytes =
+                    strKeyColInfo.colOffsetInEncodedKeyBlock + strKeyColInfo.getEncodingSize();
                 continue;
             } else if (isLeftStrLong && !isRightStrLong) {
                 return strKeyColInfo.isAscOrder;
@@ -245,9 +215,10 @@ bool KeyBlockMerger::compareTuplePtrWithStringCol(
         }
         return result > 0;
     }
-    // The string tie can't be solved, just add the tuple in the leftMemBlock to
-    // resultMemBlock.
-    return false;
+    // All string columns tie, so the keys after the last string column decide the order. If they
+    // tie as well, the tuple in the leftMemBlock is added to the resultMemBlock first.
+    return memcmp(leftTuplePtr + lastComparedBytes, rightTuplePtr + lastComparedBytes,
+               numBytesToCompare - lastComparedBytes) > 0;
 }
 
 void KeyBlockMerger::copyRemainingBlockDataToResult(
@@ -1,5 +1,7 @@
 #include "processor/operator/order_by/order_by.h"
 
+#include "main/client_context.h"
+
 using namespace kuzu::common;
 
 namespace kuzu {
@@ -14,6 +16,10 @@ void OrderBy::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* con
     for (auto& dataPos : info->keysPos) {
         orderByVectors.push_back(resultSet->getValueVector(dataPos).get());
     }
+    if (sharedState->isSpillingEnabled()) {
+        spiller = std::make_unique<OrderBySpiller>(*info, sharedState->getStrKeyColInfo(),
+            sharedState->getNumBytesPerTuple(), context->clientContext->getMemoryManager());
+    }
 }
 
 void OrderBy::initGlobalStateInternal(ExecutionContext* /*context*/) {
@@ -26,8 +32,61 @@ void OrderBy::executeInternal(ExecutionContext* context) {
         for (auto i = 0u; i < resultSet->multiplicity; i++) {
             localState->append(orderByVectors, payloadVectors);
         }
+        if (spiller != nullptr) {
+            updateMemoryUsage(context);
+        }
+    }
+    // Once tuples are being spilled, the remaining local tuples are spilled as well.
+    if (sharedState->isSpilling()) {
+        spillLocalTuples();
+    } else {
+        localState->finalize(*sharedState);
+    }
+}
+
+void OrderBy::finalize(ExecutionContext* context) {
+    // TODO(Ziyi): we always call lookup function on the first factorizedTable in sharedState
+    // and that lookup function may read tuples in other factorizedTable, So we need to combine
+    // hasNoNullGuarantee with other factorizedTables. This is not a good way to solve this
+    // problem, and should be changed later.
+    sharedState->combineFTHasNoNullGuarantee();
+    // Threads that finished before spilling started have left their tuples in memory. They are
+    // spilled as well, so that all tuples can be scanned from the spilled runs.
+    if (sharedState->isSpilling()) {
+        auto memoryManager = context->clientContext->getMemoryManager();
+        OrderBySpiller finalizeSpiller{*info, sharedState->getStrKeyColInfo(),
+            sharedState->getNumBytesPerTuple(), memoryManager};
+        sharedState->spillSortedKeyBlocks(finalizeSpiller, memoryManager);
+    }
+}
+
+void OrderBy::updateMemoryUsage(ExecutionContext* context) {
+    auto memoryUsage = localState->getMemoryUsage();
+    auto exceedsMemoryLimit = sharedState->updateMemoryUsage(reportedMemoryUsage, memoryUsage);
+    reportedMemoryUsage = memoryUsage;
+    if (!sharedState->isSpilling()) {
+        if (exceedsMemoryLimit) {
+            sharedState->startSpilling();
+            spillLocalTuples();
+        }
+        return;
+    }
+    // Once tuples are being spilled, each thread spills its tuples whenever they exceed its share
+    // of the memory limit.
+    auto numThreads = context->clientContext->getClientConfig()->numThreads;
+    if (memoryUsage > sharedState->getMemoryLimit() / numThreads) {
+        spillLocalTuples();
+    }
+}
+
+void OrderBy::spillLocalTuples() {
+    KU_ASSERT(spiller != nullptr);
+    if (!localState->isEmpty()) {
+        localState->spill(*sharedState, *spiller);
     }
-    localState->finalize(*sharedState);
+    auto memoryUsage = localState->getMemoryUsage();
+    sharedState->updateMemoryUsage(reportedMemoryUsage, memoryUsage);
+    reportedMemoryUsage = memoryUsage;
 }
 
 } // namespace processor
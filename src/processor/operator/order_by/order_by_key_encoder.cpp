@@ -194,6 +194,13 @@ void OrderByKeyEncoder::encodeFTIdx(uint32_t numEntriesToEncode, uint8_t* tupleI
     }
 }
 
+void OrderByKeyEncoder::resetState() {
+    keyBlocks.clear();
+    keyBlocks.emplace_back(std::make_shared<DataBlock>(memoryManager));
+    ftBlockIdx = 0;
+    ftBlockOffset = 0;
+}
+
 void OrderByKeyEncoder::allocateMemoryIfFull() {
     if (getNumTuplesInCurBlock() == maxNumTuplesPerBlock) {
         keyBlocks.emplace_back(std::make_shared<DataBlock>(memoryManager));
@@ -10,6 +10,11 @@ void OrderByScanLocalState::init(
     for (auto& dataPos : outVectorPos) {
         vectorsToRead.push_back(resultSet.getValueVector(dataPos).get());
     }
+    if (!sharedState.getSpilledRuns().empty()) {
+        runMerger = std::make_unique<SortedRunMerger>(sharedState.getSpilledRuns(),
+            sharedState.getStrKeyColInfo(), sharedState.getNumBytesPerTuple());
+        return;
+    }
     payloadScanner = std::make_unique<PayloadScanner>(
         sharedState.getMergedKeyBlock(), sharedState.getPayloadTables());
 }
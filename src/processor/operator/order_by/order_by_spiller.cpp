@@ -0,0 +1,162 @@
+#include "processor/operator/order_by/order_by_spiller.h"
+
+#include <algorithm>
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace processor {
+
+OrderBySpiller::OrderBySpiller(const OrderByDataInfo& orderByDataInfo,
+    const std::vector<StrKeyColInfo>& strKeyColsInfo, uint32_t numBytesPerTuple,
+    MemoryManager* memoryManager)
+    : strKeyColsInfo{strKeyColsInfo},
+      numBytesToCompare{numBytesPerTuple - OrderByConstants::NUM_BYTES_FOR_PAYLOAD_IDX},
+      payloadIdxOffset{numBytesToCompare} {
+    KU_ASSERT(orderByDataInfo.payloadTableSchema->getNumUnflatColumns() == 0);
+    state = std::make_shared<DataChunkState>();
+    for (auto i = 0u; i < orderByDataInfo.payloadTypes.size(); i++) {
+        colIdxes.push_back(i);
+        auto vector =
+            std::make_unique<ValueVector>(*orderByDataInfo.payloadTypes[i], memoryManager);
+        vector->setState(state);
+        vectorPtrs.push_back(vector.get());
+        vectors.push_back(std::move(vector));
+    }
+    tuplesToRead = std::make_unique<uint8_t*[]>(DEFAULT_VECTOR_CAPACITY);
+}
+
+void OrderBySpiller::spill(const MergedKeyBlocks& keyBlock,
+    const std::vector<FactorizedTable*>& payloadTables, SpillFile& file) {
+    auto numTuples = keyBlock.getNumTuples();
+    for (auto startIdx = 0u; startIdx < numTuples; startIdx += DEFAULT_VECTOR_CAPACITY) {
+        auto numTuplesToScan = std::min<uint64_t>(DEFAULT_VECTOR_CAPACITY, numTuples - startIdx);
+        FactorizedTable* payloadTable = nullptr;
+        for (auto i = 0u; i < numTuplesToScan; i++) {
+            auto payloadInfo = keyBlock.getTuple(startIdx + i) + payloadIdxOffset;
+            payloadTable = payloadTables[OrderByKeyEncoder::getEncodedFTIdx(payloadInfo)];
+            tuplesToRead[i] = payloadTable->getTuple(
+                OrderByKeyEncoder::getEncodedFTBlockIdx(payloadInfo) *
+                    payloadTable->getNumTuplesPerBlock() +
+                OrderByKeyEncoder::getEncodedFTBlockOffset(payloadInfo));
+        }
+        state->selVector->setToUnfiltered(numTuplesToScan);
+        payloadTable->lookup(vectorPtrs, colIdxes, tuplesToRead.get(), 0, numTuplesToScan);
+        for (auto i = 0u; i < numTuplesToScan; i++) {
+            auto tuple = keyBlock.getTuple(startIdx + i);
+            file.write(tuple, numBytesToCompare);
+            for (auto& strKeyColInfo : strKeyColsInfo) {
+                if (OrderByKeyEncoder::isNullVal(tuple + strKeyColInfo.colOffsetInEncodedKeyBlock,
+                        strKeyColInfo.isAscOrder)) {
+                    file.write<uint32_t>(0);
+                    continue;
+                }
+                auto& str = *(ku_string_t*)(tuplesToRead[i] + strKeyColInfo.colOffsetInFT);
+                file.write<uint32_t>(str.len);
+                file.write(str.getData(), str.len);
+            }
+            for (auto& vector : vectors) {
+                file.writeValue(*vector, i);
+            }
+            file.finishRow();
+        }
+    }
+}
+
+SortedRunMerger::SortedRunMerger(const spill_files_t& runs,
+    const std::vector<StrKeyColInfo>& strKeyColsInfo, uint32_t numBytesPerTuple)
+    : strKeyColsInfo{strKeyColsInfo}, numBytesToCompare{
+                                          numBytesPerTuple -
+                                          OrderByConstants::NUM_BYTES_FOR_PAYLOAD_IDX} {
+    // The heap keeps the run whose current row goes first on top.
+    heapCompareFunc = [this](uint32_t left, uint32_t right) {
+        return isGreater(this->runs[left], this->runs[right]);
+    };
+    this->runs.resize(runs.size());
+    for (auto i = 0u; i < runs.size(); i++) {
+        auto& run = this->runs[i];
+        run.reader = std::make_unique<SpillFileReader>(*runs[i]);
+        run.numRowsLeft = runs[i]->getNumRows();
+        run.keys.resize(numBytesToCompare);
+        run.strKeys.resize(strKeyColsInfo.size());
+        if (run.numRowsLeft > 0) {
+            readKeys(run);
+            heap.push_back(i);
+        }
+    }
+    std::make_heap(heap.begin(), heap.end(), heapCompareFunc);
+}
+
+uint64_t SortedRunMerger::scan(std::vector<ValueVector*>& vectorsToRead) {
+    if (heap.empty()) {
+        return 0;
+    }
+    // A flat vector can only hold one row at a time.
+    auto hasFlatVectorToRead = std::any_of(vectorsToRead.begin(), vectorsToRead.end(),
+        [](ValueVector* vector) { return vector->state->isFlat(); });
+    auto numRowsToScan = hasFlatVectorToRead ? 1 : DEFAULT_VECTOR_CAPACITY;
+    for (auto& vector : vectorsToRead) {
+        vector->resetAuxiliaryBuffer();
+    }
+    auto numRowsScanned = 0u;
+    while (numRowsScanned < numRowsToScan && !heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), heapCompareFunc);
+        auto& run = runs[heap.back()];
+        for (auto& vector : vectorsToRead) {
+            auto pos = vector->state->isFlat() ? vector->state->selVector->selectedPositions[0] :
+                                                 numRowsScanned;
+            run.reader->readValue(*vector, pos);
+        }
+        numRowsScanned++;
+        if (run.numRowsLeft == 0) {
+            heap.pop_back();
+            continue;
+        }
+        readKeys(run);
+        std::push_heap(heap.begin(), heap.end(), heapCompareFunc);
+    }
+    for (auto& vector : vectorsToRead) {
+        if (!vector->state->isFlat()) {
+            vector->state->selVector->setToUnfiltered(numRowsScanned);
+        }
+    }
+    return numRowsScanned;
+}
+
+void SortedRunMerger::readKeys(RunState& run) {
+    KU_ASSERT(run.numRowsLeft > 0);
+    run.reader->read(run.keys.data(), numBytesToCompare);
+    for (auto& strKey : run.strKeys) {
+        strKey.resize(run.reader->read<uint32_t>());
+        run.reader->read(reinterpret_cast<uint8_t*>(strKey.data()), strKey.size());
+    }
+    run.numRowsLeft--;
+}
+
+bool SortedRunMerger::isGreater(const RunState& left, const RunState& right) const {
+    // Same as KeyBlockMerger::compareTuplePtrWithStringCol, except that the full values of string
+    // keys are stored with the rows.
+    uint64_t lastComparedBytes = 0;
+    for (auto i = 0u; i < strKeyColsInfo.size(); i++) {
+        auto& strKeyColInfo = strKeyColsInfo[i];
+        auto strColEndOffset =
+            strKeyColInfo.colOffsetInEncodedKeyBlock + strKeyColInfo.getEncodingSize();
+        auto result = memcmp(left.keys.data() + lastComparedBytes,
+            right.keys.data() + lastComparedBytes, strColEndOffset - lastComparedBytes);
+        if (result != 0) {
+            return result > 0;
+        }
+        lastComparedBytes = strColEndOffset;
+        // Equal encodings only mean that both strings are null or share the same prefix.
+        auto strResult = left.strKeys[i].compare(right.strKeys[i]);
+        if (strResult != 0) {
+            return strKeyColInfo.isAscOrder == (strResult > 0);
+        }
+    }
+    return memcmp(left.keys.data() + lastComparedBytes, right.keys.data() + lastComparedBytes,
+               numBytesToCompare - lastComparedBytes) > 0;
+}
+
+} // namespace processor
+} // namespace kuzu
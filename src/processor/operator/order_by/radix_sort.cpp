@@ -55,9 +55,9 @@ void RadixSort::sortSingleKeyBlock(const DataBlock& keyBlock) {
 void RadixSort::radixSort(uint8_t* keyBlockPtr, uint32_t numTuplesToSort, uint32_t numBytesSorted,
     uint32_t numBytesToSort) {
     // We use radixSortLSD which sorts from the least significant byte to the most significant byte.
+    // Tuples are always moved as a whole, since the bytes before numBytesSorted must stay with
+    // their tuples.
     auto tmpKeyBlockPtr = tmpSortingResultBlock->getData();
-    keyBlockPtr += numBytesSorted;
-    tmpKeyBlockPtr += numBytesSorted;
     constexpr uint16_t countingArraySize = 256;
     uint32_t count[countingArraySize];
     auto isInTmpBlock = false;
@@ -65,7 +65,7 @@ void RadixSort::radixSort(uint8_t* keyBlockPtr, uint32_t numTuplesToSort, uint32
         memset(count, 0, countingArraySize * sizeof(uint32_t));
         auto sourcePtr = isInTmpBlock ? tmpKeyBlockPtr : keyBlockPtr;
         auto targetPtr = isInTmpBlock ? keyBlockPtr : tmpKeyBlockPtr;
-        auto curByteOffset = numBytesToSort - curByteIdx;
+        auto curByteOffset = numBytesSorted + numBytesToSort - curByteIdx;
         auto sortBytePtr = sourcePtr + curByteOffset;
         // counting sort
         for (auto j = 0ul; j < numTuplesToSort; j++) {
@@ -165,7 +165,7 @@ void RadixSort::findStringTies(TieRange& keyBlockTie, uint8_t* keyBlockPtr,
             if (isIValNull && isJValNull) {
                 // If the left value and the right value are nulls, we can just continue on
                 // the next tuple.
-                jTupleInfoPtr += numBytesPerTuple;
+                jTuplePtr += numBytesPerTuple;
                 continue;
             } else if (isIValNull || isJValNull) {
                 // If only one value is null, we can just conclude that those two values are
@@ -180,7 +180,7 @@ void RadixSort::findStringTies(TieRange& keyBlockTie, uint8_t* keyBlockPtr,
                 bool isJStringLong = OrderByKeyEncoder::isLongStr(
                     jTuplePtr + keyColInfo.colOffsetInEncodedKeyBlock, keyColInfo.isAscOrder);
                 if (!isIStringLong && !isJStringLong) {
-                    jTupleInfoPtr += numBytesPerTuple;
+                    jTuplePtr += numBytesPerTuple;
                     continue;
                 } else if (isIStringLong != isJStringLong) {
                     break;
@@ -1,10 +1,29 @@
 #include "processor/operator/order_by/sort_state.h"
 
 using namespace kuzu::common;
+using namespace kuzu::storage;
 
 namespace kuzu {
 namespace processor {
 
+// Merges sorted key blocks into a single key block on the calling thread.
+static std::shared_ptr<MergedKeyBlocks> mergeKeyBlocks(
+    std::queue<std::shared_ptr<MergedKeyBlocks>>& keyBlocks,
+    const std::vector<FactorizedTable*>& payloadTables, std::vector<StrKeyColInfo>& strKeyColsInfo,
+    uint32_t numBytesPerTuple, MemoryManager* memoryManager) {
+    KeyBlockMerger merger{payloadTables, strKeyColsInfo, numBytesPerTuple};
+    KeyBlockMergeTaskDispatcher dispatcher;
+    dispatcher.init(memoryManager, &keyBlocks, payloadTables, strKeyColsInfo, numBytesPerTuple);
+    while (!dispatcher.isDoneMerge()) {
+        auto keyBlockMergeMorsel = dispatcher.getMorsel();
+        merger.mergeKeyBlocks(*keyBlockMergeMorsel);
+        dispatcher.doneMorsel(std::move(keyBlockMergeMorsel));
+    }
+    auto mergedKeyBlock = keyBlocks.front();
+    keyBlocks.pop();
+    return mergedKeyBlock;
+}
+
 void SortSharedState::init(const OrderByDataInfo& orderByDataInfo) {
     auto encodedKeyBlockColOffset = 0ul;
     for (auto i = 0u; i < orderByDataInfo.keysPos.size(); ++i) {
@@ -52,12 +71,63 @@ std::vector<FactorizedTable*> SortSharedState::getPayloadTables() const {
     return payloadTablesToReturn;
 }
 
+void SortSharedState::enableSpilling(
+    uint64_t memoryLimit_, VirtualFileSystem* vfs_, std::string spillDirectory_) {
+    memoryLimit = memoryLimit_;
+    vfs = vfs_;
+    spillDirectory = std::move(spillDirectory_);
+}
+
+bool SortSharedState::updateMemoryUsage(uint64_t prevMemoryUsage, uint64_t newMemoryUsage) {
+    uint64_t totalMemoryUsage;
+    if (newMemoryUsage >= prevMemoryUsage) {
+        auto delta = newMemoryUsage - prevMemoryUsage;
+        totalMemoryUsage = memoryUsage.fetch_add(delta) + delta;
+    } else {
+        auto delta = prevMemoryUsage - newMemoryUsage;
+        totalMemoryUsage = memoryUsage.fetch_sub(delta) - delta;
+    }
+    return totalMemoryUsage > memoryLimit;
+}
+
+std::unique_ptr<SpillFile> SortSharedState::createRunFile() const {
+    return std::make_unique<SpillFile>(vfs, spillDirectory);
+}
+
+void SortSharedState::appendSpilledRun(std::unique_ptr<SpillFile> run) {
+    std::unique_lock lck{mtx};
+    spilledRuns.push_back(std::move(run));
+}
+
+void SortSharedState::spillSortedKeyBlocks(OrderBySpiller& spiller, MemoryManager* memoryManager) {
+    if (sortedKeyBlocks->empty()) {
+        return;
+    }
+    // The merged key block refers to tuples of all payload tables, which are scanned together, so
+    // all tables need to agree on the columns that may contain nulls.
+    combineFTHasNoNullGuarantee();
+    for (auto i = 1u; i < payloadTables.size(); i++) {
+        payloadTables[i]->mergeMayContainNulls(*payloadTables[0]);
+    }
+    auto payloadTablesToSpill = getPayloadTables();
+    auto mergedKeyBlock = mergeKeyBlocks(*sortedKeyBlocks, payloadTablesToSpill, strKeyColsInfo,
+        numBytesPerTuple, memoryManager);
+    auto run = createRunFile();
+    spiller.spill(*mergedKeyBlock, payloadTablesToSpill, *run);
+    run->finishWriting();
+    appendSpilledRun(std::move(run));
+    for (auto& payloadTable : payloadTables) {
+        payloadTable->clear();
+    }
+}
+
 void SortLocalState::init(const OrderByDataInfo& orderByDataInfo, SortSharedState& sharedState,
     storage::MemoryManager* memoryManager) {
     auto [idx, table] =
         sharedState.getLocalPayloadTable(*memoryManager, *orderByDataInfo.payloadTableSchema);
     globalIdx = idx;
     payloadTable = table;
+    this->memoryManager = memoryManager;
     orderByKeyEncoder = std::make_unique<OrderByKeyEncoder>(orderByDataInfo, memoryManager,
         globalIdx, payloadTable->getNumTuplesPerBlock(), sharedState.getNumBytesPerTuple());
     radixSorter = std::make_unique<RadixSort>(
@@ -81,6 +151,36 @@ void SortLocalState::finalize(kuzu::processor::SortSharedState& sharedState) {
     orderByKeyEncoder->clear();
 }
 
+uint64_t SortLocalState::getMemoryUsage() const {
+    return payloadTable->getMemoryUsage() +
+           orderByKeyEncoder->getKeyBlocks().size() * BufferPoolConstants::PAGE_256KB_SIZE;
+}
+
+void SortLocalState::spill(SortSharedState& sharedState, OrderBySpiller& spiller) {
+    std::queue<std::shared_ptr<MergedKeyBlocks>> keyBlocks;
+    for (auto& keyBlock : orderByKeyEncoder->getKeyBlocks()) {
+        if (keyBlock->numTuples > 0) {
+            radixSorter->sortSingleKeyBlock(*keyBlock);
+            keyBlocks.push(
+                make_shared<MergedKeyBlocks>(orderByKeyEncoder->getNumBytesPerTuple(), keyBlock));
+        }
+    }
+    if (!keyBlocks.empty()) {
+        // The keys only refer to tuples of the local payload table.
+        std::vector<FactorizedTable*> payloadTables(globalIdx + 1, nullptr);
+        payloadTables[globalIdx] = payloadTable;
+        auto mergedKeyBlock = mergeKeyBlocks(keyBlocks, payloadTables,
+            sharedState.getStrKeyColInfo(), orderByKeyEncoder->getNumBytesPerTuple(),
+            memoryManager);
+        auto run = sharedState.createRunFile();
+        spiller.spill(*mergedKeyBlock, payloadTables, *run);
+        run->finishWriting();
+        sharedState.appendSpilledRun(std::move(run));
+    }
+    payloadTable->clear();
+    orderByKeyEncoder->resetState();
+}
+
 PayloadScanner::PayloadScanner(MergedKeyBlocks* keyBlockToScan,
     std::vector<FactorizedTable*> payloadTables, uint64_t skipNumber, uint64_t limitNumber)
     : keyBlockToScan{keyBlockToScan}, payloadTables{std::move(payloadTables)}, limitNumber{
@@ -215,8 +215,10 @@ bool TopKBuffer::compareFlatKeys(
     selVector->setToFiltered();
     auto compareResult = compareFuncs[vectorIdxToCompare](
         *keyVectors[vectorIdxToCompare], *boundaryVecs[vectorIdxToCompare], *selVector);
-    if (vectorIdxToCompare == keyVectors.size() - 1) {
-        return compareResult;
+    if (compareResult) {
+        return true;
+    } else if (vectorIdxToCompare == keyVectors.size() - 1) {
+        return false;
     } else if (equalsFuncs[vectorIdxToCompare](*keyVectors[vectorIdxToCompare],
                    *boundaryVecs[vectorIdxToCompare], *selVector)) {
         return compareFlatKeys(vectorIdxToCompare + 1, std::move(keyVectors));
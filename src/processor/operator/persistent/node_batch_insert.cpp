@@ -25,7 +25,7 @@ void NodeBatchInsertSharedState::initPKIndex(kuzu::processor::ExecutionContext*
             reinterpret_cast<function::BaseScanSharedState*>(readerSharedState->funcState.get());
         numRows = scanSharedState->numRows;
     } else {
-        numRows = distinctSharedState->getFactorizedTable()->getNumTuples();
+        numRows = distinctSharedState->getNumTuples();
     }
     pkIndex->bulkReserve(numRows);
     globalIndexBuilder = IndexBuilder(std::make_shared<IndexBuilderSharedState>(pkIndex.get()));
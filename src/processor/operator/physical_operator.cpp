@@ -19,6 +19,8 @@ std::string PhysicalOperatorUtils::operatorTypeToString(PhysicalOperatorType ope
         return "ATTACH_DATABASE";
     case PhysicalOperatorType::BATCH_INSERT:
         return "BATCH_INSERT";
+    case PhysicalOperatorType::BLOOM_FILTER:
+        return "BLOOM_FILTER";
     case PhysicalOperatorType::STANDALONE_CALL:
         return "STANDALONE_CALL";
     case PhysicalOperatorType::COPY_TO:
@@ -185,7 +187,11 @@ bool PhysicalOperator::getNextTuple(ExecutionContext* context) {
         throw InterruptException{};
     }
     metrics->executionTime.start();
-    auto result = getNextTuplesInternal(context);
+    bool result;
+    {
+        ResourceMetricScope resourceScope{metrics->resources};
+        result = getNextTuplesInternal(context);
+    }
     context->clientContext->getProgressBar()->updateProgress(getProgress(context));
     metrics->executionTime.stop();
     return result;
@@ -194,7 +200,8 @@ bool PhysicalOperator::getNextTuple(ExecutionContext* context) {
 void PhysicalOperator::registerProfilingMetrics(Profiler* profiler) {
     auto executionTime = profiler->registerTimeMetric(getTimeMetricKey());
     auto numOutputTuple = profiler->registerNumericMetric(getNumTupleMetricKey());
-    metrics = std::make_unique<OperatorMetrics>(*executionTime, *numOutputTuple);
+    auto resources = profiler->registerResourceMetric(getResourceMetricKey());
+    metrics = std::make_unique<OperatorMetrics>(*executionTime, *numOutputTuple, *resources);
 }
 
 double PhysicalOperator::getExecutionTime(Profiler& profiler) const {
@@ -214,6 +221,18 @@ std::unordered_map<std::string, std::string> PhysicalOperator::getProfilerKeyVal
     std::unordered_map<std::string, std::string> result;
     result.insert({"ExecutionTime", std::to_string(getExecutionTime(profiler))});
     result.insert({"NumOutputTuples", std::to_string(getNumOutputTuples(profiler))});
+    // Resources are only printed if used, which keeps the boxes of most operators small.
+    auto resourceUsage = getResourceUsage(profiler);
+    if (resourceUsage.numPageHits > 0 || resourceUsage.numPageMisses > 0) {
+        result.insert({"NumPageHits", std::to_string(resourceUsage.numPageHits)});
+        result.insert({"NumPageMisses", std::to_string(resourceUsage.numPageMisses)});
+    }
+    if (resourceUsage.numBytesRead > 0) {
+        result.insert({"NumBytesRead", std::to_string(resourceUsage.numBytesRead)});
+    }
+    if (resourceUsage.peakMemoryUsage > 0) {
+        result.insert({"PeakMemoryUsage", std::to_string(resourceUsage.peakMemoryUsage)});
+    }
     return result;
 }
 
@@ -225,6 +244,18 @@ std::vector<std::string> PhysicalOperator::getProfilerAttributes(Profiler& profi
     return result;
 }
 
+OperatorResourceUsage PhysicalOperator::getResourceUsage(Profiler& profiler) const {
+    OperatorResourceUsage usage;
+    for (auto metric : profiler.getResourceMetricsWithKey(getResourceMetricKey())) {
+        usage.numPageHits += metric->numPageHits;
+        usage.numPageMisses += metric->numPageMisses;
+        usage.numBytesRead += metric->numBytesRead;
+        usage.peakMemoryUsage += metric->peakMemoryUsage;
+        usage.threadExecutionTimes.push_back(metric->getElapsedTimeMS());
+    }
+    return usage;
+}
+
 double PhysicalOperator::getProgress(ExecutionContext* /*context*/) const {
     return 0;
 }
@@ -1,5 +1,7 @@
 #include "processor/operator/profile.h"
 
+#include "json.hpp"
+#include "main/client_context.h"
 #include "main/plan_printer.h"
 
 using namespace kuzu::common;
@@ -18,7 +20,9 @@ bool Profile::getNextTuplesInternal(ExecutionContext* context) {
     localState.hasExecuted = true;
     ku_string_t profileStr;
     auto planPrinter = std::make_unique<main::PlanPrinter>(info.physicalPlan, context->profiler);
-    auto planInString = planPrinter->printPlanToOstream().str();
+    auto planInString = context->clientContext->getClientConfig()->profileJson ?
+                            planPrinter->printPlanToJson().dump(4) :
+                            planPrinter->printPlanToOstream().str();
     StringVector::addString(outputVector, profileStr, planInString.c_str(), planInString.length());
     auto selVector = outputVector->state->selVector;
     selVector->selectedSize = 1;
@@ -38,12 +38,12 @@ size_t BaseFrontierScanner::scan(RecursiveJoinVectors* vectors, sel_t& vectorPos
     return vectorPos - vectorPosBeforeScanning;
 }
 
-void BaseFrontierScanner::resetState(const BaseBFSState& bfsState) {
+void BaseFrontierScanner::resetState(const std::vector<std::unique_ptr<Frontier>>& frontiers_) {
     lastFrontierCursor = 0;
     currentDstNodeID = {INVALID_OFFSET, INVALID_TABLE_ID};
     frontiers.clear();
-    for (auto i = 0u; i < bfsState.getNumFrontiers(); ++i) {
-        frontiers.push_back(bfsState.getFrontier(i));
+    for (auto& frontier : frontiers_) {
+        frontiers.push_back(frontier.get());
     }
 }
 
@@ -131,7 +131,6 @@ void PathScanner::writePathToVector(RecursiveJoinVectors* vectors, sel_t& vector
 
 void DstNodeWithMultiplicityScanner::scanFromDstOffset(RecursiveJoinVectors* vectors,
     sel_t& vectorPos, sel_t& /*nodeIDDataVectorPos*/, sel_t& /*relIDDataVectorPos*/) {
-    auto& multiplicity = frontiers[k]->nodeIDToMultiplicity.at(currentDstNodeID);
     while (multiplicity > 0 && vectorPos < DEFAULT_VECTOR_CAPACITY) {
         writeDstNodeOffsetAndLength(vectors->dstNodeIDVector, vectors->pathLengthVector, vectorPos);
         vectorPos++;
@@ -0,0 +1,95 @@
+#include "processor/operator/recursive_extend/multi_source_bfs.h"
+
+#include <algorithm>
+#include <bit>
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+void MultiSourceBFS::addNodeTable(table_id_t tableID, offset_t numNodes) {
+    nodeTableStates.insert({tableID, std::make_unique<NodeTableState>(numNodes)});
+}
+
+void MultiSourceBFS::resetState(nodeID_t srcNodeID) {
+    for (auto& nodeID : visitedNodeIDs) {
+        auto& state = getNodeTableState(nodeID.tableID);
+        state.seen[nodeID.offset] = 0;
+        state.visit[nodeID.offset] = 0;
+    }
+    visitedNodeIDs.clear();
+    currentNodeIDs.clear();
+    nextNodeIDs.clear();
+    currentLevel = 0;
+    nextNodeIdxToExtend = 0;
+    srcTableID = srcNodeID.tableID;
+    firstSrcOffset = srcNodeID.offset - srcNodeID.offset % NUM_SOURCES_PER_BATCH;
+    auto& srcState = getNodeTableState(srcTableID);
+    numSources = std::min<uint64_t>(NUM_SOURCES_PER_BATCH, srcState.seen.size() - firstSrcOffset);
+    for (auto i = 0u; i < numSources; ++i) {
+        auto offset = firstSrcOffset + i;
+        srcState.seen[offset] = (uint64_t)1 << i;
+        srcState.visit[offset] = (uint64_t)1 << i;
+        currentNodeIDs.emplace_back(offset, srcTableID);
+        visitedNodeIDs.emplace_back(offset, srcTableID);
+        sourceFrontiers[i].clear();
+        sourceFrontiers[i].push_back(std::make_unique<Frontier>());
+        sourceFrontiers[i][0]->nodeIDs.emplace_back(offset, srcTableID);
+    }
+}
+
+nodeID_t MultiSourceBFS::getNextNodeID() {
+    if (nextNodeIdxToExtend == currentNodeIDs.size()) {
+        return nodeID_t{INVALID_OFFSET, INVALID_TABLE_ID};
+    }
+    auto nodeID = currentNodeIDs[nextNodeIdxToExtend++];
+    boundNodeVisit = getNodeTableState(nodeID.tableID).visit[nodeID.offset];
+    return nodeID;
+}
+
+void MultiSourceBFS::markVisited(nodeID_t nbrNodeID) {
+    auto& state = getNodeTableState(nbrNodeID.tableID);
+    auto sources = boundNodeVisit & ~state.seen[nbrNodeID.offset];
+    if (sources == 0) {
+        return;
+    }
+    if (state.visitNext[nbrNodeID.offset] == 0) {
+        nextNodeIDs.push_back(nbrNodeID);
+    }
+    state.visitNext[nbrNodeID.offset] |= sources;
+}
+
+void MultiSourceBFS::finalizeCurrentLevel() {
+    for (auto& nodeID : currentNodeIDs) {
+        getNodeTableState(nodeID.tableID).visit[nodeID.offset] = 0;
+    }
+    currentLevel++;
+    for (auto i = 0u; i < numSources; ++i) {
+        sourceFrontiers[i].push_back(std::make_unique<Frontier>());
+    }
+    std::sort(nextNodeIDs.begin(), nextNodeIDs.end());
+    for (auto& nodeID : nextNodeIDs) {
+        auto& state = getNodeTableState(nodeID.tableID);
+        auto sources = state.visitNext[nodeID.offset];
+        state.visitNext[nodeID.offset] = 0;
+        state.seen[nodeID.offset] |= sources;
+        state.visit[nodeID.offset] = sources;
+        visitedNodeIDs.push_back(nodeID);
+        addNodeToSourceFrontiers(nodeID, sources);
+    }
+    std::swap(currentNodeIDs, nextNodeIDs);
+    nextNodeIDs.clear();
+    nextNodeIdxToExtend = 0;
+}
+
+void MultiSourceBFS::addNodeToSourceFrontiers(nodeID_t nodeID, uint64_t sources) {
+    while (sources != 0) {
+        auto sourceIdx = std::countr_zero(sources);
+        sourceFrontiers[sourceIdx][currentLevel]->nodeIDs.push_back(nodeID);
+        sources &= sources - 1;
+    }
+}
+
+} // namespace processor
+} // namespace kuzu
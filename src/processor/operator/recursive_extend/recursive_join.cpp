@@ -4,6 +4,7 @@
 #include "processor/operator/recursive_extend/scan_frontier.h"
 #include "processor/operator/recursive_extend/shortest_path_state.h"
 #include "processor/operator/recursive_extend/variable_length_state.h"
+#include "storage/storage_manager.h"
 
 using namespace kuzu::common;
 
@@ -16,6 +17,18 @@ void RecursiveJoin::initLocalStateInternal(ResultSet* /*resultSet_*/, ExecutionC
     vectors->srcNodeIDVector = resultSet->getValueVector(dataInfo->srcNodePos).get();
     vectors->dstNodeIDVector = resultSet->getValueVector(dataInfo->dstNodePos).get();
     vectors->pathLengthVector = resultSet->getValueVector(dataInfo->pathLengthPos).get();
+    std::vector<std::pair<table_id_t, offset_t>> tableIDAndNumNodes;
+    auto storageManager = context->clientContext->getStorageManager();
+    for (auto tableID : dataInfo->recursiveDstNodeTableIDs) {
+        auto nodeTable = ku_dynamic_cast<storage::Table*, storage::NodeTable*>(
+            storageManager->getTable(tableID));
+        tableIDAndNumNodes.emplace_back(
+            tableID, nodeTable->getMaxNodeOffset(context->clientContext->getTx()) + 1);
+    }
+    if (queryRelType == QueryRelType::SHORTEST || queryRelType == QueryRelType::ALL_SHORTEST) {
+        visitedNodes = std::make_unique<VisitedNodes>(
+            context->clientContext->getMemoryManager(), tableIDAndNumNodes);
+    }
     std::vector<std::unique_ptr<BaseFrontierScanner>> scanners;
     switch (queryRelType) {
     case QueryRelType::VARIABLE_LENGTH: {
@@ -46,7 +59,7 @@ void RecursiveJoin::initLocalStateInternal(ResultSet* /*resultSet_*/, ExecutionC
         case planner::RecursiveJoinType::TRACK_PATH: {
             vectors->pathVector = resultSet->getValueVector(dataInfo->pathPos).get();
             bfsState = std::make_unique<ShortestPathState<true /* TRACK_PATH */>>(
-                upperBound, targetDstNodes.get());
+                upperBound, targetDstNodes.get(), visitedNodes.get());
             for (auto i = lowerBound; i <= upperBound; ++i) {
                 scanners.push_back(std::make_unique<PathScanner>(
                     targetDstNodes.get(), i, dataInfo->tableIDToName));
@@ -54,7 +67,7 @@ void RecursiveJoin::initLocalStateInternal(ResultSet* /*resultSet_*/, ExecutionC
         } break;
         case planner::RecursiveJoinType::TRACK_NONE: {
             bfsState = std::make_unique<ShortestPathState<false /* TRACK_PATH */>>(
-                upperBound, targetDstNodes.get());
+                upperBound, targetDstNodes.get(), visitedNodes.get());
             for (auto i = lowerBound; i <= upperBound; ++i) {
                 scanners.push_back(
                     std::make_unique<DstNodeWithMultiplicityScanner>(targetDstNodes.get(), i));
@@ -69,7 +82,7 @@ void RecursiveJoin::initLocalStateInternal(ResultSet* /*resultSet_*/, ExecutionC
         case planner::RecursiveJoinType::TRACK_PATH: {
             vectors->pathVector = resultSet->getValueVector(dataInfo->pathPos).get();
             bfsState = std::make_unique<AllShortestPathState<true /* TRACK_PATH */>>(
-                upperBound, targetDstNodes.get());
+                upperBound, targetDstNodes.get(), visitedNodes.get());
             for (auto i = lowerBound; i <= upperBound; ++i) {
                 scanners.push_back(std::make_unique<PathScanner>(
                     targetDstNodes.get(), i, dataInfo->tableIDToName));
@@ -77,7 +90,7 @@ void RecursiveJoin::initLocalStateInternal(ResultSet* /*resultSet_*/, ExecutionC
         } break;
         case planner::RecursiveJoinType::TRACK_NONE: {
             bfsState = std::make_unique<AllShortestPathState<false /* TRACK_PATH */>>(
-                upperBound, targetDstNodes.get());
+                upperBound, targetDstNodes.get(), visitedNodes.get());
             for (auto i = lowerBound; i <= upperBound; ++i) {
                 scanners.push_back(
                     std::make_unique<DstNodeWithMultiplicityScanner>(targetDstNodes.get(), i));
@@ -126,8 +139,20 @@ void RecursiveJoin::initLocalStateInternal(ResultSet* /*resultSet_*/, ExecutionC
         vectors->pathRelsLabelDataVector =
             StructVector::getFieldVector(pathRelsDataVector, pathRelsLabelFieldIdx).get();
     }
+    if (useMultiSourceBFS) {
+        KU_ASSERT(queryRelType == QueryRelType::SHORTEST &&
+                  joinType == planner::RecursiveJoinType::TRACK_NONE);
+        multiSourceBFS = std::make_unique<MultiSourceBFS>(upperBound);
+        for (auto& [tableID, numNodes] : tableIDAndNumNodes) {
+            multiSourceBFS->addNodeTable(tableID, numNodes);
+        }
+    }
     frontiersScanner = std::make_unique<FrontiersScanner>(std::move(scanners));
     initLocalRecursivePlan(context);
+    if (bwdRecursiveRoot != nullptr) {
+        initLocalBwdRecursivePlan(context);
+        bfsState->enableBottomUp();
+    }
 }
 
 bool RecursiveJoin::getNextTuplesInternal(ExecutionContext* context) {
@@ -152,9 +177,20 @@ bool RecursiveJoin::getNextTuplesInternal(ExecutionContext* context) {
         if (!children[0]->getNextTuple(context)) {
             return false;
         }
+        if (multiSourceBFS != nullptr) {
+            auto srcNodeID = vectors->srcNodeIDVector->getValue<nodeID_t>(
+                vectors->srcNodeIDVector->state->selVector->selectedPositions[0]);
+            // The BFS of the src node may have been computed as part of the previous batch.
+            if (!multiSourceBFS->containsSource(srcNodeID)) {
+                multiSourceBFS->resetState(srcNodeID);
+                computeMultiSourceBFS(context); // Phase 1
+            }
+            frontiersScanner->resetState(multiSourceBFS->getFrontiers(srcNodeID));
+            continue;
+        }
         bfsState->resetState();
         computeBFS(context); // Phase 1
-        frontiersScanner->resetState(*bfsState);
+        frontiersScanner->resetState(bfsState->getFrontiers());
     }
 }
 
@@ -181,7 +217,14 @@ void RecursiveJoin::computeBFS(ExecutionContext* context) {
     scanFrontier->setNodePredicateExecFlag(true);
     while (!bfsState->isComplete()) {
         auto boundNodeID = bfsState->getNextNodeID();
-        if (boundNodeID.offset != INVALID_OFFSET) {
+        if (boundNodeID.offset != INVALID_OFFSET && bfsState->isBottomUp()) {
+            // Found an unvisited node. Extend it backwards to find its neighbors in current
+            // frontier.
+            bwdScanFrontier->setNodeID(boundNodeID);
+            while (bwdRecursiveRoot->getNextTuple(context)) { // Exhaust backward recursive plan.
+                updateVisitedNodesBottomUp(boundNodeID);
+            }
+        } else if (boundNodeID.offset != INVALID_OFFSET) {
             // Found a starting node from current frontier.
             scanFrontier->setNodeID(boundNodeID);
             while (recursiveRoot->getNextTuple(context)) { // Exhaust recursive plan.
@@ -195,6 +238,27 @@ void RecursiveJoin::computeBFS(ExecutionContext* context) {
     }
 }
 
+void RecursiveJoin::computeMultiSourceBFS(ExecutionContext* context) {
+    scanFrontier->setNodePredicateExecFlag(true);
+    while (!multiSourceBFS->isComplete()) {
+        auto boundNodeID = multiSourceBFS->getNextNodeID();
+        if (boundNodeID.offset != INVALID_OFFSET) {
+            scanFrontier->setNodeID(boundNodeID);
+            while (recursiveRoot->getNextTuple(context)) {
+                auto selVector = vectors->recursiveDstNodeIDVector->state->selVector.get();
+                for (auto i = 0u; i < selVector->selectedSize; ++i) {
+                    auto pos = selVector->selectedPositions[i];
+                    multiSourceBFS->markVisited(
+                        vectors->recursiveDstNodeIDVector->getValue<nodeID_t>(pos));
+                }
+            }
+        } else {
+            multiSourceBFS->finalizeCurrentLevel();
+            scanFrontier->setNodePredicateExecFlag(false);
+        }
+    }
+}
+
 void RecursiveJoin::updateVisitedNodes(nodeID_t boundNodeID) {
     auto boundNodeMultiplicity = bfsState->getMultiplicity(boundNodeID);
     for (auto i = 0u; i < vectors->recursiveDstNodeIDVector->state->selVector->selectedSize; ++i) {
@@ -205,6 +269,19 @@ void RecursiveJoin::updateVisitedNodes(nodeID_t boundNodeID) {
     }
 }
 
+void RecursiveJoin::updateVisitedNodesBottomUp(nodeID_t nodeID) {
+    auto selVector = vectors->bwdRecursiveDstNodeIDVector->state->selVector.get();
+    for (auto i = 0u; i < selVector->selectedSize; ++i) {
+        auto pos = selVector->selectedPositions[i];
+        auto nbrNodeID = vectors->bwdRecursiveDstNodeIDVector->getValue<nodeID_t>(pos);
+        if (!bfsState->isInCurrentFrontier(nbrNodeID)) {
+            continue;
+        }
+        auto edgeID = vectors->bwdRecursiveEdgeIDVector->getValue<relID_t>(pos);
+        bfsState->markVisited(nbrNodeID, nodeID, edgeID, bfsState->getMultiplicity(nbrNodeID));
+    }
+}
+
 void RecursiveJoin::initLocalRecursivePlan(ExecutionContext* context) {
     auto op = recursiveRoot.get();
     while (!op->isSource()) {
@@ -221,6 +298,22 @@ void RecursiveJoin::initLocalRecursivePlan(ExecutionContext* context) {
     recursiveRoot->initLocalState(localResultSet.get(), context);
 }
 
+void RecursiveJoin::initLocalBwdRecursivePlan(ExecutionContext* context) {
+    auto op = bwdRecursiveRoot.get();
+    while (!op->isSource()) {
+        KU_ASSERT(op->getNumChildren() == 1);
+        op = op->getChild(0);
+    }
+    bwdScanFrontier = (ScanFrontier*)op;
+    bwdLocalResultSet = std::make_unique<ResultSet>(
+        dataInfo->bwdLocalResultSetDescriptor.get(), context->clientContext->getMemoryManager());
+    vectors->bwdRecursiveDstNodeIDVector =
+        bwdLocalResultSet->getValueVector(dataInfo->bwdRecursiveDstNodeIDPos).get();
+    vectors->bwdRecursiveEdgeIDVector =
+        bwdLocalResultSet->getValueVector(dataInfo->bwdRecursiveEdgeIDPos).get();
+    bwdRecursiveRoot->initLocalState(bwdLocalResultSet.get(), context);
+}
+
 void RecursiveJoin::populateTargetDstNodes(ExecutionContext* context) {
     frontier::node_id_set_t targetNodeIDs;
     uint64_t numTargetNodes = 0;
@@ -0,0 +1,156 @@
+#include "processor/operator/recursive_extend/visited_nodes.h"
+
+#include <bit>
+#include <cstring>
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace processor {
+
+VisitedNodes::NodeTableArrays::NodeTableArrays(offset_t numNodes) : numNodes{numNodes} {
+    bitmapBlocks.resize((numNodes + NUM_NODES_PER_BITMAP_BLOCK - 1) / NUM_NODES_PER_BITMAP_BLOCK);
+    levelBlocks.resize((numNodes + NUM_NODES_PER_LEVEL_BLOCK - 1) / NUM_NODES_PER_LEVEL_BLOCK);
+}
+
+VisitedNodes::VisitedNodes(MemoryManager* memoryManager,
+    const std::vector<std::pair<table_id_t, offset_t>>& tableIDAndNumNodes)
+    : memoryManager{memoryManager}, numNodes{0}, numVisited{0}, dense{false}, scanTableIdx{0},
+      scanOffset{0} {
+    auto sortedTableIDAndNumNodes = tableIDAndNumNodes;
+    std::sort(sortedTableIDAndNumNodes.begin(), sortedTableIDAndNumNodes.end());
+    for (auto& [tableID, numNodesInTable] : sortedTableIDAndNumNodes) {
+        tableIDs.push_back(tableID);
+        tableArrays.push_back(std::make_unique<NodeTableArrays>(numNodesInTable));
+        numNodes += numNodesInTable;
+    }
+}
+
+void VisitedNodes::resetState() {
+    if (dense) {
+        // Levels are only read for nodes set in the bitmap, so only bitmaps need to be zeroed.
+        for (auto& arrays : tableArrays) {
+            for (auto blockIdx = 0u; blockIdx < arrays->bitmapBlocks.size(); blockIdx++) {
+                auto& block = arrays->bitmapBlocks[blockIdx];
+                if (block == nullptr) {
+                    continue;
+                }
+                auto numNodesInBlock = std::min(NUM_NODES_PER_BITMAP_BLOCK,
+                    arrays->numNodes - blockIdx * NUM_NODES_PER_BITMAP_BLOCK);
+                memset(block->buffer, 0, (numNodesInBlock + 63) / 64 * sizeof(uint64_t));
+            }
+        }
+    }
+    visitedNodeToLevel.clear();
+    numVisited = 0;
+    dense = false;
+}
+
+bool VisitedNodes::contains(nodeID_t nodeID) const {
+    if (!dense) {
+        return visitedNodeToLevel.contains(nodeID);
+    }
+    return isVisitedInBitmap(getArrays(nodeID.tableID), nodeID.offset);
+}
+
+uint8_t VisitedNodes::getLevel(nodeID_t nodeID) const {
+    KU_ASSERT(contains(nodeID));
+    if (!dense) {
+        return visitedNodeToLevel.at(nodeID);
+    }
+    auto& arrays = getArrays(nodeID.tableID);
+    return arrays.levelBlocks[nodeID.offset / NUM_NODES_PER_LEVEL_BLOCK]
+        ->buffer[nodeID.offset % NUM_NODES_PER_LEVEL_BLOCK];
+}
+
+void VisitedNodes::insert(nodeID_t nodeID, uint8_t level) {
+    KU_ASSERT(!contains(nodeID));
+    numVisited++;
+    if (!dense) {
+        visitedNodeToLevel.insert({nodeID, level});
+        if (numVisited * DENSE_RATIO >= numNodes) {
+            switchToDense();
+        }
+        return;
+    }
+    auto& arrays = getArrays(nodeID.tableID);
+    KU_ASSERT(nodeID.offset < arrays.numNodes);
+    auto& bitmapBlock = arrays.bitmapBlocks[nodeID.offset / NUM_NODES_PER_BITMAP_BLOCK];
+    if (bitmapBlock == nullptr) {
+        bitmapBlock = memoryManager->allocateBuffer(true /* initializeToZero */);
+    }
+    auto posInBlock = nodeID.offset % NUM_NODES_PER_BITMAP_BLOCK;
+    reinterpret_cast<uint64_t*>(bitmapBlock->buffer)[posInBlock / 64] |=
+        (uint64_t)1 << (posInBlock % 64);
+    *getLevelToWrite(arrays, nodeID.offset) = level;
+}
+
+void VisitedNodes::initUnvisitedScan() {
+    KU_ASSERT(dense);
+    scanTableIdx = 0;
+    scanOffset = 0;
+}
+
+nodeID_t VisitedNodes::getNextUnvisitedNodeID() {
+    while (scanTableIdx < tableIDs.size()) {
+        auto& arrays = *tableArrays[scanTableIdx];
+        while (scanOffset < arrays.numNodes) {
+            auto& bitmapBlock = arrays.bitmapBlocks[scanOffset / NUM_NODES_PER_BITMAP_BLOCK];
+            if (bitmapBlock == nullptr) {
+                // No node in the block has been visited.
+                return nodeID_t{scanOffset++, tableIDs[scanTableIdx]};
+            }
+            auto posInBlock = scanOffset % NUM_NODES_PER_BITMAP_BLOCK;
+            auto word = reinterpret_cast<uint64_t*>(bitmapBlock->buffer)[posInBlock / 64];
+            auto unvisited = ~word >> (posInBlock % 64);
+            if (unvisited == 0) {
+                // Skip the rest of the word, in which all nodes have been visited.
+                scanOffset += 64 - posInBlock % 64;
+                continue;
+            }
+            scanOffset += std::countr_zero(unvisited);
+            if (scanOffset >= arrays.numNodes) {
+                break;
+            }
+            return nodeID_t{scanOffset++, tableIDs[scanTableIdx]};
+        }
+        scanTableIdx++;
+        scanOffset = 0;
+    }
+    return nodeID_t{INVALID_OFFSET, INVALID_TABLE_ID};
+}
+
+void VisitedNodes::switchToDense() {
+    dense = true;
+    numVisited = 0;
+    for (auto& [nodeID, level] : visitedNodeToLevel) {
+        insert(nodeID, level);
+    }
+    visitedNodeToLevel.clear();
+}
+
+bool VisitedNodes::isVisitedInBitmap(const NodeTableArrays& arrays, offset_t offset) {
+    if (offset >= arrays.numNodes) {
+        return false;
+    }
+    auto& bitmapBlock = arrays.bitmapBlocks[offset / NUM_NODES_PER_BITMAP_BLOCK];
+    if (bitmapBlock == nullptr) {
+        return false;
+    }
+    auto posInBlock = offset % NUM_NODES_PER_BITMAP_BLOCK;
+    return (reinterpret_cast<const uint64_t*>(bitmapBlock->buffer)[posInBlock / 64] >>
+               (posInBlock % 64)) &
+           1;
+}
+
+uint8_t* VisitedNodes::getLevelToWrite(NodeTableArrays& arrays, offset_t offset) {
+    auto& levelBlock = arrays.levelBlocks[offset / NUM_NODES_PER_LEVEL_BLOCK];
+    if (levelBlock == nullptr) {
+        levelBlock = memoryManager->allocateBuffer();
+    }
+    return levelBlock->buffer + offset % NUM_NODES_PER_LEVEL_BLOCK;
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -1,23 +1,39 @@
 #include "processor/operator/scan_node_id.h"
 
+#include "storage/storage_utils.h"
+
 using namespace kuzu::common;
+using namespace kuzu::storage;
 using namespace kuzu::transaction;
 
 namespace kuzu {
 namespace processor {
 
-std::pair<offset_t, offset_t> NodeTableScanState::getNextRangeToRead() {
-    // Note: we use maxNodeOffset=UINT64_MAX to represent an empty table.
-    if (currentNodeOffset > maxNodeOffset || maxNodeOffset == INVALID_OFFSET) {
-        return std::make_pair(currentNodeOffset, currentNodeOffset);
-    }
-    if (isSemiMaskEnabled()) {
-        auto currentMorselIdx = MaskUtil::getMorselIdx(currentNodeOffset);
-        KU_ASSERT(currentNodeOffset % DEFAULT_VECTOR_CAPACITY == 0);
-        while (currentMorselIdx <= maxMorselIdx && !semiMask->isMorselMasked(currentMorselIdx)) {
-            currentMorselIdx++;
+std::pair<offset_t, offset_t> NodeTableScanState::getNextRangeToRead(Transaction* transaction) {
+    while (true) {
+        // Note: we use maxNodeOffset=UINT64_MAX to represent an empty table.
+        if (currentNodeOffset > maxNodeOffset || maxNodeOffset == INVALID_OFFSET) {
+            return std::make_pair(currentNodeOffset, currentNodeOffset);
+        }
+        if (isSemiMaskEnabled()) {
+            auto currentMorselIdx = MaskUtil::getMorselIdx(currentNodeOffset);
+            KU_ASSERT(currentNodeOffset % DEFAULT_VECTOR_CAPACITY == 0);
+            while (
+                currentMorselIdx <= maxMorselIdx && !semiMask->isMorselMasked(currentMorselIdx)) {
+                currentMorselIdx++;
+            }
+            currentNodeOffset = std::min(currentMorselIdx * DEFAULT_VECTOR_CAPACITY, maxNodeOffset);
         }
-        currentNodeOffset = std::min(currentMorselIdx * DEFAULT_VECTOR_CAPACITY, maxNodeOffset);
+        if (zoneMapPredicates.empty()) {
+            break;
+        }
+        auto nodeGroupIdx = StorageUtils::getNodeGroupIdx(currentNodeOffset);
+        if (nodeGroupIdx == lastCheckedNodeGroupIdx ||
+            !table->canSkipNodeGroup(transaction, nodeGroupIdx, zoneMapPredicates)) {
+            lastCheckedNodeGroupIdx = nodeGroupIdx;
+            break;
+        }
+        currentNodeOffset = StorageUtils::getStartOffsetOfNodeGroup(nodeGroupIdx + 1);
     }
     auto startOffset = currentNodeOffset;
     auto range = std::min(DEFAULT_VECTOR_CAPACITY, maxNodeOffset + 1 - currentNodeOffset);
@@ -37,18 +53,20 @@ void ScanNodeIDSharedState::initialize(Transaction* transaction) {
     numNodesScanned = 0;
 }
 
-std::tuple<NodeTableScanState*, offset_t, offset_t> ScanNodeIDSharedState::getNextRangeToRead() {
+std::tuple<NodeTableScanState*, offset_t, offset_t> ScanNodeIDSharedState::getNextRangeToRead(
+    Transaction* transaction) {
     std::unique_lock lck{mtx};
     if (currentStateIdx == tableStates.size()) {
         return std::make_tuple(nullptr, INVALID_OFFSET, INVALID_OFFSET);
     }
-    auto [startOffset, endOffset] = tableStates[currentStateIdx]->getNextRangeToRead();
+    auto [startOffset, endOffset] = tableStates[currentStateIdx]->getNextRangeToRead(transaction);
     while (startOffset >= endOffset) {
         currentStateIdx++;
         if (currentStateIdx == tableStates.size()) {
             return std::make_tuple(nullptr, INVALID_OFFSET, INVALID_OFFSET);
         }
-        auto [_startOffset, _endOffset] = tableStates[currentStateIdx]->getNextRangeToRead();
+        auto [_startOffset, _endOffset] =
+            tableStates[currentStateIdx]->getNextRangeToRead(transaction);
         startOffset = _startOffset;
         endOffset = _endOffset;
     }
@@ -63,8 +81,15 @@ void ScanNodeID::initLocalStateInternal(ResultSet* resultSet, ExecutionContext*
 }
 
 bool ScanNodeID::getNextTuplesInternal(ExecutionContext* context) {
+    // Morsels are handed out dynamically, so this thread can leave the pipeline between two morsels
+    // and let the other threads of the pipeline scan the remaining ones.
+    if (yielded || (context->task != nullptr && context->task->tryYield())) {
+        yielded = true;
+        return false;
+    }
     do {
-        auto [state, startOffset, endOffset] = sharedState->getNextRangeToRead();
+        auto [state, startOffset, endOffset] =
+            sharedState->getNextRangeToRead(context->clientContext->getTx());
         if (state == nullptr) {
             return false;
         }
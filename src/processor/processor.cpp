@@ -12,6 +12,7 @@ namespace processor {
 
 QueryProcessor::QueryProcessor(uint64_t numThreads) {
     taskScheduler = std::make_unique<TaskScheduler>(numThreads);
+    admissionController = std::make_unique<AdmissionController>(numThreads);
 }
 
 std::shared_ptr<FactorizedTable> QueryProcessor::execute(
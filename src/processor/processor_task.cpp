@@ -1,22 +1,20 @@
 #include "processor/processor_task.h"
 
-#include "main/settings.h"
-
 using namespace kuzu::common;
 
 namespace kuzu {
 namespace processor {
 
 ProcessorTask::ProcessorTask(Sink* sink, ExecutionContext* executionContext)
-    : Task{executionContext->clientContext->getCurrentSetting(main::ThreadsSetting::name)
-               .getValue<uint64_t>()},
-      sharedStateInitialized{false}, sink{sink}, executionContext{executionContext} {}
+    : Task{executionContext->numThreads}, sharedStateInitialized{false}, sink{sink},
+      executionContext{executionContext} {}
 
 void ProcessorTask::run() {
     // We need the lock when cloning because multiple threads can be accessing to clone,
     // which is not thread safe
     lock_t lck{mtx};
     if (!sharedStateInitialized) {
+        executionContext->task = this;
         sink->initGlobalState(executionContext);
         sharedStateInitialized = true;
     }
@@ -303,6 +303,13 @@ void FactorizedTable::clear() {
     inMemOverflowBuffer->resetBuffer();
 }
 
+uint64_t FactorizedTable::getMemoryUsage() const {
+    auto numBlocks =
+        flatTupleBlockCollection->getNumBlocks() + unflatTupleBlockCollection->getNumBlocks();
+    return numBlocks * BufferPoolConstants::PAGE_256KB_SIZE +
+           inMemOverflowBuffer->getMemoryUsage();
+}
+
 void FactorizedTable::setOverflowColNull(
     uint8_t* nullBuffer, ft_col_idx_t colIdx, ft_tuple_idx_t tupleIdx) {
     NullBuffer::setNull(nullBuffer, tupleIdx);
@@ -663,6 +670,19 @@ void FlatTupleIterator::getNextFlatTuple() {
     nextFlatTupleIdx++;
 }
 
+uint64_t FlatTupleIterator::skipFlatTuples(uint64_t numTuples, ft_tuple_idx_t& startTupleIdx) {
+    KU_ASSERT(!factorizedTable.hasUnflatCol());
+    if (numTuples == 0 || !hasNextFlatTuple()) {
+        return 0;
+    }
+    // The current tuple has not been read yet if it still has flat tuples left.
+    startTupleIdx = nextFlatTupleIdx < numFlatTuples ? nextTupleIdx - 1 : nextTupleIdx;
+    auto numTuplesSkipped = std::min(numTuples, factorizedTable.getNumTuples() - startTupleIdx);
+    nextTupleIdx = startTupleIdx + numTuplesSkipped;
+    nextFlatTupleIdx = numFlatTuples;
+    return numTuplesSkipped;
+}
+
 void FlatTupleIterator::resetState() {
     numFlatTuples = 0;
     nextFlatTupleIdx = 0;
@@ -0,0 +1,106 @@
+#include "processor/result/spill_file.h"
+
+#include <atomic>
+#include <fcntl.h>
+
+#include "common/file_system/virtual_file_system.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+static std::string getSpillFilePath(const std::string& directory) {
+    // Spill files only live for the duration of a query, so a counter is enough to keep the
+    // names of the files that are alive at the same time apart.
+    static std::atomic<uint64_t> nextFileIdx{0};
+    auto fileName = "spill_" + std::to_string(nextFileIdx.fetch_add(1)) + ".tmp";
+    return FileSystem::joinPath(directory, fileName);
+}
+
+SpillFile::SpillFile(VirtualFileSystem* vfs, const std::string& directory)
+    : vfs{vfs}, path{getSpillFilePath(directory)}, numRows{0} {
+    writer =
+        std::make_unique<BufferedFileWriter>(vfs->openFile(path, O_WRONLY | O_CREAT | O_TRUNC));
+}
+
+SpillFile::~SpillFile() {
+    writer.reset();
+    vfs->removeFileIfExists(path);
+}
+
+void SpillFile::writeValue(const ValueVector& vector, uint32_t pos) {
+    auto isNull = vector.isNull(pos);
+    write<uint8_t>(isNull);
+    if (isNull) {
+        return;
+    }
+    switch (vector.dataType.getPhysicalType()) {
+    case PhysicalTypeID::STRING: {
+        auto& str = vector.getValue<ku_string_t>(pos);
+        write<uint32_t>(str.len);
+        writer->write(str.getData(), str.len);
+    } break;
+    case PhysicalTypeID::LIST: {
+        auto& listEntry = vector.getValue<list_entry_t>(pos);
+        write<uint32_t>(listEntry.size);
+        auto dataVector = ListVector::getDataVector(&vector);
+        for (auto i = 0u; i < listEntry.size; i++) {
+            writeValue(*dataVector, listEntry.offset + i);
+        }
+    } break;
+    case PhysicalTypeID::STRUCT: {
+        for (auto& fieldVector : StructVector::getFieldVectors(&vector)) {
+            writeValue(*fieldVector, pos);
+        }
+    } break;
+    default: {
+        auto numBytesPerValue = vector.getNumBytesPerValue();
+        writer->write(vector.getData() + pos * numBytesPerValue, numBytesPerValue);
+    }
+    }
+}
+
+SpillFileReader::SpillFileReader(const SpillFile& file) {
+    KU_ASSERT(file.writer == nullptr);
+    reader = std::make_unique<BufferedFileReader>(file.vfs->openFile(file.path, O_RDONLY));
+}
+
+SpillFileReader::~SpillFileReader() = default;
+
+void SpillFileReader::readValue(ValueVector& vector, uint32_t pos) {
+    auto isNull = read<uint8_t>();
+    vector.setNull(pos, isNull);
+    if (isNull) {
+        return;
+    }
+    switch (vector.dataType.getPhysicalType()) {
+    case PhysicalTypeID::STRING: {
+        auto length = read<uint32_t>();
+        stringBuffer.resize(length);
+        reader->read(reinterpret_cast<uint8_t*>(stringBuffer.data()), length);
+        StringVector::addString(&vector, pos, stringBuffer.data(), length);
+    } break;
+    case PhysicalTypeID::LIST: {
+        auto listSize = read<uint32_t>();
+        auto listEntry = ListVector::addList(&vector, listSize);
+        vector.setValue(pos, listEntry);
+        auto dataVector = ListVector::getDataVector(&vector);
+        for (auto i = 0u; i < listSize; i++) {
+            readValue(*dataVector, listEntry.offset + i);
+        }
+    } break;
+    case PhysicalTypeID::STRUCT: {
+        for (auto& fieldVector : StructVector::getFieldVectors(&vector)) {
+            readValue(*fieldVector, pos);
+        }
+    } break;
+    default: {
+        auto numBytesPerValue = vector.getNumBytesPerValue();
+        reader->read(vector.getData() + pos * numBytesPerValue, numBytesPerValue);
+    }
+    }
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -17,61 +17,25 @@ using namespace kuzu::common;
 
 namespace kuzu {
 namespace storage {
-// In this function, we try to remove as many as possible candidates that are not evictable from the
-// eviction queue until we hit a candidate that is evictable.
-// 1) If the candidate page's version has changed, which means the page was pinned and unpinned, we
-// remove the candidate from the queue.
-// 2) If the candidate page's state is UNLOCKED, and its page version hasn't changed, which means
-// the page was optimistically read, we give a second chance to evict the page by marking the page
-// as MARKED, and moving the candidate to the back of the queue.
-// 3) If the candidate page's state is LOCKED, we remove the candidate from the queue.
-void EvictionQueue::removeNonEvictableCandidates() {
-    std::shared_lock sLck{mtx};
-    while (true) {
-        EvictionCandidate evictionCandidate;
-        if (!queue->try_dequeue(evictionCandidate)) {
-            break;
-        }
-        auto pageStateAndVersion = evictionCandidate.pageState->getStateAndVersion();
-        if (evictionCandidate.isEvictable(pageStateAndVersion)) {
-            queue->enqueue(evictionCandidate);
-            break;
-        } else if (evictionCandidate.isSecondChanceEvictable(pageStateAndVersion)) {
-            // The page was optimistically read, mark it as MARKED, and enqueue to be evicted later.
-            evictionCandidate.pageState->tryMark(pageStateAndVersion);
-            queue->enqueue(evictionCandidate);
-            continue;
-        } else {
-            // Cases to remove the candidate from the queue:
-            // 1) The page is currently LOCKED (it is currently pinned), remove the candidate from
-            // the queue.
-            // 2) The page's version number has changed (it was pinned and unpinned), another
-            // candidate exists for this page in the queue. remove the candidate from the queue.
-            continue;
-        }
-    }
-}
-
-void EvictionQueue::removeCandidatesForFile(kuzu::storage::BMFileHandle& fileHandle) {
-    std::unique_lock xLck{mtx};
-    EvictionCandidate candidate;
-    uint64_t loopedCandidateIdx = 0;
-    auto numCandidatesInQueue = queue->size();
-    while (loopedCandidateIdx < numCandidatesInQueue && queue->try_dequeue(candidate)) {
-        if (candidate.fileHandle != &fileHandle) {
-            queue->enqueue(candidate);
-        }
-        loopedCandidateIdx++;
-    }
-}
 
-BufferManager::BufferManager(uint64_t bufferPoolSize, uint64_t maxDBSize)
-    : usedMemory{0}, bufferPoolSize{bufferPoolSize}, numEvictionQueueInsertions{0} {
+BufferManager::BufferManager(
+    uint64_t bufferPoolSize, uint64_t maxDBSize, EvictionPolicy evictionPolicy)
+    : usedMemory{0}, bufferPoolSize{bufferPoolSize}, numEvictionQueueInsertions{0}, numPageHits{0},
+      numPageMisses{0}, evictionPolicy{evictionPolicy} {
     verifySizeParams(bufferPoolSize, maxDBSize);
     vmRegions.resize(2);
     vmRegions[0] = std::make_unique<VMRegion>(PageSizeClass::PAGE_4KB, maxDBSize);
     vmRegions[1] = std::make_unique<VMRegion>(PageSizeClass::PAGE_256KB, bufferPoolSize);
-    evictionQueue = std::make_unique<EvictionQueue>();
+    replacementPolicy = ReplacementPolicy::create(evictionPolicy, bufferPoolSize);
+    prefetcher = std::make_unique<PagePrefetcher>(this, BufferPoolConstants::NUM_PREFETCH_THREADS);
+}
+
+BufferManager::~BufferManager() {
+    prefetcher.reset();
+}
+
+void BufferManager::clearEvictionQueue() {
+    replacementPolicy = ReplacementPolicy::create(evictionPolicy, bufferPoolSize.load());
 }
 
 void BufferManager::verifySizeParams(uint64_t bufferPoolSize, uint64_t maxDBSize) {
@@ -116,6 +80,7 @@ uint8_t* BufferManager::pin(
         case PageState::UNLOCKED:
         case PageState::MARKED: {
             if (pageState->tryLock(currStateAndVersion)) {
+                countPageHit();
                 return getFrame(fileHandle, pageIdx);
             }
         } break;
@@ -192,6 +157,8 @@ void BufferManager::optimisticRead(
     // Change the Structured Exception handling just for the scope of this function
     auto translator = ScopedTranslator(handleAccessViolation);
 #endif
+    // Pages read into frames by this function are counted as misses, not hits.
+    auto isHit = true;
     while (true) {
         auto currStateAndVersion = pageState->getStateAndVersion();
         switch (PageState::getState(currStateAndVersion)) {
@@ -201,6 +168,9 @@ void BufferManager::optimisticRead(
                 continue;
             }
             if (pageState->getStateAndVersion() == currStateAndVersion) {
+                if (isHit) {
+                    countPageHit();
+                }
                 return;
             }
         } break;
@@ -209,6 +179,9 @@ void BufferManager::optimisticRead(
             if (pageState->tryClearMark(currStateAndVersion)) {
                 if (try_func(func, getFrame(fileHandle, pageIdx), vmRegions,
                         fileHandle.getPageSizeClass())) {
+                    if (isHit) {
+                        countPageHit();
+                    }
                     return;
                 }
             }
@@ -216,6 +189,7 @@ void BufferManager::optimisticRead(
         case PageState::EVICTED: {
             pin(fileHandle, pageIdx, PageReadPolicy::READ_PAGE);
             unpin(fileHandle, pageIdx);
+            isHit = false;
         } break;
         default: {
             // When locked, continue the spinning.
@@ -236,7 +210,8 @@ void BufferManager::unpin(BMFileHandle& fileHandle, page_idx_t pageIdx) {
 // memory is available.
 // First, we reserve the memory for the page, which increments the atomic counter `usedMemory`.
 // Then, we check if there is enough memory available. If not, we evict pages until we have enough
-// or we can find no more pages to be evicted.
+// or we can find no more pages to be evicted. The order in which candidates are checked is decided
+// by the replacement policy.
 // Lastly, we double check if the needed memory is available. If not, we free the memory we reserved
 // and return false, otherwise, we load the page to its corresponding frame and return true.
 bool BufferManager::claimAFrame(
@@ -248,7 +223,7 @@ bool BufferManager::claimAFrame(
     // Evict pages if necessary until we have enough memory.
     while ((currentUsedMem + pageSizeToClaim - claimedMemory) > bufferPoolSize.load()) {
         EvictionCandidate evictionCandidate;
-        if (!evictionQueue->dequeue(evictionCandidate)) {
+        if (!replacementPolicy->dequeue(evictionCandidate, currentUsedMem - claimedMemory)) {
             // Cannot find more pages to be evicted. Free the memory we reserved and return false.
             freeUsedMemory(pageSizeToClaim);
             return false;
@@ -257,7 +232,7 @@ bool BufferManager::claimAFrame(
         if (!evictionCandidate.isEvictable(pageStateAndVersion)) {
             if (evictionCandidate.isSecondChanceEvictable(pageStateAndVersion)) {
                 evictionCandidate.pageState->tryMark(pageStateAndVersion);
-                evictionQueue->enqueue(evictionCandidate);
+                replacementPolicy->enqueue(evictionCandidate);
             }
             continue;
         }
@@ -282,12 +257,13 @@ void BufferManager::addToEvictionQueue(
     BMFileHandle* fileHandle, page_idx_t pageIdx, PageState* pageState) {
     auto currStateAndVersion = pageState->getStateAndVersion();
     if (++numEvictionQueueInsertions == BufferPoolConstants::EVICTION_QUEUE_PURGING_INTERVAL) {
-        evictionQueue->removeNonEvictableCandidates();
+        replacementPolicy->removeNonEvictableCandidates();
         numEvictionQueueInsertions = 0;
     }
     pageState->tryMark(currStateAndVersion);
-    evictionQueue->enqueue(
-        fileHandle, pageIdx, pageState, PageState::getVersion(currStateAndVersion));
+    auto candidate = EvictionCandidate{
+        fileHandle, pageIdx, pageState, PageState::getVersion(currStateAndVersion)};
+    replacementPolicy->enqueue(candidate);
 }
 
 uint64_t BufferManager::tryEvictPage(EvictionCandidate& candidate) {
@@ -302,8 +278,10 @@ uint64_t BufferManager::tryEvictPage(EvictionCandidate& candidate) {
     // is dirty. Finally remove the page from the frame and reset the page to EVICTED.
     flushIfDirtyWithoutLock(*candidate.fileHandle, candidate.pageIdx);
     auto numBytesFreed = candidate.fileHandle->getPageSize();
+    auto wasHot = pageState.isHot();
     releaseFrameForPage(*candidate.fileHandle, candidate.pageIdx);
     pageState.resetToEvicted();
+    replacementPolicy->onPageEvicted(*candidate.fileHandle, candidate.pageIdx, wasHot);
     return numBytesFreed;
 }
 
@@ -312,11 +290,77 @@ void BufferManager::cachePageIntoFrame(
     auto pageState = fileHandle.getPageState(pageIdx);
     pageState->clearDirty();
     if (pageReadPolicy == PageReadPolicy::READ_PAGE) {
+        countPageMiss(fileHandle.getPageSize());
+        if (replacementPolicy->onPageMiss(fileHandle, pageIdx)) {
+            pageState->setHot();
+        }
         fileHandle.getFileInfo()->readFromFile((void*)getFrame(fileHandle, pageIdx),
             fileHandle.getPageSize(), pageIdx * fileHandle.getPageSize());
     }
 }
 
+// Reads the evicted pages in the given range into their frames. Consecutive pages within a page
+// group are mapped to consecutive frames, so each run of evicted pages is read with a single I/O.
+// Pages that are cached or currently locked are skipped. We stop once no frame can be claimed.
+void BufferManager::prefetchPages(
+    BMFileHandle& fileHandle, page_idx_t startPageIdx, page_idx_t numPages) {
+    auto endPageIdx = std::min<page_idx_t>(startPageIdx + numPages, fileHandle.getNumPages());
+    auto pageIdx = startPageIdx;
+    while (pageIdx < endPageIdx) {
+        auto runStartPageIdx = pageIdx;
+        auto canClaimFrames = true;
+        while (pageIdx < endPageIdx &&
+               (pageIdx == runStartPageIdx ||
+                   (pageIdx & StorageConstants::PAGE_IDX_IN_GROUP_MASK) != 0)) {
+            auto pageState = fileHandle.getPageState(pageIdx);
+            auto currStateAndVersion = pageState->getStateAndVersion();
+            if (PageState::getState(currStateAndVersion) != PageState::EVICTED ||
+                !pageState->tryLock(currStateAndVersion)) {
+                break;
+            }
+            if (!claimAFrame(fileHandle, pageIdx, PageReadPolicy::DONT_READ_PAGE)) {
+                pageState->resetToEvicted();
+                canClaimFrames = false;
+                break;
+            }
+            pageIdx++;
+        }
+        auto numPagesInRun = pageIdx - runStartPageIdx;
+        if (numPagesInRun > 0) {
+            readPagesIntoFrames(fileHandle, runStartPageIdx, numPagesInRun);
+        } else if (canClaimFrames) {
+            // The page is already cached or being pinned by another thread.
+            pageIdx++;
+        }
+        if (!canClaimFrames) {
+            return;
+        }
+    }
+}
+
+// The pages are assumed to be LOCKED with frames claimed. They are unpinned after being read.
+void BufferManager::readPagesIntoFrames(
+    BMFileHandle& fileHandle, page_idx_t startPageIdx, page_idx_t numPages) {
+    try {
+        fileHandle.getFileInfo()->readFromFile((void*)getFrame(fileHandle, startPageIdx),
+            numPages * fileHandle.getPageSize(), startPageIdx * fileHandle.getPageSize());
+    } catch (std::exception& /*e*/) {
+        for (auto pageIdx = startPageIdx; pageIdx < startPageIdx + numPages; ++pageIdx) {
+            releaseFrameForPage(fileHandle, pageIdx);
+            freeUsedMemory(fileHandle.getPageSize());
+            fileHandle.getPageState(pageIdx)->resetToEvicted();
+        }
+        throw;
+    }
+    for (auto pageIdx = startPageIdx; pageIdx < startPageIdx + numPages; ++pageIdx) {
+        countPageMiss(fileHandle.getPageSize());
+        if (replacementPolicy->onPageMiss(fileHandle, pageIdx)) {
+            fileHandle.getPageState(pageIdx)->setHot();
+        }
+        unpin(fileHandle, pageIdx);
+    }
+}
+
 void BufferManager::flushIfDirtyWithoutLock(BMFileHandle& fileHandle, page_idx_t pageIdx) {
     auto pageState = fileHandle.getPageState(pageIdx);
     if (pageState->isDirty()) {
@@ -326,7 +370,8 @@ void BufferManager::flushIfDirtyWithoutLock(BMFileHandle& fileHandle, page_idx_t
 }
 
 void BufferManager::removeFilePagesFromFrames(BMFileHandle& fileHandle) {
-    evictionQueue->removeCandidatesForFile(fileHandle);
+    prefetcher->cancelPendingRequests();
+    replacementPolicy->removeCandidatesForFile(fileHandle);
     for (auto pageIdx = 0u; pageIdx < fileHandle.getNumPages(); ++pageIdx) {
         removePageFromFrame(fileHandle, pageIdx, false /* do not flush */);
     }
@@ -364,9 +409,11 @@ void BufferManager::removePageFromFrame(
     if (shouldFlush) {
         flushIfDirtyWithoutLock(fileHandle, pageIdx);
     }
+    auto wasHot = pageState->isHot();
     releaseFrameForPage(fileHandle, pageIdx);
     freeUsedMemory(fileHandle.getPageSize());
     pageState->resetToEvicted();
+    replacementPolicy->onPageEvicted(fileHandle, pageIdx, wasHot);
 }
 
 } // namespace storage
@@ -40,6 +40,7 @@ std::unique_ptr<MemoryBuffer> MemoryAllocator::allocateBuffer(bool initializeToZ
     if (initializeToZero) {
         memset(memoryBuffer->buffer, 0, pageSize);
     }
+    ThreadResourceCounters::get().memoryUsage += pageSize;
     return memoryBuffer;
 }
 
@@ -47,6 +48,7 @@ void MemoryAllocator::freeBlock(page_idx_t pageIdx) {
     std::unique_lock<std::mutex> lock(allocatorLock);
     bm->unpin(*fh, pageIdx);
     freePages.push(pageIdx);
+    ThreadResourceCounters::get().memoryUsage -= pageSize;
 }
 
 } // namespace storage
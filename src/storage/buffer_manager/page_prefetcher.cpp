@@ -0,0 +1,81 @@
+#include "storage/buffer_manager/page_prefetcher.h"
+
+#include "common/constants.h"
+#include "storage/buffer_manager/buffer_manager.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+PagePrefetcher::PagePrefetcher(BufferManager* bm, uint64_t numThreads)
+    : bm{bm}, numActiveRequests{0}, stopped{false} {
+    for (auto i = 0u; i < numThreads; ++i) {
+        workerThreads.emplace_back([this] { runWorkerThread(); });
+    }
+}
+
+PagePrefetcher::~PagePrefetcher() {
+    {
+        std::unique_lock lck{mtx};
+        stopped = true;
+        requests.clear();
+    }
+    cv.notify_all();
+    for (auto& thread : workerThreads) {
+        thread.join();
+    }
+}
+
+void PagePrefetcher::prefetch(
+    BMFileHandle& fileHandle, page_idx_t startPageIdx, page_idx_t numPages) {
+    if (numPages == 0) {
+        return;
+    }
+    {
+        std::unique_lock lck{mtx};
+        if (requests.size() >= BufferPoolConstants::MAX_NUM_PENDING_PREFETCH_REQUESTS) {
+            // The I/O threads can't keep up with the scans. Reading further ahead would only evict
+            // pages before they are used.
+            return;
+        }
+        requests.push_back(PrefetchRequest{&fileHandle, startPageIdx, numPages});
+    }
+    cv.notify_one();
+}
+
+void PagePrefetcher::cancelPendingRequests() {
+    std::unique_lock lck{mtx};
+    requests.clear();
+    idleCV.wait(lck, [&] { return numActiveRequests == 0; });
+}
+
+void PagePrefetcher::runWorkerThread() {
+    while (true) {
+        PrefetchRequest request{};
+        {
+            std::unique_lock lck{mtx};
+            cv.wait(lck, [&] { return stopped || !requests.empty(); });
+            if (stopped) {
+                return;
+            }
+            request = requests.front();
+            requests.pop_front();
+            numActiveRequests++;
+        }
+        try {
+            bm->prefetchPages(*request.fileHandle, request.startPageIdx, request.numPages);
+        } catch (std::exception& /*e*/) {
+            // Prefetching is best effort. The scan will read the page itself and surface the
+            // error if the read keeps failing.
+        }
+        {
+            std::unique_lock lck{mtx};
+            numActiveRequests--;
+        }
+        idleCV.notify_all();
+    }
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,152 @@
+#include "storage/buffer_manager/replacement_policy.h"
+
+#include "common/assert.h"
+#include "common/constants.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+// In this function, we try to remove as many as possible candidates that are not evictable from the
+// eviction queue until we hit a candidate that is evictable.
+// 1) If the candidate page's version has changed, which means the page was pinned and unpinned, we
+// remove the candidate from the queue.
+// 2) If the candidate page's state is UNLOCKED, and its page version hasn't changed, which means
+// the page was optimistically read, we give a second chance to evict the page by marking the page
+// as MARKED, and moving the candidate to the back of the queue.
+// 3) If the candidate page's state is LOCKED, we remove the candidate from the queue.
+void EvictionQueue::removeNonEvictableCandidates() {
+    std::shared_lock sLck{mtx};
+    while (true) {
+        EvictionCandidate evictionCandidate;
+        if (!queue->try_dequeue(evictionCandidate)) {
+            break;
+        }
+        auto pageStateAndVersion = evictionCandidate.pageState->getStateAndVersion();
+        if (evictionCandidate.isEvictable(pageStateAndVersion)) {
+            queue->enqueue(evictionCandidate);
+            break;
+        } else if (evictionCandidate.isSecondChanceEvictable(pageStateAndVersion)) {
+            // The page was optimistically read, mark it as MARKED, and enqueue to be evicted later.
+            evictionCandidate.pageState->tryMark(pageStateAndVersion);
+            queue->enqueue(evictionCandidate);
+            continue;
+        } else {
+            // Cases to remove the candidate from the queue:
+            // 1) The page is currently LOCKED (it is currently pinned), remove the candidate from
+            // the queue.
+            // 2) The page's version number has changed (it was pinned and unpinned), another
+            // candidate exists for this page in the queue. remove the candidate from the queue.
+            continue;
+        }
+    }
+}
+
+void EvictionQueue::removeCandidatesForFile(kuzu::storage::BMFileHandle& fileHandle) {
+    std::unique_lock xLck{mtx};
+    EvictionCandidate candidate;
+    uint64_t loopedCandidateIdx = 0;
+    auto numCandidatesInQueue = queue->size();
+    while (loopedCandidateIdx < numCandidatesInQueue && queue->try_dequeue(candidate)) {
+        if (candidate.fileHandle != &fileHandle) {
+            queue->enqueue(candidate);
+        }
+        loopedCandidateIdx++;
+    }
+}
+
+std::unique_ptr<ReplacementPolicy> ReplacementPolicy::create(
+    EvictionPolicy evictionPolicy, uint64_t bufferPoolSize) {
+    switch (evictionPolicy) {
+    case EvictionPolicy::FIFO: {
+        return std::make_unique<FIFOReplacementPolicy>();
+    }
+    case EvictionPolicy::TWO_QUEUE: {
+        return std::make_unique<TwoQueueReplacementPolicy>(bufferPoolSize);
+    }
+    default: {
+        KU_UNREACHABLE;
+    }
+    }
+}
+
+TwoQueueReplacementPolicy::TwoQueueReplacementPolicy(uint64_t bufferPoolSize)
+    : protectedMemory{0}, nextGhostSeq{0} {
+    maxProbationaryMemory =
+        (uint64_t)(bufferPoolSize * BufferPoolConstants::TWO_QUEUE_PROBATIONARY_RATIO);
+    maxNumGhostEntries = (uint64_t)((bufferPoolSize / BufferPoolConstants::PAGE_4KB_SIZE) *
+                                    BufferPoolConstants::TWO_QUEUE_GHOST_RATIO);
+}
+
+void TwoQueueReplacementPolicy::enqueue(EvictionCandidate& candidate) {
+    if (candidate.pageState->isHot()) {
+        protectedQueue.enqueue(candidate);
+    } else {
+        probationaryQueue.enqueue(candidate);
+    }
+}
+
+bool TwoQueueReplacementPolicy::dequeue(EvictionCandidate& candidate, uint64_t usedMemory) {
+    auto currProtectedMemory = protectedMemory.load();
+    auto probationaryMemory =
+        usedMemory > currProtectedMemory ? usedMemory - currProtectedMemory : 0;
+    if (probationaryMemory > maxProbationaryMemory) {
+        return probationaryQueue.dequeue(candidate) || protectedQueue.dequeue(candidate);
+    }
+    return protectedQueue.dequeue(candidate) || probationaryQueue.dequeue(candidate);
+}
+
+bool TwoQueueReplacementPolicy::onPageMiss(BMFileHandle& fileHandle, page_idx_t pageIdx) {
+    std::unique_lock lck{ghostMtx};
+    auto entry = ghostEntries.find(GhostKey{&fileHandle, pageIdx});
+    if (entry == ghostEntries.end()) {
+        return false;
+    }
+    // The page is re-referenced after being evicted from the probationary queue. Its stale entry in
+    // the ghost queue is skipped when it reaches the front.
+    ghostEntries.erase(entry);
+    protectedMemory.fetch_add(fileHandle.getPageSize());
+    return true;
+}
+
+void TwoQueueReplacementPolicy::onPageEvicted(
+    BMFileHandle& fileHandle, page_idx_t pageIdx, bool wasHot) {
+    if (wasHot) {
+        KU_ASSERT(protectedMemory.load() >= fileHandle.getPageSize());
+        protectedMemory.fetch_sub(fileHandle.getPageSize());
+        return;
+    }
+    if (fileHandle.isNewTmpFile() || maxNumGhostEntries == 0) {
+        return;
+    }
+    std::unique_lock lck{ghostMtx};
+    auto key = GhostKey{&fileHandle, pageIdx};
+    auto seq = nextGhostSeq++;
+    ghostEntries[key] = seq;
+    ghostQueue.emplace_back(key, seq);
+    while (ghostQueue.size() > maxNumGhostEntries) {
+        auto& [oldestKey, oldestSeq] = ghostQueue.front();
+        auto entry = ghostEntries.find(oldestKey);
+        if (entry != ghostEntries.end() && entry->second == oldestSeq) {
+            ghostEntries.erase(entry);
+        }
+        ghostQueue.pop_front();
+    }
+}
+
+void TwoQueueReplacementPolicy::removeNonEvictableCandidates() {
+    probationaryQueue.removeNonEvictableCandidates();
+    protectedQueue.removeNonEvictableCandidates();
+}
+
+void TwoQueueReplacementPolicy::removeCandidatesForFile(BMFileHandle& fileHandle) {
+    probationaryQueue.removeCandidatesForFile(fileHandle);
+    protectedQueue.removeCandidatesForFile(fileHandle);
+    std::unique_lock lck{ghostMtx};
+    std::erase_if(
+        ghostEntries, [&](const auto& entry) { return entry.first.fileHandle == &fileHandle; });
+}
+
+} // namespace storage
+} // namespace kuzu
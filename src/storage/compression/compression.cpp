@@ -1,7 +1,9 @@
 #include "storage/compression/compression.h"
 
+#include <cmath>
 #include <limits>
 #include <string>
+#include <vector>
 
 #include "common/exception/not_implemented.h"
 #include "common/exception/storage.h"
@@ -52,7 +54,9 @@ bool CompressionMetadata::canAlwaysUpdateInPlace() const {
         return true;
     }
     case CompressionType::CONSTANT:
-    case CompressionType::INTEGER_BITPACKING: {
+    case CompressionType::INTEGER_BITPACKING:
+    case CompressionType::INTEGER_DELTA_BITPACKING:
+    case CompressionType::ALP: {
         return false;
     }
     default: {
@@ -77,6 +81,10 @@ bool CompressionMetadata::canUpdateInPlace(
     case CompressionType::UNCOMPRESSED: {
         return true;
     }
+    case CompressionType::INTEGER_DELTA_BITPACKING:
+    case CompressionType::ALP: {
+        return false;
+    }
     case CompressionType::INTEGER_BITPACKING: {
         switch (physicalType) {
         case PhysicalTypeID::INT64: {
@@ -177,6 +185,51 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, const LogicalType& da
         }
         }
     }
+    case CompressionType::INTEGER_DELTA_BITPACKING: {
+        auto header = BitpackHeader::readHeader(data);
+        switch (dataType.getPhysicalType()) {
+        case PhysicalTypeID::INT64:
+            return IntegerDeltaBitpacking<int64_t>::numValues(pageSize, header);
+        case PhysicalTypeID::INT32:
+            return IntegerDeltaBitpacking<int32_t>::numValues(pageSize, header);
+        case PhysicalTypeID::INT16:
+            return IntegerDeltaBitpacking<int16_t>::numValues(pageSize, header);
+        case PhysicalTypeID::INT8:
+            return IntegerDeltaBitpacking<int8_t>::numValues(pageSize, header);
+        case PhysicalTypeID::INTERNAL_ID:
+        case PhysicalTypeID::LIST:
+        case PhysicalTypeID::UINT64:
+            return IntegerDeltaBitpacking<uint64_t>::numValues(pageSize, header);
+        case PhysicalTypeID::STRING:
+        case PhysicalTypeID::UINT32:
+            return IntegerDeltaBitpacking<uint32_t>::numValues(pageSize, header);
+        case PhysicalTypeID::UINT16:
+            return IntegerDeltaBitpacking<uint16_t>::numValues(pageSize, header);
+        case PhysicalTypeID::UINT8:
+            return IntegerDeltaBitpacking<uint8_t>::numValues(pageSize, header);
+        default: {
+            throw common::StorageException(
+                "Attempted to read from a column chunk which uses integer delta bitpacking but "
+                "does not have a supported integer physical type: " +
+                PhysicalTypeUtils::physicalTypeToString(dataType.getPhysicalType()));
+        }
+        }
+    }
+    case CompressionType::ALP: {
+        auto header = AlpHeader::readHeader(data);
+        switch (dataType.getPhysicalType()) {
+        case PhysicalTypeID::DOUBLE:
+            return FloatCompression<double>::numValues(pageSize, header);
+        case PhysicalTypeID::FLOAT:
+            return FloatCompression<float>::numValues(pageSize, header);
+        default: {
+            throw common::StorageException(
+                "Attempted to read from a column chunk which uses ALP compression but does not "
+                "have a floating point physical type: " +
+                PhysicalTypeUtils::physicalTypeToString(dataType.getPhysicalType()));
+        }
+        }
+    }
     case CompressionType::BOOLEAN_BITPACKING: {
         return BooleanBitpacking::numValues(pageSize);
     }
@@ -258,6 +311,15 @@ std::string CompressionMetadata::toString() const {
         auto header = BitpackHeader::readHeader(data);
         return "INTEGER_BITPACKING[" + std::to_string(header.bitWidth) + "]";
     }
+    case CompressionType::INTEGER_DELTA_BITPACKING: {
+        auto header = BitpackHeader::readHeader(data);
+        return "INTEGER_DELTA_BITPACKING[" + std::to_string(header.bitWidth) + "]";
+    }
+    case CompressionType::ALP: {
+        auto header = AlpHeader::readHeader(data);
+        return "ALP[" + std::to_string(header.exponent) + "," + std::to_string(header.factor) +
+               "," + std::to_string(header.bitWidth) + "]";
+    }
     case CompressionType::BOOLEAN_BITPACKING: {
         return "BOOLEAN_BITPACKING";
     }
@@ -552,6 +614,335 @@ template class IntegerBitpacking<uint16_t>;
 template class IntegerBitpacking<uint32_t>;
 template class IntegerBitpacking<uint64_t>;
 
+template<typename T>
+void IntegerDeltaBitpacking<T>::setValuesFromUncompressed(const uint8_t* /*srcBuffer*/,
+    offset_t /*srcOffset*/, uint8_t* /*dstBuffer*/, offset_t /*dstOffset*/,
+    offset_t /*numValues*/, const CompressionMetadata& /*metadata*/) const {
+    // Delta compressed values are never updated in place. See
+    // CompressionMetadata::canUpdateInPlace.
+    KU_UNREACHABLE;
+}
+
+template<typename T>
+BitpackHeader IntegerDeltaBitpacking<T>::getBitWidth(
+    const uint8_t* srcBuffer, uint64_t numValues) const {
+    if (numValues < 2) {
+        return BitpackHeader{1 /*bitWidth*/, false /*hasNegative*/, 0 /*offset*/};
+    }
+    auto values = reinterpret_cast<const U*>(srcBuffer);
+    S minDelta = std::numeric_limits<S>::max(), maxDelta = std::numeric_limits<S>::min();
+    for (auto i = 1u; i < numValues; i++) {
+        // Differences are computed with wrap-around, so that they never overflow.
+        auto delta = (S)(U)(values[i] - values[i - 1]);
+        minDelta = std::min(minDelta, delta);
+        maxDelta = std::max(maxDelta, delta);
+    }
+    auto bitWidth = std::max<uint64_t>(std::bit_width((U)((U)maxDelta - (U)minDelta)), 1);
+    return BitpackHeader{static_cast<uint8_t>(bitWidth), false, (uint64_t)(U)minDelta};
+}
+
+template<typename T>
+uint64_t IntegerDeltaBitpacking<T>::compressNextPage(const uint8_t*& srcBuffer,
+    uint64_t numValuesRemaining, uint8_t* dstBuffer, uint64_t dstBufferSize,
+    const struct CompressionMetadata& metadata) const {
+    if (metadata.compression == CompressionType::UNCOMPRESSED) {
+        return Uncompressed(sizeof(T)).compressNextPage(
+            srcBuffer, numValuesRemaining, dstBuffer, dstBufferSize, metadata);
+    }
+    KU_ASSERT(metadata.compression == CompressionType::INTEGER_DELTA_BITPACKING);
+    auto header = BitpackHeader::readHeader(metadata.data);
+    auto bitWidth = header.bitWidth;
+    auto minDelta = (U)header.offset;
+    auto numValuesToCompress = std::min(numValuesRemaining, numValues(dstBufferSize, header));
+    KU_ASSERT(numValuesToCompress > 0);
+    auto values = reinterpret_cast<const U*>(srcBuffer);
+    // The value preceding the first value of the page is chosen so that the difference stored for
+    // the first value is 0.
+    *reinterpret_cast<uint64_t*>(dstBuffer) = (uint64_t)(U)(values[0] - minDelta);
+    auto packedBuffer = dstBuffer + PAGE_HEADER_SIZE;
+    U chunk[CHUNK_SIZE];
+    for (uint64_t chunkStart = 0; chunkStart < numValuesToCompress; chunkStart += CHUNK_SIZE) {
+        auto numValuesInChunk = std::min(CHUNK_SIZE, numValuesToCompress - chunkStart);
+        for (auto i = 0u; i < numValuesInChunk; i++) {
+            auto pos = chunkStart + i;
+            chunk[i] = pos == 0 ? 0 : (U)(values[pos] - values[pos - 1] - minDelta);
+        }
+        std::fill(chunk + numValuesInChunk, chunk + CHUNK_SIZE, 0);
+        fastpack(chunk, packedBuffer + chunkStart * bitWidth / 8, bitWidth);
+    }
+    srcBuffer += numValuesToCompress * sizeof(U);
+    // Round up to nearest byte
+    return PAGE_HEADER_SIZE + numValuesToCompress * bitWidth / 8 +
+           (numValuesToCompress * bitWidth % 8 != 0);
+}
+
+template<typename T>
+void IntegerDeltaBitpacking<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) const {
+    auto header = BitpackHeader::readHeader(metadata.data);
+    auto bitWidth = header.bitWidth;
+    auto minDelta = (U)header.offset;
+    auto value = (U)*reinterpret_cast<const uint64_t*>(srcBuffer);
+    auto packedBuffer = srcBuffer + PAGE_HEADER_SIZE;
+    auto dst = reinterpret_cast<U*>(dstBuffer) + dstOffset;
+    U chunk[CHUNK_SIZE];
+    // Chunks before the one containing srcOffset only need to be summed up.
+    auto firstChunkStart = srcOffset - srcOffset % CHUNK_SIZE;
+    for (uint64_t chunkStart = 0; chunkStart < firstChunkStart; chunkStart += CHUNK_SIZE) {
+        fastunpack(packedBuffer + chunkStart * bitWidth / 8, chunk, bitWidth);
+        U sum = 0;
+        for (auto i = 0u; i < CHUNK_SIZE; i++) {
+            sum += chunk[i];
+        }
+        value += (U)(sum + minDelta * CHUNK_SIZE);
+    }
+    auto endOffset = srcOffset + numValues;
+    for (auto chunkStart = firstChunkStart; chunkStart < endOffset; chunkStart += CHUNK_SIZE) {
+        fastunpack(packedBuffer + chunkStart * bitWidth / 8, chunk, bitWidth);
+        auto chunkEnd = std::min(chunkStart + CHUNK_SIZE, endOffset);
+        for (auto pos = chunkStart; pos < chunkEnd; pos++) {
+            value += (U)(chunk[pos - chunkStart] + minDelta);
+            if (pos >= srcOffset) {
+                dst[pos - srcOffset] = value;
+            }
+        }
+    }
+}
+
+template class IntegerDeltaBitpacking<int8_t>;
+template class IntegerDeltaBitpacking<int16_t>;
+template class IntegerDeltaBitpacking<int32_t>;
+template class IntegerDeltaBitpacking<int64_t>;
+template class IntegerDeltaBitpacking<uint8_t>;
+template class IntegerDeltaBitpacking<uint16_t>;
+template class IntegerDeltaBitpacking<uint32_t>;
+template class IntegerDeltaBitpacking<uint64_t>;
+
+std::array<uint8_t, CompressionMetadata::DATA_SIZE> AlpHeader::getData() const {
+    std::array<uint8_t, CompressionMetadata::DATA_SIZE> data = {exponent, factor, bitWidth};
+    *(uint16_t*)&data[3] = maxNumExceptions;
+    return data;
+}
+
+AlpHeader AlpHeader::readHeader(const std::array<uint8_t, CompressionMetadata::DATA_SIZE>& data) {
+    AlpHeader header;
+    header.exponent = data[0];
+    header.factor = data[1];
+    header.bitWidth = data[2];
+    header.maxNumExceptions = *(uint16_t*)&data[3];
+    return header;
+}
+
+template<typename T>
+void FloatCompression<T>::setValuesFromUncompressed(const uint8_t* /*srcBuffer*/,
+    offset_t /*srcOffset*/, uint8_t* /*dstBuffer*/, offset_t /*dstOffset*/,
+    offset_t /*numValues*/, const CompressionMetadata& /*metadata*/) const {
+    // ALP compressed values are never updated in place. See
+    // CompressionMetadata::canUpdateInPlace.
+    KU_UNREACHABLE;
+}
+
+template<typename T>
+bool FloatCompression<T>::encode(T value, uint8_t exponent, uint8_t factor, int64_t& encoded) {
+    // Encoded values must be exactly representable as T.
+    constexpr T encodingLimit = std::is_same_v<T, double> ? (T)(1ull << 52) : (T)(1ull << 22);
+    T scaled = value * POW10[exponent] * NEG_POW10[factor];
+    // Also false for NaN.
+    if (!(std::abs(scaled) < encodingLimit)) {
+        return false;
+    }
+    encoded = static_cast<int64_t>(std::round(scaled));
+    auto decoded = decode(encoded, exponent, factor);
+    // Compare the bits, so that -0.0 is not encoded as 0.0.
+    return std::memcmp(&decoded, &value, sizeof(T)) == 0;
+}
+
+template<typename T>
+std::pair<uint8_t, uint8_t> FloatCompression<T>::findExponentAndFactor(
+    const T* values, uint64_t numValues) {
+    static constexpr uint64_t MAX_NUM_SAMPLES = 256;
+    auto sampleStride = std::max<uint64_t>(numValues / MAX_NUM_SAMPLES, 1);
+    std::pair<uint8_t, uint8_t> best{0, 0};
+    auto bestSize = UINT64_MAX;
+    for (uint8_t exponent = 0; exponent <= MAX_EXPONENT; exponent++) {
+        for (uint8_t factor = 0; factor <= exponent; factor++) {
+            uint64_t numExceptions = 0, numEncoded = 0;
+            int64_t min = INT64_MAX, max = INT64_MIN;
+            for (auto i = 0u; i < numValues; i += sampleStride) {
+                int64_t encoded;
+                if (encode(values[i], exponent, factor, encoded)) {
+                    min = std::min(min, encoded);
+                    max = std::max(max, encoded);
+                    numEncoded++;
+                } else {
+                    numExceptions++;
+                }
+            }
+            uint64_t bitWidth =
+                numEncoded == 0 ? 0 : std::bit_width((uint64_t)max - (uint64_t)min);
+            auto size = numEncoded * bitWidth +
+                        numExceptions * (sizeof(uint16_t) + sizeof(T)) * 8 /*bits per byte*/;
+            if (size < bestSize) {
+                bestSize = size;
+                best = {exponent, factor};
+            }
+        }
+    }
+    return best;
+}
+
+template<typename T>
+CompressionMetadata FloatCompression<T>::getCompressionMetadata(
+    const uint8_t* srcBuffer, uint64_t numValues) const {
+    if (numValues == 0) {
+        return CompressionMetadata();
+    }
+    auto values = reinterpret_cast<const T*>(srcBuffer);
+    auto [exponent, factor] = findExponentAndFactor(values, numValues);
+    std::vector<uint64_t> exceptionPositions;
+    int64_t min = INT64_MAX, max = INT64_MIN;
+    for (auto i = 0u; i < numValues; i++) {
+        int64_t encoded;
+        if (encode(values[i], exponent, factor, encoded)) {
+            min = std::min(min, encoded);
+            max = std::max(max, encoded);
+        } else {
+            exceptionPositions.push_back(i);
+        }
+    }
+    if (exceptionPositions.size() == numValues) {
+        return CompressionMetadata();
+    }
+    auto bitWidth = std::max<uint64_t>(std::bit_width((uint64_t)max - (uint64_t)min), 1);
+    if (bitWidth >= sizeof(T) * 8) {
+        return CompressionMetadata();
+    }
+    AlpHeader header{exponent, factor, static_cast<uint8_t>(bitWidth), 0 /*maxNumExceptions*/};
+    // Reserving space for exceptions reduces the number of values per page, which can move more
+    // exceptions into a page. Since the number of exceptions reserved only grows, this converges.
+    while (true) {
+        auto numValuesPerPage = this->numValues(BufferPoolConstants::PAGE_4KB_SIZE, header);
+        if (numValuesPerPage == 0) {
+            return CompressionMetadata();
+        }
+        uint64_t maxNumExceptions = 0, numExceptionsInPage = 0;
+        uint64_t currentPage = UINT64_MAX;
+        for (auto pos : exceptionPositions) {
+            if (pos / numValuesPerPage != currentPage) {
+                currentPage = pos / numValuesPerPage;
+                numExceptionsInPage = 0;
+            }
+            maxNumExceptions = std::max(maxNumExceptions, ++numExceptionsInPage);
+        }
+        if (maxNumExceptions <= header.maxNumExceptions) {
+            break;
+        }
+        if (maxNumExceptions > UINT16_MAX) {
+            return CompressionMetadata();
+        }
+        header.maxNumExceptions = maxNumExceptions;
+    }
+    // Use uncompressed if the pages can't hold more values than uncompressed pages.
+    if (this->numValues(BufferPoolConstants::PAGE_4KB_SIZE, header) <=
+        BufferPoolConstants::PAGE_4KB_SIZE / sizeof(T)) {
+        return CompressionMetadata();
+    }
+    return CompressionMetadata(CompressionType::ALP, header.getData());
+}
+
+template<typename T>
+uint64_t FloatCompression<T>::compressNextPage(const uint8_t*& srcBuffer,
+    uint64_t numValuesRemaining, uint8_t* dstBuffer, uint64_t dstBufferSize,
+    const struct CompressionMetadata& metadata) const {
+    if (metadata.compression == CompressionType::UNCOMPRESSED) {
+        return Uncompressed(sizeof(T)).compressNextPage(
+            srcBuffer, numValuesRemaining, dstBuffer, dstBufferSize, metadata);
+    }
+    KU_ASSERT(metadata.compression == CompressionType::ALP);
+    auto header = AlpHeader::readHeader(metadata.data);
+    auto numValuesToCompress = std::min(numValuesRemaining, numValues(dstBufferSize, header));
+    KU_ASSERT(numValuesToCompress > 0);
+    auto values = reinterpret_cast<const T*>(srcBuffer);
+    auto exceptionPositions = reinterpret_cast<uint16_t*>(dstBuffer + PAGE_HEADER_SIZE);
+    auto exceptionValues =
+        dstBuffer + PAGE_HEADER_SIZE + header.maxNumExceptions * sizeof(uint16_t);
+    memset(dstBuffer + PAGE_HEADER_SIZE, 0, getExceptionsSize(header));
+    std::vector<int64_t> encoded(numValuesToCompress);
+    uint64_t numExceptions = 0;
+    int64_t frameOfReference = INT64_MAX;
+    for (auto i = 0u; i < numValuesToCompress; i++) {
+        if (encode(values[i], header.exponent, header.factor, encoded[i])) {
+            frameOfReference = std::min(frameOfReference, encoded[i]);
+        } else {
+            KU_ASSERT(numExceptions < header.maxNumExceptions);
+            exceptionPositions[numExceptions] = i;
+            memcpy(exceptionValues + numExceptions * sizeof(T), &values[i], sizeof(T));
+            numExceptions++;
+        }
+    }
+    if (numExceptions == numValuesToCompress) {
+        frameOfReference = 0;
+    }
+    // Exceptions are stored as the frame of reference and patched when decompressing.
+    for (auto i = 0u; i < numExceptions; i++) {
+        encoded[exceptionPositions[i]] = frameOfReference;
+    }
+    *reinterpret_cast<int64_t*>(dstBuffer) = frameOfReference;
+    *reinterpret_cast<uint64_t*>(dstBuffer + sizeof(int64_t)) = numExceptions;
+    auto packedBuffer = dstBuffer + PAGE_HEADER_SIZE + getExceptionsSize(header);
+    uint64_t chunk[CHUNK_SIZE];
+    for (uint64_t chunkStart = 0; chunkStart < numValuesToCompress; chunkStart += CHUNK_SIZE) {
+        auto numValuesInChunk = std::min(CHUNK_SIZE, numValuesToCompress - chunkStart);
+        for (auto i = 0u; i < numValuesInChunk; i++) {
+            chunk[i] = (uint64_t)encoded[chunkStart + i] - (uint64_t)frameOfReference;
+        }
+        std::fill(chunk + numValuesInChunk, chunk + CHUNK_SIZE, 0);
+        fastpack(chunk, packedBuffer + chunkStart * header.bitWidth / 8, header.bitWidth);
+    }
+    srcBuffer += numValuesToCompress * sizeof(T);
+    // Round up to nearest byte
+    return PAGE_HEADER_SIZE + getExceptionsSize(header) +
+           numValuesToCompress * header.bitWidth / 8 +
+           (numValuesToCompress * header.bitWidth % 8 != 0);
+}
+
+template<typename T>
+void FloatCompression<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) const {
+    auto header = AlpHeader::readHeader(metadata.data);
+    auto frameOfReference = (uint64_t)*reinterpret_cast<const int64_t*>(srcBuffer);
+    auto numExceptions = *reinterpret_cast<const uint64_t*>(srcBuffer + sizeof(int64_t));
+    auto packedBuffer = srcBuffer + PAGE_HEADER_SIZE + getExceptionsSize(header);
+    auto dst = reinterpret_cast<T*>(dstBuffer) + dstOffset;
+    auto endOffset = srcOffset + numValues;
+    uint64_t chunk[CHUNK_SIZE];
+    for (auto chunkStart = srcOffset - srcOffset % CHUNK_SIZE; chunkStart < endOffset;
+         chunkStart += CHUNK_SIZE) {
+        fastunpack(packedBuffer + chunkStart * header.bitWidth / 8, chunk, header.bitWidth);
+        auto start = std::max(chunkStart, srcOffset);
+        auto end = std::min(chunkStart + CHUNK_SIZE, endOffset);
+        for (auto pos = start; pos < end; pos++) {
+            dst[pos - srcOffset] = decode(
+                (int64_t)(chunk[pos - chunkStart] + frameOfReference), header.exponent,
+                header.factor);
+        }
+    }
+    auto exceptionPositions = reinterpret_cast<const uint16_t*>(srcBuffer + PAGE_HEADER_SIZE);
+    auto exceptionValues =
+        srcBuffer + PAGE_HEADER_SIZE + header.maxNumExceptions * sizeof(uint16_t);
+    for (auto i = 0u; i < numExceptions; i++) {
+        auto pos = exceptionPositions[i];
+        if (pos >= srcOffset && pos < endOffset) {
+            memcpy(&dst[pos - srcOffset], exceptionValues + i * sizeof(T), sizeof(T));
+        }
+    }
+}
+
+template class FloatCompression<double>;
+template class FloatCompression<float>;
+
 void BooleanBitpacking::setValuesFromUncompressed(const uint8_t* srcBuffer, offset_t srcOffset,
     uint8_t* dstBuffer, offset_t dstOffset, offset_t numValues,
     const CompressionMetadata& /*metadata*/) const {
@@ -607,6 +998,71 @@ BitpackHeader BitpackHeader::readHeader(
     return header;
 }
 
+static void decompressDeltaFromPage(PhysicalTypeID physicalType, const uint8_t* frame,
+    uint64_t srcOffset, uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) {
+    switch (physicalType) {
+    case PhysicalTypeID::INT64: {
+        return IntegerDeltaBitpacking<int64_t>().decompressFromPage(
+            frame, srcOffset, dstBuffer, dstOffset, numValues, metadata);
+    }
+    case PhysicalTypeID::INT32: {
+        return IntegerDeltaBitpacking<int32_t>().decompressFromPage(
+            frame, srcOffset, dstBuffer, dstOffset, numValues, metadata);
+    }
+    case PhysicalTypeID::INT16: {
+        return IntegerDeltaBitpacking<int16_t>().decompressFromPage(
+            frame, srcOffset, dstBuffer, dstOffset, numValues, metadata);
+    }
+    case PhysicalTypeID::INT8: {
+        return IntegerDeltaBitpacking<int8_t>().decompressFromPage(
+            frame, srcOffset, dstBuffer, dstOffset, numValues, metadata);
+    }
+    case PhysicalTypeID::INTERNAL_ID:
+    case PhysicalTypeID::LIST:
+    case PhysicalTypeID::UINT64: {
+        return IntegerDeltaBitpacking<uint64_t>().decompressFromPage(
+            frame, srcOffset, dstBuffer, dstOffset, numValues, metadata);
+    }
+    case PhysicalTypeID::STRING:
+    case PhysicalTypeID::UINT32: {
+        return IntegerDeltaBitpacking<uint32_t>().decompressFromPage(
+            frame, srcOffset, dstBuffer, dstOffset, numValues, metadata);
+    }
+    case PhysicalTypeID::UINT16: {
+        return IntegerDeltaBitpacking<uint16_t>().decompressFromPage(
+            frame, srcOffset, dstBuffer, dstOffset, numValues, metadata);
+    }
+    case PhysicalTypeID::UINT8: {
+        return IntegerDeltaBitpacking<uint8_t>().decompressFromPage(
+            frame, srcOffset, dstBuffer, dstOffset, numValues, metadata);
+    }
+    default: {
+        throw NotImplementedException("INTEGER_DELTA_BITPACKING is not implemented for type " +
+                                      PhysicalTypeUtils::physicalTypeToString(physicalType));
+    }
+    }
+}
+
+static void decompressFloatFromPage(PhysicalTypeID physicalType, const uint8_t* frame,
+    uint64_t srcOffset, uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) {
+    switch (physicalType) {
+    case PhysicalTypeID::DOUBLE: {
+        return FloatCompression<double>().decompressFromPage(
+            frame, srcOffset, dstBuffer, dstOffset, numValues, metadata);
+    }
+    case PhysicalTypeID::FLOAT: {
+        return FloatCompression<float>().decompressFromPage(
+            frame, srcOffset, dstBuffer, dstOffset, numValues, metadata);
+    }
+    default: {
+        throw NotImplementedException("ALP is not implemented for type " +
+                                      PhysicalTypeUtils::physicalTypeToString(physicalType));
+    }
+    }
+}
+
 void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame, PageCursor& pageCursor,
     common::ValueVector* resultVector, uint32_t posInVector, uint32_t numValuesToRead,
     const CompressionMetadata& metadata) {
@@ -660,6 +1116,12 @@ void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame, Page
         }
         }
     }
+    case CompressionType::INTEGER_DELTA_BITPACKING:
+        return decompressDeltaFromPage(physicalType, frame, pageCursor.elemPosInPage,
+            resultVector->getData(), posInVector, numValuesToRead, metadata);
+    case CompressionType::ALP:
+        return decompressFloatFromPage(physicalType, frame, pageCursor.elemPosInPage,
+            resultVector->getData(), posInVector, numValuesToRead, metadata);
     case CompressionType::BOOLEAN_BITPACKING:
         return booleanBitpacking.decompressFromPage(frame, pageCursor.elemPosInPage,
             resultVector->getData(), posInVector, numValuesToRead, metadata);
@@ -721,6 +1183,12 @@ void ReadCompressedValuesFromPage::operator()(const uint8_t* frame, PageCursor&
         }
         }
     }
+    case CompressionType::INTEGER_DELTA_BITPACKING:
+        return decompressDeltaFromPage(physicalType, frame, pageCursor.elemPosInPage, result,
+            startPosInResult, numValuesToRead, metadata);
+    case CompressionType::ALP:
+        return decompressFloatFromPage(physicalType, frame, pageCursor.elemPosInPage, result,
+            startPosInResult, numValuesToRead, metadata);
     case CompressionType::BOOLEAN_BITPACKING:
         // Reading into ColumnChunks should be done without decompressing for booleans
         return booleanBitpacking.copyFromPage(
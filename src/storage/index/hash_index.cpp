@@ -173,10 +173,45 @@ bool HashIndex<T>::insertInternal(Key key, offset_t value) {
 }
 
 template<typename T>
-bool HashIndex<T>::lookupInPersistentIndex(TransactionType trxType, Key key, offset_t& result) {
+void HashIndex<T>::lookupBatchInternal(Transaction* transaction, const Key* keys,
+    const hash_t* hashes, uint64_t numKeys, offset_t* results, bool* found) {
+    auto trxType = transaction->getType();
+    auto& header = trxType == TransactionType::READ_ONLY ? *this->indexHeaderForReadTrx :
+                                                           *this->indexHeaderForWriteTrx;
+    // Pairs of primary slot id and key idx.
+    std::vector<std::pair<slot_id_t, uint64_t>> probes;
+    probes.reserve(numKeys);
+    for (auto i = 0u; i < numKeys; i++) {
+        if (!transaction->isReadOnly()) {
+            auto localLookupState = localStorage->lookup(keys[i], results[i]);
+            if (localLookupState != HashIndexLocalLookupState::KEY_NOT_EXIST) {
+                found[i] = localLookupState == HashIndexLocalLookupState::KEY_FOUND;
+                continue;
+            }
+        }
+        probes.emplace_back(HashIndexUtils::getPrimarySlotIdForHash(header, hashes[i]), i);
+    }
+    if (probes.empty()) {
+        return;
+    }
+    std::sort(probes.begin(), probes.end());
+    std::vector<uint64_t> slotIds;
+    slotIds.reserve(probes.size());
+    for (auto& [slotId, _] : probes) {
+        slotIds.push_back(slotId);
+    }
+    pSlots->prefetch(slotIds);
+    for (auto& [_, keyIdx] : probes) {
+        found[keyIdx] =
+            lookupInPersistentIndex(trxType, keys[keyIdx], hashes[keyIdx], results[keyIdx]);
+    }
+}
+
+template<typename T>
+bool HashIndex<T>::lookupInPersistentIndex(
+    TransactionType trxType, Key key, hash_t hashValue, offset_t& result) {
     auto& header = trxType == TransactionType::READ_ONLY ? *this->indexHeaderForReadTrx :
                                                            *this->indexHeaderForWriteTrx;
-    auto hashValue = HashIndexUtils::hash(key);
     auto fingerprint = HashIndexUtils::getFingerprintForHash(hashValue);
     auto iter =
         getSlotIterator(HashIndexUtils::getPrimarySlotIdForHash(header, hashValue), trxType);
@@ -425,6 +460,82 @@ bool PrimaryKeyIndex::lookup(Transaction* trx, common::ValueVector* keyVector, u
     return retVal;
 }
 
+uint64_t PrimaryKeyIndex::batchLookup(
+    Transaction* trx, const ValueVector& keyVector, offset_t* offsets) {
+    uint64_t firstMissingKeyPos = 0;
+    TypeUtils::visit(
+        keyDataTypeID,
+        [&]<IndexHashable T>(T) {
+            firstMissingKeyPos = batchLookupInternal<HashIndexType<T>>(trx, keyVector, offsets);
+        },
+        [](auto) { KU_UNREACHABLE; });
+    return firstMissingKeyPos;
+}
+
+template<typename T>
+uint64_t PrimaryKeyIndex::batchLookupInternal(
+    Transaction* trx, const ValueVector& keyVector, offset_t* offsets) {
+    using Key = typename HashIndex<T>::Key;
+    auto& selVector = *keyVector.state->selVector;
+    auto numKeys = selVector.selectedSize;
+    std::vector<Key> keys(numKeys);
+    for (auto i = 0u; i < numKeys; i++) {
+        if constexpr (std::same_as<T, ku_string_t>) {
+            keys[i] = keyVector.getValue<ku_string_t>(selVector.selectedPositions[i])
+                          .getAsStringView();
+        } else {
+            keys[i] = keyVector.getValue<T>(selVector.selectedPositions[i]);
+        }
+    }
+    // Hash all keys in a tight loop before probing, and group them by the hash index they belong
+    // to with a counting sort. Each hash index is then probed once for all of its keys.
+    std::vector<hash_t> hashes(numKeys);
+    for (auto i = 0u; i < numKeys; i++) {
+        hashes[i] = HashIndexUtils::hash(keys[i]);
+    }
+    std::vector<uint64_t> groupOffsets(NUM_HASH_INDEXES + 1, 0);
+    for (auto i = 0u; i < numKeys; i++) {
+        groupOffsets[HashIndexUtils::getHashIndexPositionForHash(hashes[i]) + 1]++;
+    }
+    for (auto i = 1u; i <= NUM_HASH_INDEXES; i++) {
+        groupOffsets[i] += groupOffsets[i - 1];
+    }
+    std::vector<uint64_t> keyIdxs(numKeys);
+    std::vector<Key> groupedKeys(numKeys);
+    std::vector<hash_t> groupedHashes(numKeys);
+    auto nextPosInGroups = groupOffsets;
+    for (auto i = 0u; i < numKeys; i++) {
+        auto pos = nextPosInGroups[HashIndexUtils::getHashIndexPositionForHash(hashes[i])]++;
+        keyIdxs[pos] = i;
+        groupedKeys[pos] = keys[i];
+        groupedHashes[pos] = hashes[i];
+    }
+    std::vector<offset_t> groupedResults(numKeys);
+    auto found = std::make_unique<bool[]>(numKeys);
+    for (auto indexPos = 0u; indexPos < NUM_HASH_INDEXES; indexPos++) {
+        auto start = groupOffsets[indexPos];
+        auto numKeysInGroup = groupOffsets[indexPos + 1] - start;
+        if (numKeysInGroup == 0) {
+            continue;
+        }
+        auto hashIndex =
+            ku_dynamic_cast<OnDiskHashIndex*, HashIndex<T>*>(hashIndices[indexPos].get());
+        hashIndex->lookupBatchInternal(trx, groupedKeys.data() + start,
+            groupedHashes.data() + start, numKeysInGroup, groupedResults.data() + start,
+            found.get() + start);
+    }
+    uint64_t firstMissingKeyPos = numKeys;
+    for (auto pos = 0u; pos < numKeys; pos++) {
+        auto keyIdx = keyIdxs[pos];
+        if (!found[pos]) {
+            firstMissingKeyPos = std::min(firstMissingKeyPos, keyIdx);
+            continue;
+        }
+        offsets[keyIdx] = groupedResults[pos];
+    }
+    return firstMissingKeyPos;
+}
+
 bool PrimaryKeyIndex::insert(
     common::ValueVector* keyVector, uint64_t vectorPos, common::offset_t value) {
     bool result = false;
@@ -0,0 +1,106 @@
+#include "storage/stats/histogram.h"
+
+#include <algorithm>
+
+#include "common/assert.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+Histogram Histogram::build(std::vector<double> sample, uint64_t numValues) {
+    Histogram result;
+    if (sample.empty() || numValues == 0) {
+        return result;
+    }
+    std::sort(sample.begin(), sample.end());
+    auto numBuckets = std::min<uint64_t>(MAX_NUM_BUCKETS, sample.size());
+    result.numValues = numValues;
+    result.bounds.reserve(numBuckets + 1);
+    for (auto i = 0u; i <= numBuckets; i++) {
+        result.bounds.push_back(sample[i * (sample.size() - 1) / numBuckets]);
+    }
+    return result;
+}
+
+double Histogram::estimateFractionLessOrEqual(double value) const {
+    KU_ASSERT(!isEmpty());
+    if (value < bounds.front()) {
+        return 0;
+    }
+    if (value >= bounds.back()) {
+        return 1;
+    }
+    // The last bound that is <= value. Its next bound is > value, so the bucket is not empty.
+    auto bucketIdx = std::upper_bound(bounds.begin(), bounds.end(), value) - bounds.begin() - 1;
+    auto lower = bounds[bucketIdx];
+    auto upper = bounds[bucketIdx + 1];
+    auto fractionInBucket = (value - lower) / (upper - lower);
+    return (bucketIdx + fractionInBucket) / getNumBuckets();
+}
+
+void Histogram::merge(const Histogram& other) {
+    if (other.isEmpty()) {
+        return;
+    }
+    if (isEmpty()) {
+        *this = other;
+        return;
+    }
+    // Both cumulative distributions are linear between two consecutive bounds of either histogram,
+    // so the merged distribution can be inverted exactly at the new quantiles.
+    std::vector<double> points;
+    points.reserve(bounds.size() + other.bounds.size());
+    points.insert(points.end(), bounds.begin(), bounds.end());
+    points.insert(points.end(), other.bounds.begin(), other.bounds.end());
+    std::sort(points.begin(), points.end());
+    points.erase(std::unique(points.begin(), points.end()), points.end());
+    auto totalNumValues = numValues + other.numValues;
+    std::vector<double> cdf;
+    cdf.reserve(points.size());
+    for (auto point : points) {
+        cdf.push_back((estimateFractionLessOrEqual(point) * numValues +
+                          other.estimateFractionLessOrEqual(point) * other.numValues) /
+                      totalNumValues);
+    }
+    auto numBuckets = std::min<uint64_t>(MAX_NUM_BUCKETS, points.size());
+    std::vector<double> newBounds;
+    newBounds.reserve(numBuckets + 1);
+    newBounds.push_back(points.front());
+    auto pointIdx = 0u;
+    for (auto i = 1u; i < numBuckets; i++) {
+        auto quantile = (double)i / numBuckets;
+        while (cdf[pointIdx] < quantile) {
+            pointIdx++;
+        }
+        if (pointIdx == 0) {
+            newBounds.push_back(points[0]);
+            continue;
+        }
+        auto prevCDF = cdf[pointIdx - 1];
+        auto ratio = (quantile - prevCDF) / (cdf[pointIdx] - prevCDF);
+        newBounds.push_back(
+            points[pointIdx - 1] + ratio * (points[pointIdx] - points[pointIdx - 1]));
+    }
+    newBounds.push_back(points.back());
+    numValues = totalNumValues;
+    bounds = std::move(newBounds);
+}
+
+void Histogram::serialize(Serializer& serializer) const {
+    serializer.serializeValue(numValues);
+    serializer.serializeVector(bounds);
+}
+
+Histogram Histogram::deserialize(Deserializer& deserializer) {
+    Histogram result;
+    deserializer.deserializeValue(result.numValues);
+    deserializer.deserializeVector(result.bounds);
+    return result;
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,58 @@
+#include "storage/stats/hyper_log_log.h"
+
+#include <bit>
+#include <cmath>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+void HyperLogLog::insertHash(hash_t hash) {
+    // The first bits of the hash select the register, and the remaining bits give the rank of the
+    // first set bit.
+    auto registerIdx = hash >> (64 - NUM_REGISTERS_LOG2);
+    auto remainingBits = hash << NUM_REGISTERS_LOG2;
+    auto rank = remainingBits == 0 ? (uint8_t)(64 - NUM_REGISTERS_LOG2 + 1) :
+                                     (uint8_t)(std::countl_zero(remainingBits) + 1);
+    registers[registerIdx] = std::max(registers[registerIdx], rank);
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+    for (auto i = 0u; i < NUM_REGISTERS; i++) {
+        registers[i] = std::max(registers[i], other.registers[i]);
+    }
+}
+
+uint64_t HyperLogLog::estimate() const {
+    constexpr double numRegisters = NUM_REGISTERS;
+    constexpr double alpha = 0.7213 / (1 + 1.079 / numRegisters);
+    double sum = 0;
+    auto numZeroRegisters = 0u;
+    for (auto reg : registers) {
+        sum += std::ldexp(1.0, -reg);
+        numZeroRegisters += reg == 0;
+    }
+    auto estimate = alpha * numRegisters * numRegisters / sum;
+    if (estimate <= 2.5 * numRegisters && numZeroRegisters > 0) {
+        // Small range correction with linear counting.
+        estimate = numRegisters * std::log(numRegisters / numZeroRegisters);
+    }
+    return (uint64_t)std::llround(estimate);
+}
+
+void HyperLogLog::serialize(Serializer& serializer) const {
+    serializer.serializeValue(registers);
+}
+
+HyperLogLog HyperLogLog::deserialize(Deserializer& deserializer) {
+    HyperLogLog result;
+    deserializer.deserializeValue(result.registers);
+    return result;
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -1,14 +1,121 @@
 #include "storage/stats/property_statistics.h"
 
+#include <cmath>
+
 #include "common/serializer/deserializer.h"
 #include "common/serializer/serializer.h"
+#include "function/hash/hash_functions.h"
 #include "storage/stats/table_statistics_collection.h"
+#include "storage/store/string_column_chunk.h"
 
 namespace kuzu {
 namespace storage {
 
+// Histograms are built from an evenly spaced sample of each chunk, which keeps the cost of a flush
+// linear in the number of values.
+static constexpr uint64_t MAX_HISTOGRAM_SAMPLE_SIZE = 4096;
+
+template<typename T>
+static void collectNumericStatistics(ColumnChunk& chunk, const NullColumnChunk* nullChunk,
+    HyperLogLog& distinctValues, Histogram& histogram) {
+    auto values = (T*)chunk.getData();
+    auto numValues = chunk.getNumValues();
+    auto sampleStride = std::max<uint64_t>(1, numValues / MAX_HISTOGRAM_SAMPLE_SIZE);
+    std::vector<double> sample;
+    uint64_t numNonNullValues = 0;
+    for (auto i = 0u; i < numValues; i++) {
+        if (nullChunk && nullChunk->isNull(i)) {
+            continue;
+        }
+        numNonNullValues++;
+        common::hash_t hash;
+        function::Hash::operation<T>(values[i], hash);
+        distinctValues.insertHash(hash);
+        if (i % sampleStride != 0) {
+            continue;
+        }
+        if constexpr (std::is_floating_point_v<T>) {
+            if (std::isnan(values[i])) {
+                continue;
+            }
+        }
+        sample.push_back((double)values[i]);
+    }
+    histogram.merge(Histogram::build(std::move(sample), numNonNullValues));
+}
+
+static void collectStringStatistics(
+    ColumnChunk& chunk, const NullColumnChunk* nullChunk, HyperLogLog& distinctValues) {
+    auto stringChunk = common::ku_dynamic_cast<ColumnChunk*, StringColumnChunk*>(&chunk);
+    for (auto i = 0u; i < chunk.getNumValues(); i++) {
+        if (nullChunk && nullChunk->isNull(i)) {
+            continue;
+        }
+        common::hash_t hash;
+        function::Hash::operation(stringChunk->getValue<std::string_view>(i), hash);
+        distinctValues.insertHash(hash);
+    }
+}
+
+void PropertyStatistics::update(ColumnChunk& chunk) {
+    auto& dataType = chunk.getDataType();
+    if (dataType.getLogicalTypeID() == common::LogicalTypeID::SERIAL) {
+        return;
+    }
+    const NullColumnChunk* nullChunk = chunk.getNullChunk();
+    if (nullChunk && !nullChunk->mayHaveNull()) {
+        nullChunk = nullptr;
+    }
+    switch (dataType.getPhysicalType()) {
+    case common::PhysicalTypeID::INT64: {
+        collectNumericStatistics<int64_t>(chunk, nullChunk, distinctValues, histogram);
+    } break;
+    case common::PhysicalTypeID::INT32: {
+        collectNumericStatistics<int32_t>(chunk, nullChunk, distinctValues, histogram);
+    } break;
+    case common::PhysicalTypeID::INT16: {
+        collectNumericStatistics<int16_t>(chunk, nullChunk, distinctValues, histogram);
+    } break;
+    case common::PhysicalTypeID::INT8: {
+        collectNumericStatistics<int8_t>(chunk, nullChunk, distinctValues, histogram);
+    } break;
+    case common::PhysicalTypeID::UINT64: {
+        collectNumericStatistics<uint64_t>(chunk, nullChunk, distinctValues, histogram);
+    } break;
+    case common::PhysicalTypeID::UINT32: {
+        collectNumericStatistics<uint32_t>(chunk, nullChunk, distinctValues, histogram);
+    } break;
+    case common::PhysicalTypeID::UINT16: {
+        collectNumericStatistics<uint16_t>(chunk, nullChunk, distinctValues, histogram);
+    } break;
+    case common::PhysicalTypeID::UINT8: {
+        collectNumericStatistics<uint8_t>(chunk, nullChunk, distinctValues, histogram);
+    } break;
+    case common::PhysicalTypeID::DOUBLE: {
+        collectNumericStatistics<double>(chunk, nullChunk, distinctValues, histogram);
+    } break;
+    case common::PhysicalTypeID::FLOAT: {
+        collectNumericStatistics<float>(chunk, nullChunk, distinctValues, histogram);
+    } break;
+    case common::PhysicalTypeID::STRING: {
+        collectStringStatistics(chunk, nullChunk, distinctValues);
+    } break;
+    default: {
+        // Nested types and bools are not tracked.
+    }
+    }
+}
+
+void PropertyStatistics::merge(const PropertyStatistics& other) {
+    mayHaveNullValue |= other.mayHaveNullValue;
+    distinctValues.merge(other.distinctValues);
+    histogram.merge(other.histogram);
+}
+
 void PropertyStatistics::serialize(common::Serializer& serializer) const {
     serializer.serializeValue(mayHaveNullValue);
+    distinctValues.serialize(serializer);
+    histogram.serialize(serializer);
 }
 
 RWPropertyStats::RWPropertyStats(TablesStatistics* tablesStatistics, common::table_id_t tableID,
@@ -19,7 +126,10 @@ std::unique_ptr<PropertyStatistics> PropertyStatistics::deserialize(
     common::Deserializer& deserializer) {
     bool hasNull;
     deserializer.deserializeValue<bool>(hasNull);
-    return std::make_unique<PropertyStatistics>(hasNull);
+    auto result = std::make_unique<PropertyStatistics>(hasNull);
+    result->distinctValues = HyperLogLog::deserialize(deserializer);
+    result->histogram = Histogram::deserialize(deserializer);
+    return result;
 }
 
 // Read/write statistics cannot be cached since functions like checkpointInMemoryIfNecessary may
@@ -34,7 +144,7 @@ bool RWPropertyStats::mayHaveNull(const transaction::Transaction& transaction) {
         return true;
     }
     KU_ASSERT(tablesStatistics);
-    auto statistics =
+    auto& statistics =
         tablesStatistics->getPropertyStatisticsForTable(transaction, tableID, propertyID);
     return statistics.mayHaveNull();
 }
@@ -52,5 +162,17 @@ void RWPropertyStats::setHasNull(const transaction::Transaction& transaction) {
     }
 }
 
+void RWPropertyStats::update(ColumnChunk& chunk) {
+    if (propertyID == common::INVALID_PROPERTY_ID) {
+        return;
+    }
+    KU_ASSERT(tablesStatistics);
+    // Collect the statistics of the chunk before taking the lock, so that concurrent appends of
+    // COPY only serialize on the merge.
+    PropertyStatistics chunkStatistics;
+    chunkStatistics.update(chunk);
+    tablesStatistics->mergePropertyStatisticsForTable(tableID, propertyID, chunkStatistics);
+}
+
 } // namespace storage
 } // namespace kuzu
@@ -80,6 +80,29 @@ void TablesStatistics::setPropertyStatisticsForTable(
     tableStatistics->setPropertyStatistics(propertyID, stats);
 }
 
+void TablesStatistics::mergePropertyStatisticsForTable(
+    table_id_t tableID, property_id_t propertyID, const PropertyStatistics& stats) {
+    std::unique_lock xLck{mtx};
+    initTableStatisticsForWriteTrxNoLock();
+    KU_ASSERT(readWriteVersion && readWriteVersion->tableStatisticPerTable.contains(tableID));
+    setToUpdated();
+    auto tableStatistics = readWriteVersion->tableStatisticPerTable.at(tableID).get();
+    tableStatistics->getPropertyStatistics(propertyID).merge(stats);
+}
+
+const PropertyStatistics* TablesStatistics::getPropertyStatistics(
+    transaction::TransactionType transactionType, table_id_t tableID,
+    property_id_t propertyID) const {
+    auto version = getVersion(transactionType);
+    if (version == nullptr) {
+        version = readOnlyVersion.get();
+    }
+    if (!version->tableStatisticPerTable.contains(tableID)) {
+        return nullptr;
+    }
+    return version->tableStatisticPerTable.at(tableID)->getPropertyStatisticsIfExists(propertyID);
+}
+
 std::unique_ptr<MetadataDAHInfo> TablesStatistics::createMetadataDAHInfo(
     const LogicalType& dataType, BMFileHandle& metadataFH, BufferManager* bm, WAL* wal) {
     auto metadataDAHInfo = std::make_unique<MetadataDAHInfo>();
@@ -0,0 +1,192 @@
+#include "storage/stats/zone_map.h"
+
+#include <cmath>
+
+#include "common/assert.h"
+#include "common/null_mask.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+template<typename T, typename W>
+static bool updateRange(ZoneMap& zoneMap, const T* values, offset_t offset, offset_t numValues,
+    const uint64_t* nullMask) {
+    auto changed = false;
+    for (auto i = offset; i < offset + numValues; i++) {
+        if (nullMask && NullMask::isNull(nullMask, i)) {
+            continue;
+        }
+        auto value = (W)values[i];
+        if constexpr (std::is_floating_point_v<T>) {
+            if (std::isnan(value)) {
+                // NaN is not ordered, so the range can't describe the chunk anymore.
+                zoneMap.isValid = false;
+                return true;
+            }
+        }
+        if (!zoneMap.hasNonNullValues) {
+            zoneMap.hasNonNullValues = true;
+            zoneMap.min = StorageValue(value);
+            zoneMap.max = StorageValue(value);
+            changed = true;
+            continue;
+        }
+        if (value < zoneMap.min.get<W>()) {
+            zoneMap.min = StorageValue(value);
+            changed = true;
+        }
+        if (value > zoneMap.max.get<W>()) {
+            zoneMap.max = StorageValue(value);
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+template<typename W>
+static bool mayMatchRange(W min, W max, ExpressionType comparison, W constant) {
+    if constexpr (std::is_floating_point_v<W>) {
+        if (std::isnan(constant)) {
+            return true;
+        }
+    }
+    switch (comparison) {
+    case ExpressionType::EQUALS:
+        return min <= constant && constant <= max;
+    case ExpressionType::NOT_EQUALS:
+        return !(min == constant && max == constant);
+    case ExpressionType::GREATER_THAN:
+        return max > constant;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return max >= constant;
+    case ExpressionType::LESS_THAN:
+        return min < constant;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return min <= constant;
+    default:
+        return true;
+    }
+}
+
+StorageValue StorageValue::read(const uint8_t* data, offset_t pos, PhysicalTypeID physicalType) {
+    switch (physicalType) {
+    case PhysicalTypeID::INT64:
+        return StorageValue((int64_t)((int64_t*)data)[pos]);
+    case PhysicalTypeID::INT32:
+        return StorageValue((int64_t)((int32_t*)data)[pos]);
+    case PhysicalTypeID::INT16:
+        return StorageValue((int64_t)((int16_t*)data)[pos]);
+    case PhysicalTypeID::INT8:
+        return StorageValue((int64_t)((int8_t*)data)[pos]);
+    case PhysicalTypeID::UINT64:
+        return StorageValue((uint64_t)((uint64_t*)data)[pos]);
+    case PhysicalTypeID::UINT32:
+        return StorageValue((uint64_t)((uint32_t*)data)[pos]);
+    case PhysicalTypeID::UINT16:
+        return StorageValue((uint64_t)((uint16_t*)data)[pos]);
+    case PhysicalTypeID::UINT8:
+        return StorageValue((uint64_t)((uint8_t*)data)[pos]);
+    case PhysicalTypeID::DOUBLE:
+        return StorageValue((double)((double*)data)[pos]);
+    case PhysicalTypeID::FLOAT:
+        return StorageValue((double)((float*)data)[pos]);
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+bool ZoneMap::isSupported(const LogicalType& dataType) {
+    if (dataType.getLogicalTypeID() == LogicalTypeID::SERIAL) {
+        return false;
+    }
+    switch (dataType.getPhysicalType()) {
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT8:
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT8:
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::FLOAT:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool ZoneMap::update(const uint8_t* data, offset_t offset, offset_t numValues,
+    PhysicalTypeID physicalType, const uint64_t* nullMask) {
+    if (!isValid) {
+        return false;
+    }
+    switch (physicalType) {
+    case PhysicalTypeID::INT64:
+        return updateRange<int64_t, int64_t>(
+            *this, (int64_t*)data, offset, numValues, nullMask);
+    case PhysicalTypeID::INT32:
+        return updateRange<int32_t, int64_t>(
+            *this, (int32_t*)data, offset, numValues, nullMask);
+    case PhysicalTypeID::INT16:
+        return updateRange<int16_t, int64_t>(
+            *this, (int16_t*)data, offset, numValues, nullMask);
+    case PhysicalTypeID::INT8:
+        return updateRange<int8_t, int64_t>(*this, (int8_t*)data, offset, numValues, nullMask);
+    case PhysicalTypeID::UINT64:
+        return updateRange<uint64_t, uint64_t>(
+            *this, (uint64_t*)data, offset, numValues, nullMask);
+    case PhysicalTypeID::UINT32:
+        return updateRange<uint32_t, uint64_t>(
+            *this, (uint32_t*)data, offset, numValues, nullMask);
+    case PhysicalTypeID::UINT16:
+        return updateRange<uint16_t, uint64_t>(
+            *this, (uint16_t*)data, offset, numValues, nullMask);
+    case PhysicalTypeID::UINT8:
+        return updateRange<uint8_t, uint64_t>(
+            *this, (uint8_t*)data, offset, numValues, nullMask);
+    case PhysicalTypeID::DOUBLE:
+        return updateRange<double, double>(*this, (double*)data, offset, numValues, nullMask);
+    case PhysicalTypeID::FLOAT:
+        return updateRange<float, double>(*this, (float*)data, offset, numValues, nullMask);
+    default: {
+        isValid = false;
+        return true;
+    }
+    }
+}
+
+bool ZoneMap::mayMatch(
+    ExpressionType comparison, StorageValue constant, PhysicalTypeID physicalType) const {
+    if (!isValid) {
+        return true;
+    }
+    if (!hasNonNullValues) {
+        // Comparisons against null are never true.
+        return false;
+    }
+    switch (physicalType) {
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT8:
+        return mayMatchRange<int64_t>(
+            min.signedInt, max.signedInt, comparison, constant.signedInt);
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT8:
+        return mayMatchRange<uint64_t>(
+            min.unsignedInt, max.unsignedInt, comparison, constant.unsignedInt);
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::FLOAT:
+        return mayMatchRange<double>(min.floatVal, max.floatVal, comparison, constant.floatVal);
+    default:
+        return true;
+    }
+}
+
+} // namespace storage
+} // namespace kuzu
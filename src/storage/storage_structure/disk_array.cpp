@@ -95,6 +95,27 @@ void BaseDiskArrayInternal::get(uint64_t idx, TransactionType trxType, std::span
     }
 }
 
+void BaseDiskArrayInternal::prefetch(std::span<const uint64_t> sortedIdxs) {
+    if (bufferManager == nullptr) {
+        return;
+    }
+    std::shared_lock sLck{diskArraySharedMtx};
+    auto lastAPIdx = INVALID_PAGE_IDX;
+    for (auto idx : sortedIdxs) {
+        if (idx >= header.numElements) {
+            // Elements appended by the write trx aren't on disk yet.
+            break;
+        }
+        auto apIdx = getAPIdxAndOffsetInAP(idx).pageIdx;
+        if (apIdx == lastAPIdx) {
+            continue;
+        }
+        lastAPIdx = apIdx;
+        bufferManager->prefetch(
+            (BMFileHandle&)fileHandle, getAPPageIdxNoLock(apIdx, TransactionType::READ_ONLY), 1);
+    }
+}
+
 void BaseDiskArrayInternal::update(uint64_t idx, std::span<uint8_t> val) {
     std::unique_lock xLck{diskArraySharedMtx};
     hasTransactionalUpdates = true;
@@ -357,6 +357,8 @@ void Column::scanInternal(
         StorageUtils::getNodeGroupIdxAndOffsetInChunk(startNodeOffset);
     auto cursor = getPageCursorForOffset(transaction->getType(), nodeGroupIdx, offsetInChunk);
     auto chunkMeta = metadataDA->get(nodeGroupIdx, transaction->getType());
+    readAhead(transaction, chunkMeta, offsetInChunk,
+        offsetInChunk + nodeIDVector->state->getOriginalSize());
     if (nodeIDVector->state->selVector->isUnfiltered()) {
         scanUnfiltered(transaction, cursor, nodeIDVector->state->selVector->selectedSize,
             resultVector, chunkMeta);
@@ -365,6 +367,37 @@ void Column::scanInternal(
     }
 }
 
+// Sequential scans read ahead the pages of a column chunk in windows of READ_AHEAD_NUM_PAGES pages.
+// When a scan enters a new window, the pages after the ones it is about to read, up to the end of
+// the next window, are read into frames in the background. Only read-only transactions read ahead,
+// as they always read the original pages of the data file.
+void Column::readAhead(Transaction* transaction, const ColumnChunkMetadata& chunkMeta,
+    offset_t startOffsetInChunk, offset_t endOffsetInChunk) {
+    if (!transaction->isReadOnly() || chunkMeta.numPages == 0 ||
+        endOffsetInChunk <= startOffsetInChunk) {
+        return;
+    }
+    auto numValuesPerPage =
+        chunkMeta.compMeta.numValues(BufferPoolConstants::PAGE_4KB_SIZE, dataType);
+    auto firstPageIdx = startOffsetInChunk / numValuesPerPage;
+    auto lastPageIdx = (endOffsetInChunk - 1) / numValuesPerPage;
+    auto windowSize = StorageConstants::READ_AHEAD_NUM_PAGES;
+    auto windowStartPageIdx = (firstPageIdx + windowSize - 1) / windowSize * windowSize;
+    if (windowStartPageIdx > lastPageIdx) {
+        // Still in the window whose read ahead was issued before.
+        return;
+    }
+    auto startPageIdx = lastPageIdx + 1;
+    if (windowStartPageIdx > 0) {
+        startPageIdx = std::max(startPageIdx, windowStartPageIdx + windowSize);
+    }
+    auto endPageIdx = std::min(windowStartPageIdx + 2 * windowSize, (uint64_t)chunkMeta.numPages);
+    if (startPageIdx >= endPageIdx) {
+        return;
+    }
+    bufferManager->prefetch(*dataFH, chunkMeta.pageIdx + startPageIdx, endPageIdx - startPageIdx);
+}
+
 void Column::scanUnfiltered(Transaction* transaction, PageCursor& pageCursor,
     uint64_t numValuesToScan, ValueVector* resultVector, const ColumnChunkMetadata& chunkMeta,
     uint64_t startPosInVector) {
@@ -493,14 +526,19 @@ void Column::write(node_group_idx_t nodeGroupIdx, offset_t offsetInChunk,
     ValueVector* vectorToWriteFrom, uint32_t posInVectorToWriteFrom) {
     bool isNull = vectorToWriteFrom->isNull(posInVectorToWriteFrom);
     auto chunkMeta = metadataDA->get(nodeGroupIdx, TransactionType::WRITE);
+    auto zoneMapChanged = false;
     if (!isNull) {
         writeValue(
             chunkMeta, nodeGroupIdx, offsetInChunk, vectorToWriteFrom, posInVectorToWriteFrom);
+        zoneMapChanged = chunkMeta.zoneMap.update(vectorToWriteFrom->getData(),
+            posInVectorToWriteFrom, 1 /* numValues */, dataType.getPhysicalType());
     }
     if (offsetInChunk >= chunkMeta.numValues) {
         chunkMeta.numValues = offsetInChunk + 1;
         KU_ASSERT(sanityCheckForWrites(chunkMeta, dataType));
         metadataDA->update(nodeGroupIdx, chunkMeta);
+    } else if (zoneMapChanged) {
+        metadataDA->update(nodeGroupIdx, chunkMeta);
     }
 }
 
@@ -518,10 +556,16 @@ void Column::write(node_group_idx_t nodeGroupIdx, offset_t offsetInChunk, Column
     offset_t dataOffset, length_t numValues) {
     auto state = getReadState(TransactionType::WRITE, nodeGroupIdx);
     writeValues(state, offsetInChunk, data->getData(), dataOffset, numValues);
+    auto nullMask =
+        data->getNullChunk() ? (const uint64_t*)data->getNullChunk()->getData() : nullptr;
+    auto zoneMapChanged = state.metadata.zoneMap.update(
+        data->getData(), dataOffset, numValues, dataType.getPhysicalType(), nullMask);
     if (offsetInChunk + numValues > state.metadata.numValues) {
         state.metadata.numValues = offsetInChunk + numValues;
         KU_ASSERT(sanityCheckForWrites(state.metadata, dataType));
         metadataDA->update(nodeGroupIdx, state.metadata);
+    } else if (zoneMapChanged) {
+        metadataDA->update(nodeGroupIdx, state.metadata);
     }
 }
 
@@ -548,6 +592,7 @@ offset_t Column::appendValues(
     auto startOffset = state.metadata.numValues;
     auto numPages = dataFH->getNumPages();
     writeValues(state, state.metadata.numValues, data, 0 /*dataOffset*/, numValues);
+    state.metadata.zoneMap.update(data, 0 /* offset */, numValues, dataType.getPhysicalType());
     auto newNumPages = dataFH->getNumPages();
     state.metadata.numValues += numValues;
     state.metadata.numPages += (newNumPages - numPages);
@@ -38,16 +38,23 @@ ColumnChunkMetadata booleanGetMetadata(
 
 class CompressedFlushBuffer {
     std::shared_ptr<CompressionAlg> alg;
+    // Used instead of alg if the chunk was chosen to be delta compressed. May be null.
+    std::shared_ptr<CompressionAlg> deltaAlg;
     const LogicalType& dataType;
 
 public:
-    CompressedFlushBuffer(std::shared_ptr<CompressionAlg> alg, LogicalType& dataType)
-        : alg{std::move(alg)}, dataType{dataType} {}
+    CompressedFlushBuffer(std::shared_ptr<CompressionAlg> alg,
+        std::shared_ptr<CompressionAlg> deltaAlg, LogicalType& dataType)
+        : alg{std::move(alg)}, deltaAlg{std::move(deltaAlg)}, dataType{dataType} {}
 
     CompressedFlushBuffer(const CompressedFlushBuffer& other) = default;
 
     ColumnChunkMetadata operator()(const uint8_t* buffer, uint64_t /*bufferSize*/,
         BMFileHandle* dataFH, page_idx_t startPageIdx, const ColumnChunkMetadata& metadata) {
+        auto& alg = metadata.compMeta.compression == CompressionType::INTEGER_DELTA_BITPACKING ?
+                        deltaAlg :
+                        this->alg;
+        KU_ASSERT(alg != nullptr);
         auto valuesRemaining = metadata.numValues;
         const uint8_t* bufferStart = buffer;
         auto compressedBuffer = std::make_unique<uint8_t[]>(BufferPoolConstants::PAGE_4KB_SIZE);
@@ -90,21 +97,52 @@ public:
 
 class GetCompressionMetadata {
     std::shared_ptr<CompressionAlg> alg;
+    std::shared_ptr<CompressionAlg> deltaAlg;
     const LogicalType& dataType;
 
 public:
-    GetCompressionMetadata(std::shared_ptr<CompressionAlg> alg, LogicalType& dataType)
-        : alg{std::move(alg)}, dataType{dataType} {}
+    GetCompressionMetadata(std::shared_ptr<CompressionAlg> alg,
+        std::shared_ptr<CompressionAlg> deltaAlg, LogicalType& dataType)
+        : alg{std::move(alg)}, deltaAlg{std::move(deltaAlg)}, dataType{dataType} {}
 
     GetCompressionMetadata(const GetCompressionMetadata& other) = default;
 
     ColumnChunkMetadata operator()(
         const uint8_t* buffer, uint64_t /*bufferSize*/, uint64_t capacity, uint64_t numValues) {
         auto metadata = alg->getCompressionMetadata(buffer, numValues);
+        if (deltaAlg != nullptr) {
+            auto deltaMetadata = deltaAlg->getCompressionMetadata(buffer, numValues);
+            if (preferDeltaCompression(metadata, deltaMetadata)) {
+                metadata = deltaMetadata;
+            }
+        }
         auto numValuesPerPage = metadata.numValues(BufferPoolConstants::PAGE_4KB_SIZE, dataType);
         auto numPages = capacity / numValuesPerPage + (capacity % numValuesPerPage == 0 ? 0 : 1);
         return ColumnChunkMetadata(INVALID_PAGE_IDX, numPages, numValues, metadata);
     }
+
+private:
+    // Delta compressed values are more expensive to decompress, and can't be updated in place.
+    // Thus, delta compression is only used if it at least halves the size of the chunk, which is
+    // the case for sorted or nearly sorted values.
+    inline bool preferDeltaCompression(
+        const CompressionMetadata& metadata, const CompressionMetadata& deltaMetadata) const {
+        if (deltaMetadata.compression != CompressionType::INTEGER_DELTA_BITPACKING) {
+            return false;
+        }
+        auto deltaBitWidth = BitpackHeader::readHeader(deltaMetadata.data).bitWidth;
+        switch (metadata.compression) {
+        case CompressionType::UNCOMPRESSED: {
+            return deltaBitWidth * 2 <= getDataTypeSizeInChunk(dataType) * 8;
+        }
+        case CompressionType::INTEGER_BITPACKING: {
+            return deltaBitWidth * 2 <= BitpackHeader::readHeader(metadata.data).bitWidth;
+        }
+        default: {
+            return false;
+        }
+        }
+    }
 };
 
 static std::shared_ptr<CompressionAlg> getCompression(
@@ -140,12 +178,57 @@ static std::shared_ptr<CompressionAlg> getCompression(
     case PhysicalTypeID::UINT8: {
         return std::make_shared<IntegerBitpacking<uint8_t>>();
     }
+    case PhysicalTypeID::DOUBLE: {
+        return std::make_shared<FloatCompression<double>>();
+    }
+    case PhysicalTypeID::FLOAT: {
+        return std::make_shared<FloatCompression<float>>();
+    }
     default: {
         return std::make_shared<Uncompressed>(dataType);
     }
     }
 }
 
+static std::shared_ptr<CompressionAlg> getDeltaCompression(
+    const LogicalType& dataType, bool enableCompression) {
+    if (!enableCompression || dataType.getLogicalTypeID() == LogicalTypeID::SERIAL) {
+        return nullptr;
+    }
+    switch (dataType.getPhysicalType()) {
+    case PhysicalTypeID::INT64: {
+        return std::make_shared<IntegerDeltaBitpacking<int64_t>>();
+    }
+    case PhysicalTypeID::INT32: {
+        return std::make_shared<IntegerDeltaBitpacking<int32_t>>();
+    }
+    case PhysicalTypeID::INT16: {
+        return std::make_shared<IntegerDeltaBitpacking<int16_t>>();
+    }
+    case PhysicalTypeID::INT8: {
+        return std::make_shared<IntegerDeltaBitpacking<int8_t>>();
+    }
+    case PhysicalTypeID::INTERNAL_ID:
+    case PhysicalTypeID::LIST:
+    case PhysicalTypeID::UINT64: {
+        return std::make_shared<IntegerDeltaBitpacking<uint64_t>>();
+    }
+    case PhysicalTypeID::STRING:
+    case PhysicalTypeID::UINT32: {
+        return std::make_shared<IntegerDeltaBitpacking<uint32_t>>();
+    }
+    case PhysicalTypeID::UINT16: {
+        return std::make_shared<IntegerDeltaBitpacking<uint16_t>>();
+    }
+    case PhysicalTypeID::UINT8: {
+        return std::make_shared<IntegerDeltaBitpacking<uint8_t>>();
+    }
+    default: {
+        return nullptr;
+    }
+    }
+}
+
 ColumnChunk::ColumnChunk(
     LogicalType dataType, uint64_t capacity, bool enableCompression, bool hasNullChunk)
     : dataType{std::move(dataType)},
@@ -188,10 +271,14 @@ void ColumnChunk::initializeFunction() {
     case PhysicalTypeID::UINT32:
     case PhysicalTypeID::UINT16:
     case PhysicalTypeID::UINT8:
-    case PhysicalTypeID::INT128: {
+    case PhysicalTypeID::INT128:
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::FLOAT: {
         auto compression = getCompression(this->dataType, enableCompression);
-        flushBufferFunction = CompressedFlushBuffer(compression, this->dataType);
-        getMetadataFunction = GetCompressionMetadata(compression, this->dataType);
+        auto deltaCompression = getDeltaCompression(this->dataType, enableCompression);
+        flushBufferFunction = CompressedFlushBuffer(compression, deltaCompression, this->dataType);
+        getMetadataFunction =
+            GetCompressionMetadata(compression, deltaCompression, this->dataType);
         break;
     }
     default: {
@@ -394,22 +481,37 @@ bool ColumnChunk::sanityCheck() {
 
 ColumnChunkMetadata ColumnChunk::getMetadataToFlush() const {
     KU_ASSERT(numValues <= capacity);
+    ColumnChunkMetadata metadata;
+    std::optional<CompressionMetadata> constantMetadata;
     if (enableCompression) {
         // Determine if we can make use of constant compression
-        auto constantMetadata = ConstantCompression::analyze(*this);
-        if (constantMetadata) {
-            return ColumnChunkMetadata(INVALID_PAGE_IDX, 0, numValues, *constantMetadata);
-        }
+        constantMetadata = ConstantCompression::analyze(*this);
     }
-    KU_ASSERT(bufferSize == getBufferSize(capacity));
-    return getMetadataFunction(buffer.get(), bufferSize, capacity, numValues);
+    if (constantMetadata) {
+        metadata = ColumnChunkMetadata(INVALID_PAGE_IDX, 0, numValues, *constantMetadata);
+    } else {
+        KU_ASSERT(bufferSize == getBufferSize(capacity));
+        metadata = getMetadataFunction(buffer.get(), bufferSize, capacity, numValues);
+    }
+    if (ZoneMap::isSupported(dataType)) {
+        metadata.zoneMap = ZoneMap::empty();
+        auto nullMask = nullChunk && nullChunk->mayHaveNull() ?
+                            (const uint64_t*)nullChunk->getData() :
+                            nullptr;
+        metadata.zoneMap.update(
+            buffer.get(), 0 /* offset */, numValues, dataType.getPhysicalType(), nullMask);
+    }
+    return metadata;
 }
 
 ColumnChunkMetadata ColumnChunk::flushBuffer(
     BMFileHandle* dataFH, page_idx_t startPageIdx, const ColumnChunkMetadata& metadata) {
     if (!metadata.compMeta.isConstant()) {
         KU_ASSERT(bufferSize == getBufferSize(capacity));
-        return flushBufferFunction(buffer.get(), bufferSize, dataFH, startPageIdx, metadata);
+        auto flushedMetadata =
+            flushBufferFunction(buffer.get(), bufferSize, dataFH, startPageIdx, metadata);
+        flushedMetadata.zoneMap = metadata.zoneMap;
+        return flushedMetadata;
     }
     return metadata;
 }
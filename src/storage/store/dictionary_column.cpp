@@ -58,7 +58,8 @@ void DictionaryColumn::scan(Transaction* transaction, node_group_idx_t nodeGroup
     string_index_t firstOffsetToScan, lastOffsetToScan;
     auto comp = [](auto pair1, auto pair2) { return pair1.first < pair2.first; };
     auto duplicationFactor = (double)offsetState.metadata.numValues / indexMeta.numValues;
-    if (duplicationFactor <= 0.5) {
+    auto isSorted = duplicationFactor <= 0.5;
+    if (isSorted) {
         // If at least 50% of strings are duplicated, sort the offsets so we can re-use scanned
         // strings
         std::sort(offsetsToScan.begin(), offsetsToScan.end(), comp);
@@ -76,7 +77,15 @@ void DictionaryColumn::scan(Transaction* transaction, node_group_idx_t nodeGroup
     // where the worst case for the current method is much worse
 
     // Note that the list will contain duplicates when indices are duplicated.
-    // Each distinct value is scanned once, and re-used when writing to each output value
+    // Each distinct value is scanned once, and re-used when writing to each output value. In that
+    // case, the distinct values are also numbered to give the dictionary codes of the vector.
+    // Codes are only kept for DEFAULT_VECTOR_CAPACITY positions, which data vectors of lists can
+    // exceed.
+    auto fitsCodes = std::all_of(offsetsToScan.begin(), offsetsToScan.end(),
+        [](auto pair) { return pair.second < DEFAULT_VECTOR_CAPACITY; });
+    auto codes = isSorted && fitsCodes ? StringVector::getDictionaryCodesToWrite(resultVector) :
+                                         nullptr;
+    dictionary_code_t numCodes = 0;
     auto numOffsetsToScan = lastOffsetToScan - firstOffsetToScan + 1;
     // One extra offset to scan for the end offset of the last string
     std::vector<string_offset_t> offsets(numOffsetsToScan + 1);
@@ -89,14 +98,22 @@ void DictionaryColumn::scan(Transaction* transaction, node_group_idx_t nodeGroup
         scanValueToVector(transaction, dataState, startOffset, endOffset, resultVector,
             offsetsToScan[pos].second);
         auto& scannedString = resultVector->getValue<ku_string_t>(offsetsToScan[pos].second);
+        if (codes) {
+            codes[offsetsToScan[pos].second] = numCodes;
+        }
         // For each string which has the same index in the dictionary as the one we scanned,
         // copy the scanned string to its position in the result vector
         while (pos + 1 < offsetsToScan.size() &&
                offsetsToScan[pos + 1].first == offsetsToScan[pos].first) {
             pos++;
             resultVector->setValue<ku_string_t>(offsetsToScan[pos].second, scannedString);
+            if (codes) {
+                codes[offsetsToScan[pos].second] = numCodes;
+            }
         }
+        numCodes++;
     }
+    StringVector::setNumDictionaryCodes(resultVector, codes ? numCodes : 0);
 }
 
 string_index_t DictionaryColumn::append(node_group_idx_t nodeGroupIdx, std::string_view val) {
@@ -57,6 +57,19 @@ void NodeTable::scan(Transaction* transaction, TableReadState& readState) {
     }
 }
 
+bool NodeTable::canSkipNodeGroup(Transaction* transaction, node_group_idx_t nodeGroupIdx,
+    const std::vector<ZoneMapPredicate>& predicates) {
+    if (predicates.empty()) {
+        return false;
+    }
+    if (transaction->isWriteTransaction() &&
+        transaction->getLocalStorage()->getLocalTable(tableID)) {
+        // Local inserts and updates are not reflected in the zone maps.
+        return false;
+    }
+    return tableData->canSkipNodeGroup(transaction, nodeGroupIdx, predicates);
+}
+
 void NodeTable::lookup(Transaction* transaction, TableReadState& readState) {
     tableData->lookup(
         transaction, *readState.dataReadState, readState.nodeIDVector, readState.outputVectors);
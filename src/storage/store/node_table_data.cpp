@@ -60,11 +60,28 @@ void NodeTableData::lookup(Transaction* transaction, TableDataReadState& readSta
     }
 }
 
+bool NodeTableData::canSkipNodeGroup(Transaction* transaction, node_group_idx_t nodeGroupIdx,
+    const std::vector<ZoneMapPredicate>& predicates) {
+    for (auto& predicate : predicates) {
+        auto column = columns[predicate.columnID].get();
+        if (nodeGroupIdx >= column->getNumNodeGroups(transaction)) {
+            return false;
+        }
+        auto metadata = column->getMetadata(nodeGroupIdx, transaction->getType());
+        if (!metadata.zoneMap.mayMatch(
+                predicate.comparison, predicate.value, predicate.physicalType)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void NodeTableData::append(ChunkedNodeGroup* nodeGroup) {
     for (auto columnID = 0u; columnID < columns.size(); columnID++) {
         auto& columnChunk = nodeGroup->getColumnChunkUnsafe(columnID);
         KU_ASSERT(columnID < columns.size());
         columns[columnID]->append(&columnChunk, nodeGroup->getNodeGroupIdx());
+        columns[columnID]->getPropertyStatistics().update(columnChunk);
     }
 }
 
@@ -78,6 +95,12 @@ void NodeTableData::prepareLocalTableToCommit(
             if (localInsertChunk.empty() && localUpdateChunk.empty()) {
                 continue;
             }
+            for (auto chunk : localInsertChunk) {
+                column->getPropertyStatistics().update(*chunk);
+            }
+            for (auto chunk : localUpdateChunk) {
+                column->getPropertyStatistics().update(*chunk);
+            }
             auto localNodeNG = ku_dynamic_cast<LocalNodeGroup*, LocalNodeNG*>(localNodeGroup.get());
             column->prepareCommitForChunk(transaction, nodeGroupIdx, localInsertChunk,
                 localNodeNG->getInsertInfoRef(), localUpdateChunk,
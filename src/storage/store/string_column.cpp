@@ -30,6 +30,10 @@ void StringColumn::scan(Transaction* transaction, node_group_idx_t nodeGroupIdx,
         offsetInVector);
     scanUnfiltered(transaction, nodeGroupIdx, startOffsetInGroup, endOffsetInGroup, resultVector,
         offsetInVector);
+    if (offsetInVector > 0) {
+        // The vector is filled by multiple scans, possibly from different dictionaries.
+        StringVector::clearDictionaryCodes(resultVector);
+    }
 }
 
 void StringColumn::scan(Transaction* transaction, node_group_idx_t nodeGroupIdx,
@@ -101,9 +105,11 @@ void StringColumn::scanInternal(
 void StringColumn::scanUnfiltered(transaction::Transaction* transaction,
     node_group_idx_t nodeGroupIdx, offset_t startOffsetInGroup, offset_t endOffsetInGroup,
     ValueVector* resultVector, sel_t startPosInVector) {
+    StringVector::clearDictionaryCodes(resultVector);
     auto numValuesToRead = endOffsetInGroup - startOffsetInGroup;
     auto indices = std::make_unique<string_index_t[]>(numValuesToRead);
     auto indexState = getReadState(transaction->getType(), nodeGroupIdx);
+    readAhead(transaction, indexState.metadata, startOffsetInGroup, endOffsetInGroup);
     Column::scan(
         transaction, indexState, startOffsetInGroup, endOffsetInGroup, (uint8_t*)indices.get());
 
@@ -123,6 +129,7 @@ void StringColumn::scanUnfiltered(transaction::Transaction* transaction,
 void StringColumn::scanFiltered(transaction::Transaction* transaction,
     node_group_idx_t nodeGroupIdx, offset_t startOffsetInGroup, ValueVector* nodeIDVector,
     ValueVector* resultVector) {
+    StringVector::clearDictionaryCodes(resultVector);
     auto indexState = getReadState(transaction->getType(), nodeGroupIdx);
 
     std::vector<std::pair<string_index_t, uint64_t>> offsetsToScan;
@@ -147,6 +154,7 @@ void StringColumn::scanFiltered(transaction::Transaction* transaction,
 void StringColumn::lookupInternal(
     Transaction* transaction, ValueVector* nodeIDVector, ValueVector* resultVector) {
     KU_ASSERT(dataType.getPhysicalType() == PhysicalTypeID::STRING);
+    StringVector::clearDictionaryCodes(resultVector);
     auto startNodeOffset = nodeIDVector->readNodeOffset(0);
     auto nodeGroupIdx = StorageUtils::getNodeGroupIdx(startNodeOffset);
 
@@ -61,6 +61,8 @@ void StringColumnChunk::lookup(
     }
     auto str = getValue<std::string_view>(offsetInChunk);
     output.setValue<std::string_view>(posInOutputVector, str);
+    // Local changes are merged into scanned vectors, whose codes don't cover the new string.
+    StringVector::clearDictionaryCodes(&output);
 }
 
 void StringColumnChunk::write(
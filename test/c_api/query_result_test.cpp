@@ -108,6 +108,33 @@ TEST_F(CApiQueryResultTest, GetColumnDataType) {
 //    kuzu_query_result_destroy(result);
 //}
 
+TEST_F(CApiQueryResultTest, GetArrowArrayStream) {
+    auto connection = getConnection();
+    auto result = kuzu_connection_query(
+        connection, "MATCH (a:person) RETURN a.fName, a.age ORDER BY a.fName");
+    ASSERT_TRUE(kuzu_query_result_is_success(result));
+    // The stream starts from the tuples that have not been read yet.
+    auto row = kuzu_query_result_get_next(result);
+    kuzu_flat_tuple_destroy(row);
+    auto stream = kuzu_query_result_get_arrow_array_stream(result, 4);
+    struct ArrowArray array;
+    ASSERT_EQ(stream.get_next(&stream, &array), 0);
+    ASSERT_EQ(array.length, 4);
+    ASSERT_EQ(array.n_children, 2);
+    auto ages = (const int64_t*)array.children[1]->buffers[1];
+    ASSERT_EQ(ages[0], 30);
+    ASSERT_EQ(ages[3], 20);
+    array.release(&array);
+    ASSERT_EQ(stream.get_next(&stream, &array), 0);
+    ASSERT_EQ(array.length, 3);
+    array.release(&array);
+    ASSERT_EQ(stream.get_next(&stream, &array), 0);
+    ASSERT_EQ(array.release, nullptr);
+    ASSERT_FALSE(kuzu_query_result_has_next(result));
+    stream.release(&stream);
+    kuzu_query_result_destroy(result);
+}
+
 TEST_F(CApiQueryResultTest, GetQuerySummary) {
     auto connection = getConnection();
     auto result =
@@ -123,6 +150,33 @@ TEST_F(CApiQueryResultTest, GetQuerySummary) {
     kuzu_query_result_destroy(result);
 }
 
+TEST_F(CApiQueryResultTest, GetProfileJson) {
+    auto connection = getConnection();
+    auto result =
+        kuzu_connection_query(connection, "MATCH (a:person) RETURN a.fName, a.age, a.height");
+    ASSERT_TRUE(kuzu_query_result_is_success(result));
+    auto summary = kuzu_query_result_get_query_summary(result);
+    auto profileJson = kuzu_query_summary_get_profile_json(summary);
+    ASSERT_STREQ(profileJson, "");
+    kuzu_destroy_string(profileJson);
+    kuzu_query_summary_destroy(summary);
+    kuzu_query_result_destroy(result);
+
+    result = kuzu_connection_query(
+        connection, "PROFILE MATCH (a:person) RETURN a.fName, a.age, a.height");
+    ASSERT_TRUE(kuzu_query_result_is_success(result));
+    summary = kuzu_query_result_get_query_summary(result);
+    profileJson = kuzu_query_summary_get_profile_json(summary);
+    auto profileJsonStr = std::string(profileJson);
+    ASSERT_NE(profileJsonStr.find("\"RESULT_COLLECTOR\""), std::string::npos);
+    ASSERT_NE(profileJsonStr.find("\"NumPageHits\""), std::string::npos);
+    ASSERT_NE(profileJsonStr.find("\"PeakMemoryUsage\""), std::string::npos);
+    ASSERT_NE(profileJsonStr.find("\"ThreadExecutionTimes\""), std::string::npos);
+    kuzu_destroy_string(profileJson);
+    kuzu_query_summary_destroy(summary);
+    kuzu_query_result_destroy(result);
+}
+
 TEST_F(CApiQueryResultTest, GetNext) {
     auto connection = getConnection();
     auto result = kuzu_connection_query(
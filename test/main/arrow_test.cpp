@@ -27,6 +27,72 @@ TEST_F(ArrowTest, getArrowSchema) {
     schema->release(schema.get());
 }
 
+TEST_F(ArrowTest, getArrowArrayStream) {
+    auto query = "MATCH (a:person) RETURN a.ID, a.fName, a.isStudent, a.age ORDER BY a.ID";
+    auto result = conn->query(query);
+    auto stream = result->getArrowArrayStream(3);
+    ArrowSchema schema;
+    ASSERT_EQ(stream->get_schema(stream.get(), &schema), 0);
+    ASSERT_EQ(schema.n_children, 4);
+    ASSERT_EQ(std::string(schema.children[1]->name), "a.fName");
+    schema.release(&schema);
+    std::vector<int64_t> ids;
+    std::vector<int64_t> ages;
+    std::string names;
+    uint64_t numStudents = 0;
+    ArrowArray array;
+    while (true) {
+        ASSERT_EQ(stream->get_next(stream.get(), &array), 0);
+        if (array.release == nullptr) {
+            break;
+        }
+        ASSERT_LE(array.length, 3);
+        ASSERT_EQ(array.n_children, 4);
+        auto idData = (const int64_t*)array.children[0]->buffers[1];
+        auto nameOffsets = (const uint32_t*)array.children[1]->buffers[1];
+        auto nameData = (const char*)array.children[1]->buffers[2];
+        auto studentData = (const uint8_t*)array.children[2]->buffers[1];
+        auto ageData = (const int64_t*)array.children[3]->buffers[1];
+        for (auto i = 0; i < array.length; i++) {
+            ids.push_back(idData[i]);
+            names += std::string(nameData + nameOffsets[i], nameOffsets[i + 1] - nameOffsets[i]);
+            names += ",";
+            numStudents += (studentData[i / 8] >> (i % 8)) & 1;
+            ages.push_back(ageData[i]);
+        }
+        array.release(&array);
+    }
+    ASSERT_EQ(ids, std::vector<int64_t>({0, 2, 3, 5, 7, 8, 9, 10}));
+    ASSERT_EQ(names, "Alice,Bob,Carol,Dan,Elizabeth,Farooq,Greg,"
+                     "Hubert Blaine Wolfeschlegelsteinhausenbergerdorff,");
+    ASSERT_EQ(numStudents, 3);
+    ASSERT_EQ(ages, std::vector<int64_t>({35, 30, 45, 20, 20, 25, 40, 83}));
+    ASSERT_FALSE(result->hasNext());
+    stream->release(stream.get());
+}
+
+TEST_F(ArrowTest, getArrowArrayStreamWithUnflatColumns) {
+    auto query = "MATCH (a:person)-[:knows]->(b:person) WHERE a.ID = 0 RETURN a.ID, b.ID";
+    auto result = conn->query(query);
+    auto stream = result->getArrowArrayStream(2);
+    std::vector<int64_t> ids;
+    ArrowArray array;
+    while (true) {
+        ASSERT_EQ(stream->get_next(stream.get(), &array), 0);
+        if (array.release == nullptr) {
+            break;
+        }
+        auto idData = (const int64_t*)array.children[1]->buffers[1];
+        for (auto i = 0; i < array.length; i++) {
+            ids.push_back(idData[i]);
+        }
+        array.release(&array);
+    }
+    std::sort(ids.begin(), ids.end());
+    ASSERT_EQ(ids, std::vector<int64_t>({2, 3, 5}));
+    stream->release(stream.get());
+}
+
 class RDFArrowTest : public ApiTest {
     std::string getInputDir() override {
         return TestHelper::appendKuzuRootPath("dataset/rdf/base_iri/");
@@ -129,4 +129,24 @@ TEST_F(ApiTest, Prepare) {
                       "N, MANY_MANY);MATCH (a:N)-[:E]->(b:N) WHERE a.ID = 0 return b.ID;");
     ASSERT_EQ(result->getErrorMessage(),
         "Connection Exception: We do not support prepare multiple statements.");
-}
\ No newline at end of file
+}
+TEST_F(ApiTest, ProfileJson) {
+    ASSERT_TRUE(conn->query("CALL profile_json=true")->isSuccess());
+    auto result = conn->query("PROFILE MATCH (a:person) RETURN a.fName");
+    ASSERT_TRUE(result->isSuccess());
+    auto profile = result->getNext()->getValue(0)->toString();
+    ASSERT_EQ(profile.front(), '{');
+    ASSERT_NE(profile.find("\"NumPageHits\""), std::string::npos);
+    ASSERT_NE(profile.find("\"PeakMemoryUsage\""), std::string::npos);
+    ASSERT_EQ(result->getQuerySummary()->getProfileJson().front(), '{');
+}
+
+TEST_F(ApiTest, QueryStats) {
+    ASSERT_TRUE(conn->query("MATCH (a:person) RETURN a.fName")->isSuccess());
+    auto result = conn->query("CALL query_stats() WHERE query = 'MATCH (a:person) RETURN a.fName' "
+                              "RETURN num_tuples, num_threads > 0, compiling_time_ms > 0, "
+                              "num_page_hits + num_page_misses > 0");
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_EQ(result->getNumTuples(), 1);
+    ASSERT_EQ(result->getNext()->toString(), "8|True|True|True\n");
+}
@@ -77,6 +77,20 @@ TEST_F(ApiTest, PrepareInt) {
     ASSERT_FALSE(result->hasNext());
 }
 
+TEST_F(ApiTest, PrepareIntRange) {
+    auto preparedStatement = conn->prepare("MATCH (a:person) WHERE a.age > $1 RETURN COUNT(*)");
+    auto result =
+        conn->execute(preparedStatement.get(), std::make_pair(std::string("1"), (int64_t)40));
+    ASSERT_TRUE(result->hasNext());
+    checkTuple(result->getNext().get(), "2\n");
+    ASSERT_FALSE(result->hasNext());
+    result =
+        conn->execute(preparedStatement.get(), std::make_pair(std::string("1"), (int64_t)100));
+    ASSERT_TRUE(result->hasNext());
+    checkTuple(result->getNext().get(), "0\n");
+    ASSERT_FALSE(result->hasNext());
+}
+
 TEST_F(ApiTest, PrepareDouble) {
     auto preparedStatement =
         conn->prepare("MATCH (a:person) WHERE a.age = 35 RETURN a.eyeSight + $1");
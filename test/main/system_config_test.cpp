@@ -67,3 +67,21 @@ TEST_F(SystemConfigTest, testBufferPoolSize) {
     systemConfig->bufferPoolSize = BufferPoolConstants::DEFAULT_BUFFER_POOL_SIZE_FOR_TESTING;
     EXPECT_NO_THROW(auto db = std::make_unique<Database>(databasePath, *systemConfig));
 }
+
+TEST_F(SystemConfigTest, testTwoQueueEvictionPolicy) {
+    systemConfig->bufferPoolSize = 8 * 1024 * 1024;
+    systemConfig->evictionPolicy = EvictionPolicy::TWO_QUEUE;
+    auto db = std::make_unique<Database>(databasePath, *systemConfig);
+    auto con = std::make_unique<Connection>(db.get());
+    assertQuery(*con->query("CREATE NODE TABLE Item(id INT64, name STRING, PRIMARY KEY(id))"));
+    assertQuery(*con->query(
+        "UNWIND RANGE(0, 29999) AS i CREATE (:Item {id: i, name: 'item-name-' + to_string(i)})"));
+    for (auto i = 0u; i < 3; ++i) {
+        auto result = con->query("MATCH (n:Item) RETURN SUM(n.id), COUNT(n.name)");
+        ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+        ASSERT_EQ(result->getNext()->toString(), "449985000|30000\n");
+        result = con->query("MATCH (n:Item) WHERE n.id = 123 RETURN n.name");
+        ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+        ASSERT_EQ(result->getNext()->toString(), "item-name-123\n");
+    }
+}
@@ -0,0 +1,90 @@
+#include "function/hash/hash_functions.h"
+#include "gtest/gtest.h"
+#include "storage/stats/histogram.h"
+#include "storage/stats/hyper_log_log.h"
+
+using namespace kuzu::common;
+using namespace kuzu::function;
+using namespace kuzu::storage;
+
+static HyperLogLog buildSketch(int64_t start, int64_t end) {
+    HyperLogLog sketch;
+    for (auto i = start; i < end; i++) {
+        hash_t hash;
+        Hash::operation(i, hash);
+        sketch.insertHash(hash);
+    }
+    return sketch;
+}
+
+static void checkEstimate(uint64_t estimate, uint64_t expected) {
+    // About three times the standard error of a sketch with 256 registers.
+    EXPECT_NEAR((double)estimate, (double)expected, 0.2 * expected);
+}
+
+TEST(ColumnStatisticsTest, HyperLogLogSmallCardinality) {
+    HyperLogLog sketch;
+    EXPECT_TRUE(sketch.isEmpty());
+    EXPECT_EQ(sketch.estimate(), 0);
+    sketch = buildSketch(0, 10);
+    EXPECT_FALSE(sketch.isEmpty());
+    checkEstimate(sketch.estimate(), 10);
+}
+
+TEST(ColumnStatisticsTest, HyperLogLogDuplicates) {
+    auto sketch = buildSketch(0, 1000);
+    auto estimate = sketch.estimate();
+    sketch.merge(buildSketch(0, 1000));
+    EXPECT_EQ(sketch.estimate(), estimate);
+    checkEstimate(estimate, 1000);
+}
+
+TEST(ColumnStatisticsTest, HyperLogLogMerge) {
+    auto sketch = buildSketch(0, 50000);
+    sketch.merge(buildSketch(25000, 100000));
+    checkEstimate(sketch.estimate(), 100000);
+}
+
+TEST(ColumnStatisticsTest, HistogramUniform) {
+    std::vector<double> sample;
+    for (auto i = 0u; i <= 1000; i++) {
+        sample.push_back(i);
+    }
+    auto histogram = Histogram::build(sample, 1001);
+    EXPECT_EQ(histogram.getNumValues(), 1001);
+    EXPECT_EQ(histogram.estimateFractionLessOrEqual(-1), 0);
+    EXPECT_EQ(histogram.estimateFractionLessOrEqual(1000), 1);
+    EXPECT_NEAR(histogram.estimateFractionLessOrEqual(250), 0.25, 0.01);
+    EXPECT_NEAR(histogram.estimateFractionLessOrEqual(900), 0.9, 0.01);
+}
+
+TEST(ColumnStatisticsTest, HistogramSkewed) {
+    std::vector<double> sample;
+    for (auto i = 0u; i < 900; i++) {
+        sample.push_back(1);
+    }
+    for (auto i = 0u; i < 100; i++) {
+        sample.push_back(100 + i);
+    }
+    auto histogram = Histogram::build(sample, 1000);
+    EXPECT_NEAR(histogram.estimateFractionLessOrEqual(50), 0.9, 0.05);
+    EXPECT_NEAR(histogram.estimateFractionLessOrEqual(150), 0.95, 0.05);
+}
+
+TEST(ColumnStatisticsTest, HistogramMerge) {
+    std::vector<double> lower, upper;
+    for (auto i = 0u; i < 1000; i++) {
+        lower.push_back(i);
+        upper.push_back(1000 + i);
+    }
+    auto histogram = Histogram::build(lower, 1000);
+    histogram.merge(Histogram());
+    EXPECT_EQ(histogram.getNumValues(), 1000);
+    // The second chunk has three times as many values as its sample.
+    histogram.merge(Histogram::build(upper, 3000));
+    EXPECT_EQ(histogram.getNumValues(), 4000);
+    EXPECT_NEAR(histogram.estimateFractionLessOrEqual(500), 0.125, 0.02);
+    EXPECT_NEAR(histogram.estimateFractionLessOrEqual(1000), 0.25, 0.02);
+    EXPECT_NEAR(histogram.estimateFractionLessOrEqual(1500), 0.625, 0.02);
+    EXPECT_EQ(histogram.estimateFractionLessOrEqual(2000), 1);
+}
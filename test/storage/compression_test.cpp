@@ -132,9 +132,9 @@ TEST(CompressionTests, CopyMultiPage) {
     ASSERT_EQ((int64_t*)srcCursor - src.data(), numValues);
 }
 
-template<typename T>
+template<typename T, typename ALG = IntegerBitpacking<T>>
 void integerPackingMultiPage(const std::vector<T>& src) {
-    auto alg = IntegerBitpacking<T>();
+    auto alg = ALG();
     auto pageSize = 4096;
     auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
     auto numValuesPerPage = metadata.numValues(pageSize, LogicalType(LogicalTypeID::INT64));
@@ -288,3 +288,143 @@ TEST(CompressionTests, OffsetIntegerPackingMultiPageSigned64) {
 
     integerPackingMultiPage(src);
 }
+
+TEST(CompressionTests, IntegerDeltaPackingMultiPage64) {
+    int64_t numValues = 10000;
+    std::vector<int64_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = 10000000 + i * 3;
+    }
+
+    integerPackingMultiPage<int64_t, IntegerDeltaBitpacking<int64_t>>(src);
+}
+
+TEST(CompressionTests, IntegerDeltaPackingMultiPageUnsorted32) {
+    int64_t numValues = 10000;
+    std::vector<int32_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = -i * 5 + (i % 7);
+    }
+
+    integerPackingMultiPage<int32_t, IntegerDeltaBitpacking<int32_t>>(src);
+}
+
+TEST(CompressionTests, IntegerDeltaPackingMultiPageUnsigned64) {
+    int64_t numValues = 10000;
+    std::vector<uint64_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = UINT64_MAX - 20000 + i * 2;
+    }
+
+    integerPackingMultiPage<uint64_t, IntegerDeltaBitpacking<uint64_t>>(src);
+}
+
+TEST(CompressionTests, IntegerDeltaPackingMultiPageUnsigned8) {
+    int64_t numValues = 10000;
+    std::vector<uint8_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = i;
+    }
+
+    integerPackingMultiPage<uint8_t, IntegerDeltaBitpacking<uint8_t>>(src);
+}
+
+TEST(CompressionTests, IntegerDeltaPackingFallsBackForRandomValues) {
+    std::vector<int64_t> src{0, INT64_MAX, INT64_MIN, 5, -5, INT64_MAX};
+    auto alg = IntegerDeltaBitpacking<int64_t>();
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    EXPECT_EQ(metadata.compression, CompressionType::UNCOMPRESSED);
+}
+
+template<typename T>
+void floatCompressionMultiPage(const std::vector<T>& src, const LogicalType& dataType) {
+    auto alg = FloatCompression<T>();
+    auto pageSize = 4096;
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    ASSERT_EQ(metadata.compression, CompressionType::ALP);
+    auto numValuesPerPage = metadata.numValues(pageSize, dataType);
+    ASSERT_GT(numValuesPerPage, pageSize / sizeof(T));
+    int64_t numValuesRemaining = src.size();
+    const uint8_t* srcCursor = (uint8_t*)src.data();
+    auto pages = src.size() / numValuesPerPage + 1;
+    std::vector<std::vector<uint8_t>> dest(pages, std::vector<uint8_t>(pageSize));
+    size_t pageNum = 0;
+    while (numValuesRemaining > 0) {
+        ASSERT_LT(pageNum, pages);
+        alg.compressNextPage(
+            srcCursor, numValuesRemaining, dest[pageNum++].data(), pageSize, metadata);
+        numValuesRemaining -= numValuesPerPage;
+    }
+    ASSERT_EQ(srcCursor, (uint8_t*)(src.data() + src.size()));
+    for (auto i = 0u; i < src.size(); i++) {
+        auto page = i / numValuesPerPage;
+        auto indexInPage = i % numValuesPerPage;
+        T value;
+        alg.decompressFromPage(
+            dest[page].data(), indexInPage, (uint8_t*)&value, 0, 1 /*numValues*/, metadata);
+        EXPECT_EQ(std::memcmp(&src[i], &value, sizeof(T)), 0);
+    }
+    std::vector<T> decompressed(src.size());
+    for (auto i = 0u; i < src.size(); i += numValuesPerPage) {
+        auto page = i / numValuesPerPage;
+        alg.decompressFromPage(dest[page].data(), 0, (uint8_t*)decompressed.data(), i,
+            std::min(numValuesPerPage, (uint64_t)src.size() - i), metadata);
+    }
+    ASSERT_EQ(std::memcmp(decompressed.data(), src.data(), src.size() * sizeof(T)), 0);
+}
+
+TEST(CompressionTests, FloatCompressionMultiPageDouble) {
+    int64_t numValues = 10000;
+    std::vector<double> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = 20.0 + (i % 1000) * 0.01;
+    }
+
+    floatCompressionMultiPage(src, LogicalType(LogicalTypeID::DOUBLE));
+}
+
+TEST(CompressionTests, FloatCompressionMultiPageNegativeDouble) {
+    int64_t numValues = 10000;
+    std::vector<double> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = -1234.5 - i * 0.125;
+    }
+
+    floatCompressionMultiPage(src, LogicalType(LogicalTypeID::DOUBLE));
+}
+
+TEST(CompressionTests, FloatCompressionMultiPageExceptionsDouble) {
+    int64_t numValues = 10000;
+    std::vector<double> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = i * 0.5;
+    }
+    src[0] = -0.0;
+    src[17] = std::numeric_limits<double>::quiet_NaN();
+    src[500] = std::numeric_limits<double>::infinity();
+    src[501] = 1.0 / 3.0;
+    src[9999] = 1e300;
+
+    floatCompressionMultiPage(src, LogicalType(LogicalTypeID::DOUBLE));
+}
+
+TEST(CompressionTests, FloatCompressionMultiPageFloat) {
+    int64_t numValues = 10000;
+    std::vector<float> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = (float)(366 + i % 100) / 10.0f;
+    }
+    src[42] = 1.0f / 3.0f;
+
+    floatCompressionMultiPage(src, LogicalType(LogicalTypeID::FLOAT));
+}
+
+TEST(CompressionTests, FloatCompressionFallsBackForRandomValues) {
+    std::vector<double> src(1000);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = 1.0 / (i + 3);
+    }
+    auto alg = FloatCompression<double>();
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    EXPECT_EQ(metadata.compression, CompressionType::UNCOMPRESSED);
+}
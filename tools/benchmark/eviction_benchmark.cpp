@@ -0,0 +1,155 @@
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+#include "common/string_utils.h"
+#include "main/kuzu.h"
+#include "spdlog/spdlog.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+using namespace kuzu::storage;
+
+// Mixes primary key point lookups over a small hot set of nodes with full scans over a node table
+// that is larger than the buffer pool, and reports the buffer pool hit rate of the point lookups
+// under each eviction policy.
+//
+// Usage: kuzu_eviction_benchmark --dataset=<tmp db dir> [--nodes=N] [--hot-nodes=N]
+//            [--lookups=N] [--rounds=N] [--bm-size=MB] [--policy=fifo|2q|all]
+
+struct EvictionBenchmarkConfig {
+    std::string datasetPath;
+    uint64_t numNodes = 2000000;
+    uint64_t numHotNodes = 2000;
+    uint64_t numLookupsPerRound = 2000;
+    uint64_t numRounds = 5;
+    uint64_t bufferPoolSize = 32ull << 20;
+    std::vector<EvictionPolicy> policies = {EvictionPolicy::FIFO, EvictionPolicy::TWO_QUEUE};
+};
+
+static std::string getArgumentValue(const std::string& arg) {
+    auto splits = StringUtils::split(arg, "=");
+    if (splits.size() != 2) {
+        throw std::invalid_argument("Expect value associate with " + splits[0]);
+    }
+    return splits[1];
+}
+
+static std::string getPolicyName(EvictionPolicy policy) {
+    return policy == EvictionPolicy::FIFO ? "fifo" : "2q";
+}
+
+static void loadDataset(const EvictionBenchmarkConfig& config) {
+    std::filesystem::remove_all(config.datasetPath);
+    auto csvPath = config.datasetPath + ".csv";
+    {
+        std::ofstream csv(csvPath);
+        for (auto i = 0u; i < config.numNodes; ++i) {
+            csv << i << ',' << i * 7 << ",payload-of-item-" << i << '\n';
+        }
+    }
+    auto database = std::make_unique<Database>(config.datasetPath, SystemConfig(1ull << 30));
+    auto conn = std::make_unique<Connection>(database.get());
+    conn->query("CREATE NODE TABLE item(id INT64, v INT64, payload STRING, PRIMARY KEY(id));");
+    auto result = conn->query("COPY item FROM '" + csvPath + "';");
+    if (!result->isSuccess()) {
+        throw std::runtime_error(result->getErrorMessage());
+    }
+    std::filesystem::remove(csvPath);
+}
+
+struct HitCounter {
+    explicit HitCounter(BufferManager* bm)
+        : bm{bm}, numHits{bm->getNumPageHits()}, numMisses{bm->getNumPageMisses()} {}
+
+    double getHitRate() const {
+        auto hits = bm->getNumPageHits() - numHits;
+        auto misses = bm->getNumPageMisses() - numMisses;
+        return hits + misses == 0 ? 0 : (double)hits / (double)(hits + misses);
+    }
+
+    BufferManager* bm;
+    uint64_t numHits;
+    uint64_t numMisses;
+};
+
+static void runWorkload(const EvictionBenchmarkConfig& config, EvictionPolicy policy) {
+    auto database = std::make_unique<Database>(config.datasetPath,
+        SystemConfig(config.bufferPoolSize, 1 /* maxNumThreads */, true /* enableCompression */,
+            false /* readOnly */, -1u /* maxDBSize */, policy));
+    auto conn = std::make_unique<Connection>(database.get());
+    auto bm = conn->getClientContext()->getMemoryManager()->getBufferManager();
+    auto lookup = conn->prepare("MATCH (n:item) WHERE n.id = $id RETURN n.v;");
+    auto scan = "MATCH (n:item) RETURN SUM(n.v), COUNT(n.payload);";
+    std::mt19937_64 rng{42};
+    std::uniform_int_distribution<int64_t> hotKeys{0, (int64_t)config.numHotNodes - 1};
+    auto overall = HitCounter(bm);
+    double lookupHitRateSum = 0;
+    for (auto round = 0u; round < config.numRounds; ++round) {
+        conn->query(scan);
+        auto lookups = HitCounter(bm);
+        for (auto i = 0u; i < config.numLookupsPerRound; ++i) {
+            conn->execute(lookup.get(), std::make_pair(std::string("id"), hotKeys(rng)));
+        }
+        spdlog::info("[{}] Round {}: point lookup hit rate {:.4f}", getPolicyName(policy),
+            round + 1, lookups.getHitRate());
+        lookupHitRateSum += lookups.getHitRate();
+    }
+    spdlog::info("[{}] Average point lookup hit rate: {:.4f}", getPolicyName(policy),
+        lookupHitRateSum / config.numRounds);
+    spdlog::info("[{}] Overall hit rate: {:.4f}", getPolicyName(policy), overall.getHitRate());
+}
+
+int main(int argc, char** argv) {
+    EvictionBenchmarkConfig config;
+    for (auto i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.starts_with("--dataset")) {
+            config.datasetPath = getArgumentValue(arg);
+        } else if (arg.starts_with("--nodes")) {
+            config.numNodes = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--hot-nodes")) {
+            config.numHotNodes = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--lookups")) {
+            config.numLookupsPerRound = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--rounds")) {
+            config.numRounds = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--bm-size")) {
+            config.bufferPoolSize = (uint64_t)stoull(getArgumentValue(arg)) << 20;
+        } else if (arg.starts_with("--policy")) {
+            auto policy = getArgumentValue(arg);
+            if (policy == "fifo") {
+                config.policies = {EvictionPolicy::FIFO};
+            } else if (policy == "2q") {
+                config.policies = {EvictionPolicy::TWO_QUEUE};
+            } else if (policy != "all") {
+                printf("Unrecognized policy %s", policy.c_str());
+                return 1;
+            }
+        } else {
+            printf("Unrecognized option %s", arg.c_str());
+            return 1;
+        }
+    }
+    if (config.datasetPath.empty()) {
+        printf("Missing --dataset input.");
+        return 1;
+    }
+    if (config.numHotNodes == 0 || config.numHotNodes > config.numNodes) {
+        printf("--hot-nodes should be in [1, --nodes].");
+        return 1;
+    }
+    try {
+        loadDataset(config);
+        for (auto policy : config.policies) {
+            runWorkload(config, policy);
+        }
+    } catch (std::exception& e) {
+        spdlog::error("Error encountered while running eviction benchmark: {}.", e.what());
+        return 1;
+    }
+    std::filesystem::remove_all(config.datasetPath);
+    return 0;
+}
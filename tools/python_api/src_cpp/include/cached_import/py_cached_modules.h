@@ -86,6 +86,14 @@ class PyarrowCachedItem : public PythonCachedItem {
         PythonCachedItem _import_from_c;
     };
 
+    class RecordBatchReaderCachedItem : public PythonCachedItem {
+    public:
+        explicit RecordBatchReaderCachedItem(PythonCachedItem* parent): PythonCachedItem("RecordBatchReader", parent),
+            _import_from_c("_import_from_c", this) {}
+
+        PythonCachedItem _import_from_c;
+    };
+
     class SchemaCachedItem : public PythonCachedItem {
     public:
         explicit SchemaCachedItem(PythonCachedItem* parent): PythonCachedItem("Schema", parent),
@@ -106,9 +114,10 @@ class PyarrowCachedItem : public PythonCachedItem {
     class LibCachedItem : public PythonCachedItem {
     public:
         explicit LibCachedItem(PythonCachedItem* parent): PythonCachedItem("lib", parent),
-            RecordBatch(this), Schema(this), Table(this) {}
+            RecordBatch(this), RecordBatchReader(this), Schema(this), Table(this) {}
 
         RecordBatchCachedItem RecordBatch;
+        RecordBatchReaderCachedItem RecordBatchReader;
         SchemaCachedItem Schema;
         TableCachedItem Table;
     };
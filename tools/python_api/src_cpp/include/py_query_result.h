@@ -51,12 +51,6 @@ public:
 private:
     static py::dict convertNodeIdToPyDict(const kuzu::common::nodeID_t& nodeId);
 
-    bool getNextArrowChunk(const std::vector<std::unique_ptr<DataTypeInfo>>& typesInfo,
-        py::list& batches, std::int64_t chunk_size);
-
-    py::object getArrowChunks(
-        const std::vector<std::unique_ptr<DataTypeInfo>>& typesInfo, std::int64_t chunkSize);
-
 private:
     std::unique_ptr<QueryResult> queryResult;
 };
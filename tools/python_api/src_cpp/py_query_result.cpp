@@ -325,39 +325,12 @@ py::object PyQueryResult::getAsDF() {
     return QueryResultConverter(queryResult.get()).toDF();
 }
 
-bool PyQueryResult::getNextArrowChunk(const std::vector<std::unique_ptr<DataTypeInfo>>& typesInfo,
-    py::list& batches, std::int64_t chunkSize) {
-    if (!queryResult->hasNext()) {
-        return false;
-    }
-    ArrowArray data;
-    ArrowConverter::toArrowArray(*queryResult, &data, chunkSize);
-
-    
-    auto batchImportFunc = importCache->pyarrow.lib.RecordBatch._import_from_c();
-
-    auto schema = ArrowConverter::toArrowSchema(typesInfo);
-    batches.append(batchImportFunc((std::uint64_t)&data, (std::uint64_t)schema.get()));
-    return true;
-}
-
-py::object PyQueryResult::getArrowChunks(
-    const std::vector<std::unique_ptr<DataTypeInfo>>& typesInfo, std::int64_t chunkSize) {
-    py::list batches;
-    while (getNextArrowChunk(typesInfo, batches, chunkSize)) {}
-    return batches;
-}
-
 kuzu::pyarrow::Table PyQueryResult::getAsArrow(std::int64_t chunkSize) {
-
-    auto typesInfo = queryResult->getColumnTypesInfo();
-    py::list batches = getArrowChunks(typesInfo, chunkSize);
-    auto schema = ArrowConverter::toArrowSchema(typesInfo);
-
-    auto fromBatchesFunc = importCache->pyarrow.lib.Table.from_batches();
-    auto schemaImportFunc = importCache->pyarrow.lib.Schema._import_from_c();
-    auto schemaObj = schemaImportFunc((std::uint64_t)schema.get());
-    return py::cast<kuzu::pyarrow::Table>(fromBatchesFunc(batches, schemaObj));
+    // The record batches are pulled from the stream one at a time as pyarrow reads them.
+    auto stream = queryResult->getArrowArrayStream(chunkSize);
+    auto readerImportFunc = importCache->pyarrow.lib.RecordBatchReader._import_from_c();
+    auto reader = readerImportFunc((std::uint64_t)stream.get());
+    return py::cast<kuzu::pyarrow::Table>(reader.attr("read_all")());
 }
 
 py::list PyQueryResult::getColumnDataTypes() {